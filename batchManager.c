@@ -0,0 +1,1049 @@
+#include <dirent.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "batchManager.h"
+
+/**
+ * @struct batchWorker_t
+ * @brief 작업 스레드에 전달되는 인자 구조체
+ */
+typedef struct batchWorker_s batchWorker_t;
+struct batchWorker_s
+{
+	// 작업을 관리하는 batchManager_t 구조체
+	batchManager_t *batchManager;
+	// 스레드 번호 (자신의 작업 덱 인덱스)
+	int threadIndex;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for workDeque_t
+//////////////////////////////////////////////////////////////////////////
+
+static int workDequeInit(workDeque_t *deque, int capacity);
+static void workDequeFinal(workDeque_t *deque);
+static void workDequePushBottom(workDeque_t *deque, int taskIndex);
+static int workDequePopBottom(workDeque_t *deque);
+static int workDequeStealTop(workDeque_t *deque);
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for batchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static int batchManagerLoadFileList(batchManager_t *batchManager, const char *inputPath);
+static int batchManagerLoadFileListFromDir(batchManager_t *batchManager, const char *dirPath);
+static int batchManagerLoadFileListFromManifest(batchManager_t *batchManager, const char *manifestPath);
+static int batchManagerAddFile(batchManager_t *batchManager, const char *path);
+static int batchManagerCheckOutputPaths(const batchManager_t *batchManager);
+static int batchManagerLoadCheckpoint(batchManager_t *batchManager);
+static int batchManagerOpenFiles(batchManager_t *batchManager);
+static int batchManagerBuildTasks(batchManager_t *batchManager);
+static void* batchManagerWorkerThread(void *arg);
+static int batchManagerGetNextTask(batchManager_t *batchManager, int threadIndex);
+static void batchManagerRunTask(batchManager_t *batchManager, const batchTask_t *task);
+static void batchManagerFinishFile(batchManager_t *batchManager, batchFile_t *file);
+static int batchManagerSaveCheckpoint(batchManager_t *batchManager, int isForced);
+static int batchManagerWriteSummary(const batchManager_t *batchManager, double elapsedSec);
+static int compareFilePath(const void *file1, const void *file2);
+static int compareOutputPath(const void *file1, const void *file2);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for batchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn batchManager_t* batchManagerNew(const gradeManager_t *gradeManager, const char *inputPath, const char *outputDir, int threadNum)
+ * @brief 일괄 처리 작업을 관리하는 batchManager_t 객체를 새로 생성하는 함수
+ * 입력 경로가 디렉토리면 디렉토리 안의 일반 파일을, 일반 파일이면 한 줄에 하나씩 적힌 경로 목록(manifest)을 처리 대상으로 한다.
+ * 출력 디렉토리에 같은 입력과 등급 정보로 남긴 체크포인트가 있으면 처리를 마친 파일은 건너뛴다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param inputPath 점수 파일 디렉토리 또는 목록 파일 경로(입력, 읽기 전용)
+ * @param outputDir 결과를 저장할 디렉토리 경로(입력, 읽기 전용, 없으면 생성)
+ * @param threadNum 작업 스레드 개수(입력, 0 이하면 온라인 CPU 개수 사용)
+ * @return 성공 시 새로 생성된 batchManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+batchManager_t* batchManagerNew(const gradeManager_t *gradeManager, const char *inputPath, const char *outputDir, int threadNum)
+{
+	if(gradeManager == NULL || inputPath == NULL || outputDir == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, inputPath:%p, outputDir:%p)\n", (const void*)gradeManager, (const void*)inputPath, (const void*)outputDir);
+		return NULL;
+	}
+
+	batchManager_t *batchManager = (batchManager_t*)calloc(1, sizeof(batchManager_t));
+	if(batchManager == NULL)
+	{
+		printf("[DEBUG] batchManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	// 이후의 모든 실패 경로가 batchManagerDelete 를 호출하므로 객체 전체의 mutex 를 가장 먼저 초기화한다.
+	pthread_mutex_init(&(batchManager->mutex), NULL);
+
+	if(threadNum <= 0) threadNum = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(threadNum <= 0) threadNum = 1;
+	if(threadNum > BATCH_MAX_THREAD_NUM) threadNum = BATCH_MAX_THREAD_NUM;
+
+	batchManager->gradeManager = gradeManager;
+	batchManager->threadNum = threadNum;
+	gradeStatsInit(&(batchManager->stats));
+	snprintf(batchManager->outputDir, sizeof(batchManager->outputDir), "%s", outputDir);
+
+	if(mkdir(outputDir, 0755) == -1 && errno != EEXIST)
+	{
+		printf("[ERROR] 출력 디렉토리 생성 실패. (outputDir:%s, errno:%d)\n", outputDir, errno);
+		batchManagerDelete(&batchManager);
+		return NULL;
+	}
+
+	if(batchManagerLoadFileList(batchManager, inputPath) == FAIL
+		|| batchManagerLoadCheckpoint(batchManager) == FAIL
+		|| batchManagerOpenFiles(batchManager) == FAIL
+		|| batchManagerBuildTasks(batchManager) == FAIL)
+	{
+		batchManagerDelete(&batchManager);
+		return NULL;
+	}
+
+	return batchManager;
+}
+
+/**
+ * @fn void batchManagerDelete(batchManager_t **batchManager)
+ * @brief 생성된 batchManager_t 구조체 객체의 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param batchManager 삭제할 batchManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void batchManagerDelete(batchManager_t **batchManager)
+{
+	if(batchManager == NULL || *batchManager == NULL)
+	{
+		printf("[DEBUG] batchManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	batchManager_t *manager = *batchManager;
+	int index = 0;
+
+	if(manager->dequeList != NULL)
+	{
+		for(index = 0; index < manager->threadNum; index++)
+		{
+			workDequeFinal(&(manager->dequeList[index]));
+		}
+		free(manager->dequeList);
+	}
+
+	if(manager->fileList != NULL)
+	{
+		for(index = 0; index < manager->fileNum; index++)
+		{
+			batchFile_t *file = &(manager->fileList[index]);
+			if(file->chunkOutputList != NULL)
+			{
+				int chunkIndex = 0;
+				for( ; chunkIndex < file->chunkNum; chunkIndex++)
+				{
+					recordBufferFinal(&(file->chunkOutputList[chunkIndex]));
+				}
+				free(file->chunkOutputList);
+			}
+			free(file->chunkStatsList);
+			if(file->data != NULL) munmap(file->data, file->size);
+			if(index < manager->fileMutexNum) pthread_mutex_destroy(&(file->mutex));
+		}
+		free(manager->fileList);
+	}
+
+	free(manager->taskList);
+	free(manager->syncIndexList);
+	free(manager->saveIndexList);
+	free(manager->saveItemList);
+	if(manager->checkpoint != NULL) checkpointDelete(&(manager->checkpoint));
+	pthread_mutex_destroy(&(manager->mutex));
+
+	free(manager);
+	*batchManager = NULL;
+}
+
+/**
+ * @fn int batchManagerRun(batchManager_t *batchManager)
+ * @brief 작업 스레드들을 실행해서 모든 파일의 등급을 판단하고, 파일별 결과와 전체 요약을 기록하는 함수
+ * 모든 파일을 처리하면 체크포인트를 지우고, 실패한 파일이 있으면 처리를 마친 파일까지 체크포인트에 저장한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param batchManager 일괄 처리 작업을 관리하는 구조체(입력 및 출력)
+ * @return 모든 파일 처리 성공 시 SUCCESS, 하나라도 실패 시 FAIL 반환
+ */
+int batchManagerRun(batchManager_t *batchManager)
+{
+	if(batchManager == NULL)
+	{
+		printf("[DEBUG] batchManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	pthread_t threadList[BATCH_MAX_THREAD_NUM];
+	batchWorker_t workerList[BATCH_MAX_THREAD_NUM];
+	struct timespec startTime, endTime;
+	int threadIndex = 0;
+	int createdNum = 0;
+
+	printf("[일괄 처리 시작] (files:%d, tasks:%d, threads:%d)\n", batchManager->fileNum, batchManager->taskNum, batchManager->threadNum);
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	for( ; threadIndex < batchManager->threadNum; threadIndex++)
+	{
+		workerList[threadIndex].batchManager = batchManager;
+		workerList[threadIndex].threadIndex = threadIndex;
+		if(pthread_create(&(threadList[threadIndex]), NULL, batchManagerWorkerThread, &(workerList[threadIndex])) != 0)
+		{
+			printf("[ERROR] 작업 스레드 생성 실패. (threadIndex:%d)\n", threadIndex);
+			break;
+		}
+		createdNum++;
+	}
+
+	// 스레드를 하나도 만들지 못했으면 현재 스레드가 모든 작업을 처리한다.
+	if(createdNum == 0)
+	{
+		workerList[0].batchManager = batchManager;
+		workerList[0].threadIndex = 0;
+		batchManagerWorkerThread(&(workerList[0]));
+	}
+
+	for(threadIndex = 0; threadIndex < createdNum; threadIndex++)
+	{
+		pthread_join(threadList[threadIndex], NULL);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	double elapsedSec = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+	int result = SUCCESS;
+	int fileIndex = 0;
+	for( ; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		if(batchManager->fileList[fileIndex].result == FAIL) result = FAIL;
+	}
+
+	if(batchManagerWriteSummary(batchManager, elapsedSec) == FAIL) result = FAIL;
+
+	if(result == SUCCESS) checkpointRemove(batchManager->checkpoint);
+	else batchManagerSaveCheckpoint(batchManager, TRUE);
+
+	printf("[전체 결과] ");
+	gradeStatsPrint(stdout, &(batchManager->stats));
+	printf("[일괄 처리 종료] (elapsed:%.3fs, steals:%lld)\n\n", elapsedSec, batchManager->stealNum);
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for workDeque_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int workDequeInit(workDeque_t *deque, int capacity)
+ * @brief 작업 덱을 초기화하는 함수
+ * batchManagerBuildTasks 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param deque 초기화할 workDeque_t 구조체(출력)
+ * @param capacity 덱에 담을 수 있는 작업 최대 개수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int workDequeInit(workDeque_t *deque, int capacity)
+{
+	deque->taskIndexList = (int*)malloc(sizeof(int) * (size_t)(capacity > 0 ? capacity : 1));
+	if(deque->taskIndexList == NULL)
+	{
+		printf("[DEBUG] workDeque 작업 목록 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	deque->capacity = capacity;
+	deque->top = 0;
+	deque->bottom = 0;
+	pthread_mutex_init(&(deque->mutex), NULL);
+	return SUCCESS;
+}
+
+/**
+ * @fn static void workDequeFinal(workDeque_t *deque)
+ * @brief 작업 덱의 메모리를 해제하는 함수
+ * batchManagerDelete 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param deque 해제할 workDeque_t 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void workDequeFinal(workDeque_t *deque)
+{
+	if(deque->taskIndexList == NULL) return;
+
+	free(deque->taskIndexList);
+	deque->taskIndexList = NULL;
+	pthread_mutex_destroy(&(deque->mutex));
+}
+
+/**
+ * @fn static void workDequePushBottom(workDeque_t *deque, int taskIndex)
+ * @brief 작업 덱의 bottom 에 작업을 넣는 함수
+ * 작업을 나누는 batchManagerBuildTasks 함수에서만 호출되며, 전체 작업 개수로 덱 크기를 정하므로 넘치지 않는다.
+ * @param deque 작업을 넣을 workDeque_t 구조체(입력 및 출력)
+ * @param taskIndex 넣을 작업의 인덱스(입력)
+ * @return 반환값 없음
+ */
+static void workDequePushBottom(workDeque_t *deque, int taskIndex)
+{
+	pthread_mutex_lock(&(deque->mutex));
+	deque->taskIndexList[deque->bottom] = taskIndex;
+	__atomic_store_n(&(deque->bottom), deque->bottom + 1, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&(deque->mutex));
+}
+
+/**
+ * @fn static int workDequePopBottom(workDeque_t *deque)
+ * @brief 소유 스레드가 작업 덱의 bottom 에서 작업을 꺼내는 함수
+ * @param deque 작업을 꺼낼 workDeque_t 구조체(입력 및 출력)
+ * @return 성공 시 작업 인덱스, 덱이 비어 있으면 FAIL 반환
+ */
+static int workDequePopBottom(workDeque_t *deque)
+{
+	int taskIndex = FAIL;
+
+	pthread_mutex_lock(&(deque->mutex));
+	if(deque->bottom > deque->top)
+	{
+		taskIndex = deque->taskIndexList[deque->bottom - 1];
+		__atomic_store_n(&(deque->bottom), deque->bottom - 1, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&(deque->mutex));
+
+	return taskIndex;
+}
+
+/**
+ * @fn static int workDequeStealTop(workDeque_t *deque)
+ * @brief 다른 스레드가 작업 덱의 top 에서 작업을 훔쳐가는 함수
+ * @param deque 작업을 훔칠 workDeque_t 구조체(입력 및 출력)
+ * @return 성공 시 작업 인덱스, 덱이 비어 있으면 FAIL 반환
+ */
+static int workDequeStealTop(workDeque_t *deque)
+{
+	int taskIndex = FAIL;
+
+	// 비어 있는 덱은 잠그지 않고 건너뛴다.
+	if(__atomic_load_n(&(deque->bottom), __ATOMIC_RELAXED) <= __atomic_load_n(&(deque->top), __ATOMIC_RELAXED)) return FAIL;
+
+	pthread_mutex_lock(&(deque->mutex));
+	if(deque->bottom > deque->top)
+	{
+		taskIndex = deque->taskIndexList[deque->top];
+		__atomic_store_n(&(deque->top), deque->top + 1, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&(deque->mutex));
+
+	return taskIndex;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for batchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int batchManagerLoadFileList(batchManager_t *batchManager, const char *inputPath)
+ * @brief 입력 경로의 종류(디렉토리, 목록 파일)에 따라 처리할 파일 목록을 만드는 함수
+ * batchManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터와 경로에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 저장할 구조체(출력)
+ * @param inputPath 점수 파일 디렉토리 또는 목록 파일 경로(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerLoadFileList(batchManager_t *batchManager, const char *inputPath)
+{
+	struct stat fileStat;
+	if(stat(inputPath, &fileStat) == -1)
+	{
+		printf("[ERROR] 입력 경로 접근 실패. (inputPath:%s, errno:%d)\n", inputPath, errno);
+		return FAIL;
+	}
+
+	int result = S_ISDIR(fileStat.st_mode) ? batchManagerLoadFileListFromDir(batchManager, inputPath) : batchManagerLoadFileListFromManifest(batchManager, inputPath);
+	if(result == FAIL) return FAIL;
+
+	if(batchManager->fileNum == 0)
+	{
+		printf("[ERROR] 처리할 점수 파일이 없음. (inputPath:%s)\n", inputPath);
+		return FAIL;
+	}
+
+	return batchManagerCheckOutputPaths(batchManager);
+}
+
+/**
+ * @fn static int batchManagerLoadFileListFromDir(batchManager_t *batchManager, const char *dirPath)
+ * @brief 디렉토리 안의 숨김 파일이 아닌 일반 파일들을 이름 순서로 파일 목록에 추가하는 함수
+ * batchManagerLoadFileList 함수에서 호출되기 때문에 전달받은 구조체 포인터와 경로에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 저장할 구조체(출력)
+ * @param dirPath 점수 파일 디렉토리 경로(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerLoadFileListFromDir(batchManager_t *batchManager, const char *dirPath)
+{
+	DIR *dir = opendir(dirPath);
+	if(dir == NULL)
+	{
+		printf("[ERROR] 디렉토리 열기 실패. (dirPath:%s, errno:%d)\n", dirPath, errno);
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	struct dirent *entry = NULL;
+	while((entry = readdir(dir)) != NULL)
+	{
+		if(entry->d_name[0] == '.') continue;
+
+		char path[PATH_MAX];
+		struct stat fileStat;
+		snprintf(path, sizeof(path), "%s/%s", dirPath, entry->d_name);
+		if(stat(path, &fileStat) == -1 || S_ISREG(fileStat.st_mode) == 0) continue;
+
+		if(batchManagerAddFile(batchManager, path) == FAIL)
+		{
+			result = FAIL;
+			break;
+		}
+	}
+
+	closedir(dir);
+	if(batchManager->fileNum > 1)
+	{
+		qsort(batchManager->fileList, (size_t)batchManager->fileNum, sizeof(batchFile_t), compareFilePath);
+	}
+	return result;
+}
+
+/**
+ * @fn static int batchManagerLoadFileListFromManifest(batchManager_t *batchManager, const char *manifestPath)
+ * @brief 한 줄에 하나씩 파일 경로가 적힌 목록 파일을 읽어서 파일 목록에 추가하는 함수
+ * 빈 줄과 '#' 으로 시작하는 줄은 무시한다.
+ * batchManagerLoadFileList 함수에서 호출되기 때문에 전달받은 구조체 포인터와 경로에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 저장할 구조체(출력)
+ * @param manifestPath 목록 파일 경로(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerLoadFileListFromManifest(batchManager_t *batchManager, const char *manifestPath)
+{
+	FILE *filePtr = fopen(manifestPath, "r");
+	if(filePtr == NULL)
+	{
+		printf("[ERROR] 목록 파일 읽기 실패. (manifestPath:%s)\n", manifestPath);
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	char lineBuffer[PATH_MAX];
+	while(fgets(lineBuffer, sizeof(lineBuffer), filePtr) != NULL)
+	{
+		lineBuffer[strcspn(lineBuffer, "\r\n")] = '\0';
+		if(lineBuffer[0] == '\0' || lineBuffer[0] == '#') continue;
+
+		if(batchManagerAddFile(batchManager, lineBuffer) == FAIL)
+		{
+			result = FAIL;
+			break;
+		}
+	}
+
+	fclose(filePtr);
+	return result;
+}
+
+/**
+ * @fn static int batchManagerAddFile(batchManager_t *batchManager, const char *path)
+ * @brief 파일 목록에 파일 하나를 추가하고 출력 파일 경로를 정하는 함수
+ * 파일 목록은 개수가 2 의 거듭제곱이 될 때마다 두 배로 늘린다.
+ * @param batchManager 파일 목록을 저장할 구조체(출력)
+ * @param path 추가할 파일 경로(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerAddFile(batchManager_t *batchManager, const char *path)
+{
+	int fileNum = batchManager->fileNum;
+	if((fileNum & (fileNum - 1)) == 0)
+	{
+		size_t newCapacity = (fileNum == 0) ? 16 : (size_t)fileNum * 2;
+		if(newCapacity < 16) newCapacity = 16;
+
+		batchFile_t *newList = (batchFile_t*)realloc(batchManager->fileList, sizeof(batchFile_t) * newCapacity);
+		if(newList == NULL)
+		{
+			printf("[DEBUG] 파일 목록 크기 확장 실패. NULL.\n");
+			return FAIL;
+		}
+		batchManager->fileList = newList;
+	}
+
+	batchFile_t *file = &(batchManager->fileList[fileNum]);
+	memset(file, 0, sizeof(batchFile_t));
+	snprintf(file->path, sizeof(file->path), "%s", path);
+
+	const char *baseName = strrchr(path, '/');
+	baseName = (baseName == NULL) ? path : baseName + 1;
+	if(snprintf(file->outputPath, sizeof(file->outputPath), "%s/%s%s", batchManager->outputDir, baseName, BATCH_OUTPUT_SUFFIX) >= (int)sizeof(file->outputPath))
+	{
+		printf("[ERROR] 출력 파일 경로가 너무 김. (path:%s)\n", path);
+		return FAIL;
+	}
+
+	file->result = SUCCESS;
+	gradeStatsInit(&(file->stats));
+
+	batchManager->fileNum++;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int batchManagerCheckOutputPaths(const batchManager_t *batchManager)
+ * @brief 출력 파일 경로가 같은 입력 파일이 둘 이상 있는지 확인하는 함수
+ * 출력 파일 이름은 입력 파일 이름만으로 정하므로 목록 파일에 a/s.txt 와 b/s.txt 처럼 이름이 같은 파일(또는 같은 경로)이 있으면
+ * 나중에 끝난 파일이 앞의 결과를 덮어쓰고, 체크포인트에는 두 파일 모두 완료로 남는다. 이런 목록은 처리하지 않는다.
+ * batchManagerLoadFileList 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 가진 구조체(입력, 읽기 전용)
+ * @return 겹치는 출력 파일이 없으면 SUCCESS, 있으면 FAIL 반환
+ */
+static int batchManagerCheckOutputPaths(const batchManager_t *batchManager)
+{
+	if(batchManager->fileNum < 2) return SUCCESS;
+
+	// 목록 순서는 요약 파일과 체크포인트 항목 순서이므로 포인터 배열만 정렬한다.
+	const batchFile_t **sortedList = (const batchFile_t**)malloc(sizeof(batchFile_t*) * (size_t)batchManager->fileNum);
+	if(sortedList == NULL)
+	{
+		printf("[DEBUG] 출력 경로 정렬 목록 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	int fileIndex = 0;
+	for( ; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		sortedList[fileIndex] = &(batchManager->fileList[fileIndex]);
+	}
+	qsort(sortedList, (size_t)batchManager->fileNum, sizeof(batchFile_t*), compareOutputPath);
+
+	int result = SUCCESS;
+	for(fileIndex = 1; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		if(strcmp(sortedList[fileIndex - 1]->outputPath, sortedList[fileIndex]->outputPath) == 0)
+		{
+			printf("[ERROR] 출력 파일 경로가 같은 입력 파일이 있음. 파일 이름을 다르게 해야 함. (path:%s, path:%s, outputPath:%s)\n",
+				sortedList[fileIndex - 1]->path, sortedList[fileIndex]->path, sortedList[fileIndex]->outputPath);
+			result = FAIL;
+		}
+	}
+
+	free(sortedList);
+	return result;
+}
+
+/**
+ * @fn static int batchManagerLoadCheckpoint(batchManager_t *batchManager)
+ * @brief 출력 디렉토리의 체크포인트를 열고, 이전 실행에서 처리를 마친 파일을 건너뛸 파일로 표시하는 함수
+ * 설정 해시에는 등급 테이블, 출력 디렉토리, 모든 입력 파일의 경로/크기/수정 시각이 들어가므로 하나라도 바뀌면 처음부터 처리한다.
+ * 처리를 마친 파일이라도 출력 파일 길이가 체크포인트와 다르면 다시 처리한다.
+ * batchManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 가진 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerLoadCheckpoint(batchManager_t *batchManager)
+{
+	char checkpointPath[PATH_MAX];
+	if(snprintf(checkpointPath, sizeof(checkpointPath), "%s/%s", batchManager->outputDir, BATCH_CHECKPOINT_FILE) >= (int)sizeof(checkpointPath))
+	{
+		printf("[ERROR] 체크포인트 파일 경로가 너무 김. (outputDir:%s)\n", batchManager->outputDir);
+		return FAIL;
+	}
+
+	uint64_t configHash = checkpointHashConfig(batchManager->gradeManager, batchManager->outputDir);
+	int fileIndex = 0;
+	for( ; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		configHash = checkpointHashFile(batchManager->fileList[fileIndex].path, configHash);
+	}
+
+	checkpoint_t *checkpoint = checkpointNew(checkpointPath, configHash, batchManager->fileNum, NULL);
+	if(checkpoint == NULL) return FAIL;
+	batchManager->checkpoint = checkpoint;
+
+	batchManager->syncIndexList = (int*)malloc(sizeof(int) * (size_t)batchManager->fileNum);
+	batchManager->saveIndexList = (int*)malloc(sizeof(int) * (size_t)batchManager->fileNum);
+	batchManager->saveItemList = (checkpointItem_t*)malloc(sizeof(checkpointItem_t) * (size_t)batchManager->fileNum);
+	if(batchManager->syncIndexList == NULL || batchManager->saveIndexList == NULL || batchManager->saveItemList == NULL)
+	{
+		printf("[DEBUG] 체크포인트 저장 목록 동적 생성 실패. NULL. (fileNum:%d)\n", batchManager->fileNum);
+		return FAIL;
+	}
+
+	if(checkpoint->resumed == FALSE) return SUCCESS;
+
+	gradeStats_t emptyStats;
+	gradeStatsInit(&emptyStats);
+	checkpoint->header.inputOffset = 0;
+	checkpoint->header.outputLength = 0;
+	for(fileIndex = 0; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		batchFile_t *file = &(batchManager->fileList[fileIndex]);
+		checkpointItem_t *item = &(checkpoint->itemList[fileIndex]);
+		if(item->done == FALSE) continue;
+
+		struct stat inputStat, outputStat;
+		if(stat(file->path, &inputStat) == -1 || stat(file->outputPath, &outputStat) == -1 || (uint64_t)outputStat.st_size != item->outputLength)
+		{
+			item->done = FALSE;
+			checkpointSetStats(&(item->stats), &emptyStats);
+			continue;
+		}
+
+		file->skipped = TRUE;
+		checkpointGetStats(&(item->stats), &(file->stats));
+		gradeStatsMerge(&(batchManager->stats), &(file->stats));
+		checkpoint->header.inputOffset += (uint64_t)inputStat.st_size;
+		checkpoint->header.outputLength += item->outputLength;
+		batchManager->skipNum++;
+	}
+	checkpoint->savedOffset = checkpoint->header.inputOffset;
+	checkpointSetStats(&(checkpoint->header.stats), &(batchManager->stats));
+
+	printf("[체크포인트] 처리를 마친 파일은 건너뜀. (files:%d, skipped:%d)\n", batchManager->fileNum, batchManager->skipNum);
+	return SUCCESS;
+}
+
+/**
+ * @fn static int batchManagerOpenFiles(batchManager_t *batchManager)
+ * @brief 파일 목록의 모든 파일을 읽기 전용으로 메모리에 매핑하는 함수
+ * 매핑 후에는 파일 디스크립터를 바로 닫아서 파일이 많아도 디스크립터 한도를 넘지 않도록 한다. (건너뛰는 파일은 매핑하지 않는다)
+ * batchManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 가진 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerOpenFiles(batchManager_t *batchManager)
+{
+	int fileIndex = 0;
+
+	// 파일 목록은 추가와 정렬 중에 메모리 위치가 바뀌므로 목록이 확정된 뒤에 mutex 를 초기화한다.
+	for( ; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		pthread_mutex_init(&(batchManager->fileList[fileIndex].mutex), NULL);
+		batchManager->fileMutexNum++;
+	}
+
+	for(fileIndex = 0; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		batchFile_t *file = &(batchManager->fileList[fileIndex]);
+		if(file->skipped == TRUE) continue;
+
+		int fd = open(file->path, O_RDONLY);
+		if(fd == -1)
+		{
+			printf("[ERROR] 점수 파일 열기 실패. (path:%s, errno:%d)\n", file->path, errno);
+			return FAIL;
+		}
+
+		struct stat fileStat;
+		if(fstat(fd, &fileStat) == -1)
+		{
+			printf("[ERROR] 점수 파일 정보 읽기 실패. (path:%s, errno:%d)\n", file->path, errno);
+			close(fd);
+			return FAIL;
+		}
+
+		file->size = (size_t)fileStat.st_size;
+		if(file->size > 0)
+		{
+			void *data = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(data == MAP_FAILED)
+			{
+				printf("[ERROR] 점수 파일 매핑 실패. (path:%s, errno:%d)\n", file->path, errno);
+				file->size = 0;
+				close(fd);
+				return FAIL;
+			}
+			madvise(data, file->size, MADV_SEQUENTIAL);
+			file->data = (char*)data;
+		}
+
+		close(fd);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int batchManagerBuildTasks(batchManager_t *batchManager)
+ * @brief 각 파일을 BATCH_CHUNK_SIZE 단위의 구간(개행 문자 경계)으로 나누어 작업을 만들고, 스레드별 작업 덱에 골고루 나누어 넣는 함수
+ * 빈 파일도 출력 파일을 만들기 위해 길이 0 인 작업 하나를 가지고, 건너뛰는 파일은 작업을 만들지 않는다.
+ * batchManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param batchManager 파일 목록을 가진 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerBuildTasks(batchManager_t *batchManager)
+{
+	int fileIndex = 0;
+	int taskNum = 0;
+
+	for( ; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		batchFile_t *file = &(batchManager->fileList[fileIndex]);
+		file->chunkNum = (file->skipped == TRUE) ? 0 : (int)(file->size / BATCH_CHUNK_SIZE) + 1;
+		taskNum += file->chunkNum;
+	}
+
+	// 모든 파일을 건너뛰어도 할당이 실패로 보이지 않도록 최소 하나를 잡는다.
+	batchManager->taskList = (batchTask_t*)malloc(sizeof(batchTask_t) * (size_t)((taskNum > 0) ? taskNum : 1));
+	batchManager->dequeList = (workDeque_t*)calloc((size_t)batchManager->threadNum, sizeof(workDeque_t));
+	if(batchManager->taskList == NULL || batchManager->dequeList == NULL)
+	{
+		printf("[DEBUG] 작업 목록 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	int threadIndex = 0;
+	for( ; threadIndex < batchManager->threadNum; threadIndex++)
+	{
+		if(workDequeInit(&(batchManager->dequeList[threadIndex]), taskNum) == FAIL) return FAIL;
+	}
+
+	taskNum = 0;
+	for(fileIndex = 0; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		batchFile_t *file = &(batchManager->fileList[fileIndex]);
+		size_t offset = 0;
+		int chunkIndex = 0;
+		if(file->skipped == TRUE) continue;
+
+		// 개행 문자 경계로 실제 구간을 정하면 예상보다 구간 수가 줄어들 수 있다.
+		do
+		{
+			size_t end = offset + BATCH_CHUNK_SIZE;
+			if(end >= file->size)
+			{
+				end = file->size;
+			}
+			else
+			{
+				const char *newLine = (const char*)memchr(file->data + end, '\n', file->size - end);
+				end = (newLine == NULL) ? file->size : (size_t)(newLine - file->data) + 1;
+			}
+
+			batchTask_t *task = &(batchManager->taskList[taskNum++]);
+			task->fileIndex = fileIndex;
+			task->chunkIndex = chunkIndex++;
+			task->offset = offset;
+			task->length = end - offset;
+			offset = end;
+		} while(offset < file->size);
+
+		file->chunkNum = chunkIndex;
+		file->remainChunkNum = chunkIndex;
+		file->chunkOutputList = (recordBuffer_t*)calloc((size_t)chunkIndex, sizeof(recordBuffer_t));
+		file->chunkStatsList = (gradeStats_t*)malloc(sizeof(gradeStats_t) * (size_t)chunkIndex);
+		if(file->chunkOutputList == NULL || file->chunkStatsList == NULL)
+		{
+			printf("[DEBUG] 구간별 결과 목록 동적 생성 실패. NULL.\n");
+			return FAIL;
+		}
+	}
+	batchManager->taskNum = taskNum;
+
+	// 같은 파일의 구간들이 여러 스레드에 흩어지도록 순서대로 돌아가며 넣는다.
+	int taskIndex = 0;
+	for( ; taskIndex < taskNum; taskIndex++)
+	{
+		workDequePushBottom(&(batchManager->dequeList[taskIndex % batchManager->threadNum]), taskIndex);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void* batchManagerWorkerThread(void *arg)
+ * @brief 자신의 작업 덱에서 작업을 꺼내 처리하고, 비면 다른 스레드의 덱에서 작업을 훔쳐 처리하는 작업 스레드 함수
+ * 모든 작업은 시작 전에 만들어지므로 모든 덱이 비면 스레드를 종료한다.
+ * @param arg batchWorker_t 구조체(입력)
+ * @return 항상 NULL 반환
+ */
+static void* batchManagerWorkerThread(void *arg)
+{
+	batchWorker_t *worker = (batchWorker_t*)arg;
+	batchManager_t *batchManager = worker->batchManager;
+
+	while(1)
+	{
+		int taskIndex = batchManagerGetNextTask(batchManager, worker->threadIndex);
+		if(taskIndex == FAIL) break;
+
+		batchManagerRunTask(batchManager, &(batchManager->taskList[taskIndex]));
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static int batchManagerGetNextTask(batchManager_t *batchManager, int threadIndex)
+ * @brief 다음에 처리할 작업을 자신의 덱 또는 다른 스레드의 덱에서 가져오는 함수
+ * @param batchManager 작업 덱을 가진 구조체(입력 및 출력)
+ * @param threadIndex 현재 스레드 번호(입력)
+ * @return 성공 시 작업 인덱스, 남은 작업이 없으면 FAIL 반환
+ */
+static int batchManagerGetNextTask(batchManager_t *batchManager, int threadIndex)
+{
+	int taskIndex = workDequePopBottom(&(batchManager->dequeList[threadIndex]));
+	if(taskIndex != FAIL) return taskIndex;
+
+	int victimOffset = 1;
+	for( ; victimOffset < batchManager->threadNum; victimOffset++)
+	{
+		int victimIndex = (threadIndex + victimOffset) % batchManager->threadNum;
+		taskIndex = workDequeStealTop(&(batchManager->dequeList[victimIndex]));
+		if(taskIndex != FAIL)
+		{
+			__atomic_add_fetch(&(batchManager->stealNum), 1, __ATOMIC_RELAXED);
+			return taskIndex;
+		}
+	}
+
+	return FAIL;
+}
+
+/**
+ * @fn static void batchManagerRunTask(batchManager_t *batchManager, const batchTask_t *task)
+ * @brief 작업 하나(파일의 한 구간)의 등급을 판단해서 구간별 결과에 저장하고, 파일의 마지막 구간이면 파일을 마무리하는 함수
+ * @param batchManager 작업을 관리하는 구조체(입력 및 출력)
+ * @param task 처리할 작업(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void batchManagerRunTask(batchManager_t *batchManager, const batchTask_t *task)
+{
+	batchFile_t *file = &(batchManager->fileList[task->fileIndex]);
+	recordBuffer_t *output = &(file->chunkOutputList[task->chunkIndex]);
+	gradeStats_t *stats = &(file->chunkStatsList[task->chunkIndex]);
+	int result = SUCCESS;
+
+	gradeStatsInit(stats);
+	if(task->length > 0)
+	{
+		// 출력 레코드는 입력 레코드보다 줄마다 2 바이트 길다.
+		result = recordBufferInit(output, task->length + task->length / 2);
+		if(result == SUCCESS)
+		{
+			result = recordGradeBlock(batchManager->gradeManager, file->data + task->offset, task->length, output, stats);
+		}
+	}
+
+	pthread_mutex_lock(&(file->mutex));
+	if(result == FAIL) file->result = FAIL;
+	int remainChunkNum = --file->remainChunkNum;
+	pthread_mutex_unlock(&(file->mutex));
+
+	if(remainChunkNum == 0)
+	{
+		batchManagerFinishFile(batchManager, file);
+	}
+}
+
+/**
+ * @fn static void batchManagerFinishFile(batchManager_t *batchManager, batchFile_t *file)
+ * @brief 파일의 모든 구간 결과를 순서대로 출력 파일에 기록하고, 통계를 합친 뒤 구간별 버퍼를 해제하는 함수
+ * 파일의 마지막 구간을 끝낸 스레드 하나만 호출하므로 파일 단위의 잠금이 필요 없다.
+ * 성공한 파일은 체크포인트에 완료로 기록하고, 마지막 저장 뒤로 CHECKPOINT_INTERVAL_SIZE 이상 처리했으면 체크포인트를 저장한다.
+ * 출력 파일은 여기서 동기화하지 않고, 체크포인트를 저장하기 직전에 그 체크포인트가 완료로 기록하는 파일만 한꺼번에 동기화한다.
+ * @param batchManager 작업을 관리하는 구조체(입력 및 출력)
+ * @param file 마무리할 파일(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void batchManagerFinishFile(batchManager_t *batchManager, batchFile_t *file)
+{
+	int chunkIndex = 0;
+	uint64_t outputLength = 0;
+	int fd = open(file->outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(fd == -1)
+	{
+		printf("[ERROR] 출력 파일 열기 실패. (outputPath:%s, errno:%d)\n", file->outputPath, errno);
+		file->result = FAIL;
+	}
+
+	for( ; chunkIndex < file->chunkNum; chunkIndex++)
+	{
+		recordBuffer_t *output = &(file->chunkOutputList[chunkIndex]);
+		if(fd != -1 && file->result == SUCCESS && output->length > 0)
+		{
+			file->result = recordBufferWriteAll(fd, output->data, output->length);
+			outputLength += output->length;
+		}
+		recordBufferFinal(output);
+		gradeStatsMerge(&(file->stats), &(file->chunkStatsList[chunkIndex]));
+	}
+
+	if(fd != -1 && close(fd) == -1) file->result = FAIL;
+
+	// 처리가 끝난 입력 파일은 바로 매핑을 해제해서 메모리를 돌려준다.
+	if(file->data != NULL)
+	{
+		munmap(file->data, file->size);
+		file->data = NULL;
+	}
+
+	int isDue = FALSE;
+	pthread_mutex_lock(&(batchManager->mutex));
+	gradeStatsMerge(&(batchManager->stats), &(file->stats));
+	if(file->result == SUCCESS)
+	{
+		checkpoint_t *checkpoint = batchManager->checkpoint;
+		checkpointItem_t *item = &(checkpoint->itemList[file - batchManager->fileList]);
+		item->done = TRUE;
+		item->outputLength = outputLength;
+		checkpointSetStats(&(item->stats), &(file->stats));
+		checkpoint->header.inputOffset += file->size;
+		checkpoint->header.outputLength += outputLength;
+		checkpointSetStats(&(checkpoint->header.stats), &(batchManager->stats));
+		batchManager->syncIndexList[batchManager->syncNum++] = (int)(file - batchManager->fileList);
+		isDue = (checkpoint->header.inputOffset - checkpoint->savedOffset >= (uint64_t)CHECKPOINT_INTERVAL_SIZE) ? TRUE : FALSE;
+	}
+	pthread_mutex_unlock(&(batchManager->mutex));
+
+	if(isDue == TRUE) batchManagerSaveCheckpoint(batchManager, FALSE);
+}
+
+/**
+ * @fn static int batchManagerSaveCheckpoint(batchManager_t *batchManager, int isForced)
+ * @brief 체크포인트가 완료로 기록하는 출력 파일들을 동기화한 뒤 체크포인트를 저장하는 함수
+ * 진행 상태와 동기화할 파일 목록은 mutex 안에서 복사하고, 동기화와 저장(fsync, 디렉토리 동기화)은 mutex 밖에서 해서 다른 스레드를 막지 않는다.
+ * 저장은 한 번에 하나만 하고, 다른 스레드가 저장 중이면 다음 파일을 마칠 때 다시 확인한다.
+ * 동기화에 실패한 파일은 실패로 바꾸고 체크포인트에서 완료 표시를 지운 뒤, 이번 체크포인트는 저장하지 않는다.
+ * @param batchManager 작업을 관리하는 구조체(입력 및 출력)
+ * @param isForced 마지막 저장 뒤로 처리한 크기와 관계없이 저장할지 여부(입력, 작업을 마친 뒤 실패한 파일이 있을 때 TRUE)
+ * @return 저장했거나 저장할 때가 아니면 SUCCESS, 동기화나 저장 실패 시 FAIL 반환
+ */
+static int batchManagerSaveCheckpoint(batchManager_t *batchManager, int isForced)
+{
+	checkpoint_t *checkpoint = batchManager->checkpoint;
+	checkpointHeader_t header;
+	int saveNum = 0;
+	int saveIndex = 0;
+
+	pthread_mutex_lock(&(batchManager->mutex));
+	uint64_t savedOffset = checkpoint->savedOffset;
+	if(batchManager->saving == TRUE || (isForced == FALSE && checkpoint->header.inputOffset - savedOffset < (uint64_t)CHECKPOINT_INTERVAL_SIZE))
+	{
+		pthread_mutex_unlock(&(batchManager->mutex));
+		return SUCCESS;
+	}
+
+	batchManager->saving = TRUE;
+	header = checkpoint->header;
+	memcpy(batchManager->saveItemList, checkpoint->itemList, sizeof(checkpointItem_t) * (size_t)batchManager->fileNum);
+	memcpy(batchManager->saveIndexList, batchManager->syncIndexList, sizeof(int) * (size_t)batchManager->syncNum);
+	saveNum = batchManager->syncNum;
+	batchManager->syncNum = 0;
+	checkpoint->savedOffset = header.inputOffset;
+	pthread_mutex_unlock(&(batchManager->mutex));
+
+	// 체크포인트가 완료로 기록하는 파일은 디스크에 남아있어야 한다.
+	int result = SUCCESS;
+	for( ; saveIndex < saveNum; saveIndex++)
+	{
+		int fileIndex = batchManager->saveIndexList[saveIndex];
+		batchFile_t *file = &(batchManager->fileList[fileIndex]);
+		int fd = open(file->outputPath, O_RDONLY);
+		int syncResult = (fd != -1 && fdatasync(fd) == 0) ? SUCCESS : FAIL;
+		if(fd != -1 && close(fd) == -1) syncResult = FAIL;
+		if(syncResult == SUCCESS) continue;
+
+		printf("[ERROR] 출력 파일 동기화 실패. (outputPath:%s, errno:%d)\n", file->outputPath, errno);
+		result = FAIL;
+
+		pthread_mutex_lock(&(batchManager->mutex));
+		file->result = FAIL;
+		checkpoint->itemList[fileIndex].done = FALSE;
+		pthread_mutex_unlock(&(batchManager->mutex));
+	}
+
+	if(result == SUCCESS) result = checkpointWrite(checkpoint, &header, batchManager->saveItemList);
+
+	pthread_mutex_lock(&(batchManager->mutex));
+	if(result == SUCCESS) checkpoint->saveNum++;
+	else checkpoint->savedOffset = savedOffset;
+	batchManager->saving = FALSE;
+	pthread_mutex_unlock(&(batchManager->mutex));
+
+	return result;
+}
+
+/**
+ * @fn static int batchManagerWriteSummary(const batchManager_t *batchManager, double elapsedSec)
+ * @brief 파일별 통계와 전체 통계를 출력 디렉토리의 요약 파일에 기록하는 함수
+ * @param batchManager 작업을 관리하는 구조체(입력, 읽기 전용)
+ * @param elapsedSec 전체 처리 시간(입력, 초 단위)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int batchManagerWriteSummary(const batchManager_t *batchManager, double elapsedSec)
+{
+	char summaryPath[PATH_MAX];
+	if(snprintf(summaryPath, sizeof(summaryPath), "%s/%s", batchManager->outputDir, BATCH_SUMMARY_FILE) >= (int)sizeof(summaryPath))
+	{
+		printf("[ERROR] 요약 파일 경로가 너무 김. (outputDir:%s)\n", batchManager->outputDir);
+		return FAIL;
+	}
+
+	FILE *filePtr = fopen(summaryPath, "w");
+	if(filePtr == NULL)
+	{
+		printf("[ERROR] 요약 파일 쓰기 실패. (summaryPath:%s)\n", summaryPath);
+		return FAIL;
+	}
+
+	int fileIndex = 0;
+	for( ; fileIndex < batchManager->fileNum; fileIndex++)
+	{
+		const batchFile_t *file = &(batchManager->fileList[fileIndex]);
+		fprintf(filePtr, "%s %s ", file->path, (file->result == SUCCESS) ? "OK" : "FAIL");
+		gradeStatsPrint(filePtr, &(file->stats));
+	}
+
+	fprintf(filePtr, "[Total] files=%d threads=%d elapsed=%.3f ", batchManager->fileNum, batchManager->threadNum, elapsedSec);
+	gradeStatsPrint(filePtr, &(batchManager->stats));
+
+	fclose(filePtr);
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int compareFilePath(const void *file1, const void *file2)
+ * @brief qsort 에서 사용하는 batchFile_t 경로 비교 함수
+ * @param file1 비교할 첫 번째 batchFile_t(입력, 읽기 전용)
+ * @param file2 비교할 두 번째 batchFile_t(입력, 읽기 전용)
+ * @return strcmp 와 같은 비교 결과 반환
+ */
+static int compareFilePath(const void *file1, const void *file2)
+{
+	return strcmp(((const batchFile_t*)file1)->path, ((const batchFile_t*)file2)->path);
+}
+
+/**
+ * @fn static int compareOutputPath(const void *file1, const void *file2)
+ * @brief qsort 에서 사용하는 batchFile_t 포인터의 출력 파일 경로 비교 함수
+ * @param file1 비교할 첫 번째 batchFile_t 포인터의 주소(입력, 읽기 전용)
+ * @param file2 비교할 두 번째 batchFile_t 포인터의 주소(입력, 읽기 전용)
+ * @return strcmp 와 같은 비교 결과 반환
+ */
+static int compareOutputPath(const void *file1, const void *file2)
+{
+	return strcmp((*(const batchFile_t *const *)file1)->outputPath, (*(const batchFile_t *const *)file2)->outputPath);
+}
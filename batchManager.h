@@ -0,0 +1,151 @@
+#ifndef __BATCH_MANAGER_H__
+#define __BATCH_MANAGER_H__
+
+#include <pthread.h>
+#include <limits.h>
+
+#include "recordManager.h"
+#include "checkpointManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 큰 파일을 나누는 작업 단위 크기 (바이트, 실제 경계는 다음 개행 문자까지 늘어난다)
+#define BATCH_CHUNK_SIZE		(4 * 1024 * 1024)
+// 파일별 출력 파일 이름에 붙는 확장자
+#define BATCH_OUTPUT_SUFFIX		".grade"
+// 전체 결과 요약 파일 이름
+#define BATCH_SUMMARY_FILE		"summary.txt"
+// 출력 디렉토리에 저장하는 체크포인트 파일 이름 (숨김 파일이라 입력 디렉토리와 같아도 처리 대상이 되지 않는다)
+#define BATCH_CHECKPOINT_FILE	".batch" CHECKPOINT_SUFFIX
+// 작업 스레드 최대 개수
+#define BATCH_MAX_THREAD_NUM	256
+
+/**
+ * @struct batchTask_t
+ * @brief 한 파일의 일부 구간(개행 문자 경계)에 대한 등급 판단 작업을 나타내는 구조체
+ */
+typedef struct batchTask_s batchTask_t;
+struct batchTask_s
+{
+	// 작업이 속한 파일의 인덱스
+	int fileIndex;
+	// 파일 안에서의 구간 순서
+	int chunkIndex;
+	// 파일 안에서의 구간 시작 위치
+	size_t offset;
+	// 구간 길이
+	size_t length;
+};
+
+/**
+ * @struct workDeque_t
+ * @brief 스레드별 작업 덱을 관리하는 구조체
+ * 소유 스레드는 bottom 에서 꺼내고, 다른 스레드는 top 에서 훔쳐간다. (work stealing)
+ * top, bottom 은 mutex 를 잡은 채 원자적으로 쓰므로, 훔치는 스레드는 잠그기 전에 원자적으로 읽어서 빈 덱을 건너뛸 수 있다.
+ */
+typedef struct workDeque_s workDeque_t;
+struct workDeque_s
+{
+	// 덱 접근 동기화
+	pthread_mutex_t mutex;
+	// 작업 인덱스 배열 (batchManager_t 의 taskList 인덱스)
+	int *taskIndexList;
+	// 작업 인덱스 배열의 전체 크기
+	int capacity;
+	// 다른 스레드가 훔쳐갈 위치
+	int top;
+	// 소유 스레드가 넣고 꺼낼 위치
+	int bottom;
+};
+
+/**
+ * @struct batchFile_t
+ * @brief 일괄 처리할 점수 파일 하나에 대한 정보와 구간별 결과를 관리하는 구조체
+ */
+typedef struct batchFile_s batchFile_t;
+struct batchFile_s
+{
+	// 입력 파일 경로
+	char path[PATH_MAX];
+	// 출력 파일 경로
+	char outputPath[PATH_MAX];
+	// 메모리에 매핑된 입력 파일 내용
+	char *data;
+	// 입력 파일 크기
+	size_t size;
+	// 파일을 나눈 구간 개수
+	int chunkNum;
+	// 아직 끝나지 않은 구간 개수 (mutex 로 보호)
+	int remainChunkNum;
+	// 구간별 출력 버퍼
+	recordBuffer_t *chunkOutputList;
+	// 구간별 등급 통계
+	gradeStats_t *chunkStatsList;
+	// 파일 전체 등급 통계
+	gradeStats_t stats;
+	// 파일 처리 결과 (SUCCESS 또는 FAIL)
+	int result;
+	// 이전 실행에서 처리를 마쳐서 건너뛰는 파일인지 여부 (TRUE 또는 FALSE)
+	int skipped;
+	// remainChunkNum 접근 동기화
+	pthread_mutex_t mutex;
+};
+
+/**
+ * @struct batchManager_t
+ * @brief 디렉토리 또는 목록 파일(manifest)에 있는 점수 파일들을 여러 스레드로 나누어 등급을 판단하는 구조체
+ */
+typedef struct batchManager_s batchManager_t;
+struct batchManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 결과를 저장할 디렉토리
+	char outputDir[PATH_MAX];
+	// 처리할 파일 목록
+	batchFile_t *fileList;
+	// 처리할 파일 개수
+	int fileNum;
+	// 전체 작업 목록
+	batchTask_t *taskList;
+	// 전체 작업 개수
+	int taskNum;
+	// 작업 스레드 개수
+	int threadNum;
+	// 스레드별 작업 덱
+	workDeque_t *dequeList;
+	// 다른 스레드의 작업을 훔쳐온 횟수
+	long long stealNum;
+	// 전체 등급 통계
+	gradeStats_t stats;
+	// 파일 단위로 진행 상태를 저장하는 체크포인트
+	checkpoint_t *checkpoint;
+	// 체크포인트에 완료로 기록했지만 아직 디스크에 동기화하지 않은 파일 인덱스 목록 (mutex 로 보호)
+	int *syncIndexList;
+	// 동기화하지 않은 파일 개수 (mutex 로 보호)
+	int syncNum;
+	// 체크포인트를 저장하는 스레드가 mutex 안에서 복사해 두는 파일 인덱스 목록 (저장은 한 번에 하나만 하므로 공유)
+	int *saveIndexList;
+	// 체크포인트를 저장하는 스레드가 mutex 안에서 복사해 두는 항목 목록
+	checkpointItem_t *saveItemList;
+	// 체크포인트를 저장하는 중인지 여부 (mutex 로 보호)
+	int saving;
+	// 이전 실행에서 처리를 마쳐서 건너뛰는 파일 개수
+	int skipNum;
+	// mutex 를 초기화한 파일 개수 (목록 앞에서부터, batchManagerNew 가 중간에 실패해도 초기화한 것만 해제한다)
+	int fileMutexNum;
+	// stealNum, stats, checkpoint, 체크포인트 저장 상태 접근 동기화
+	pthread_mutex_t mutex;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for batchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+batchManager_t* batchManagerNew(const gradeManager_t *gradeManager, const char *inputPath, const char *outputDir, int threadNum);
+void batchManagerDelete(batchManager_t **batchManager);
+int batchManagerRun(batchManager_t *batchManager);
+
+#endif // #ifndef __BATCH_MANAGER_H__
@@ -0,0 +1,653 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <dirent.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "cacheManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 64 비트 해시 함수 상수 (xxHash64 와 같은 곱셈-회전 구성)
+#define CACHE_PRIME1	0x9E3779B185EBCA87ULL
+#define CACHE_PRIME2	0xC2B2AE3D27D4EB4FULL
+#define CACHE_PRIME3	0x165667B19E3779F9ULL
+#define CACHE_PRIME4	0x85EBCA77C2B2AE63ULL
+#define CACHE_PRIME5	0x27D4EB2F165667C5ULL
+
+/**
+ * @struct cacheEntry_t
+ * @brief 정리(eviction) 단계에서 캐시 항목 파일 하나의 이름, 크기, 사용 시각을 저장하는 구조체
+ */
+typedef struct cacheEntry_s cacheEntry_t;
+struct cacheEntry_s
+{
+	// 항목 파일 이름
+	char name[NAME_MAX + 1];
+	// 항목 파일 크기
+	long long size;
+	// 마지막 사용 시각
+	struct timespec mtime;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static uint64_t cacheRotateLeft(uint64_t value, int bits);
+static uint64_t cacheRead64(const unsigned char *data);
+static uint32_t cacheRead32(const unsigned char *data);
+static uint64_t cacheHashRound(uint64_t acc, uint64_t input);
+static uint64_t cacheHashMerge(uint64_t acc, uint64_t value);
+static uint64_t cacheManagerHashTable(const gradeManager_t *gradeManager);
+static int cacheManagerGetEntryPath(const cacheManager_t *cacheManager, uint64_t inputHash, char *path, size_t size);
+static int cacheManagerEvict(cacheManager_t *cacheManager);
+static int cacheEntryCompare(const void *left, const void *right);
+static int cacheHasSuffix(const char *name, const char *suffix);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for cacheManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn cacheManager_t* cacheManagerNew(const gradeManager_t *gradeManager, const char *dir, long long maxSize)
+ * @brief 결과 캐시를 관리하는 cacheManager_t 객체를 생성하고 등급 테이블 해시를 계산하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 검증된 등급 정보를 가진 구조체(입력, 읽기 전용)
+ * @param dir 캐시 디렉토리 경로(입력, 읽기 전용, 없으면 생성)
+ * @param maxSize 캐시 디렉토리 최대 크기(입력, 바이트, 0 이하면 CACHE_DEFAULT_MAX_SIZE 사용)
+ * @return 성공 시 새로 생성된 cacheManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+cacheManager_t* cacheManagerNew(const gradeManager_t *gradeManager, const char *dir, long long maxSize)
+{
+	if(gradeManager == NULL || dir == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, dir:%p)\n", (const void*)gradeManager, (const void*)dir);
+		return NULL;
+	}
+
+	if(mkdir(dir, 0755) == -1 && errno != EEXIST)
+	{
+		printf("[ERROR] 캐시 디렉토리 생성 실패. (dir:%s, errno:%d)\n", dir, errno);
+		return NULL;
+	}
+
+	cacheManager_t *cacheManager = (cacheManager_t*)calloc(1, sizeof(cacheManager_t));
+	if(cacheManager == NULL)
+	{
+		printf("[DEBUG] cacheManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	cacheManager->gradeManager = gradeManager;
+	cacheManager->maxSize = (maxSize > 0) ? maxSize : CACHE_DEFAULT_MAX_SIZE;
+	cacheManager->tableHash = cacheManagerHashTable(gradeManager);
+	snprintf(cacheManager->dir, sizeof(cacheManager->dir), "%s", dir);
+
+	return cacheManager;
+}
+
+/**
+ * @fn void cacheManagerDelete(cacheManager_t **cacheManager)
+ * @brief 생성된 cacheManager_t 구조체 객체의 메모리를 해제하는 함수 (캐시 디렉토리는 그대로 둔다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param cacheManager 삭제할 cacheManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void cacheManagerDelete(cacheManager_t **cacheManager)
+{
+	if(cacheManager == NULL || *cacheManager == NULL)
+	{
+		printf("[DEBUG] cacheManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	free(*cacheManager);
+	*cacheManager = NULL;
+}
+
+/**
+ * @fn uint64_t cacheHash64(const void *data, size_t length, uint64_t seed)
+ * @brief 데이터의 64 비트 해시를 계산하는 함수 (xxHash64 알고리즘)
+ * 32 바이트마다 4 개의 독립된 누산기로 곱셈-회전을 수행하므로 메모리 대역폭에 가까운 속도로 동작한다.
+ * @param data 해시를 계산할 데이터(입력, 읽기 전용, length 가 0 이면 NULL 가능)
+ * @param length 데이터 길이(입력)
+ * @param seed 해시 초기값(입력)
+ * @return 항상 64 비트 해시값 반환
+ */
+uint64_t cacheHash64(const void *data, size_t length, uint64_t seed)
+{
+	const unsigned char *pos = (const unsigned char*)data;
+	const unsigned char *end = pos + length;
+	uint64_t hash = 0;
+
+	if(length >= 32)
+	{
+		const unsigned char *limit = end - 32;
+		uint64_t acc1 = seed + CACHE_PRIME1 + CACHE_PRIME2;
+		uint64_t acc2 = seed + CACHE_PRIME2;
+		uint64_t acc3 = seed;
+		uint64_t acc4 = seed - CACHE_PRIME1;
+
+		do
+		{
+			acc1 = cacheHashRound(acc1, cacheRead64(pos));
+			acc2 = cacheHashRound(acc2, cacheRead64(pos + 8));
+			acc3 = cacheHashRound(acc3, cacheRead64(pos + 16));
+			acc4 = cacheHashRound(acc4, cacheRead64(pos + 24));
+			pos += 32;
+		} while(pos <= limit);
+
+		hash = cacheRotateLeft(acc1, 1) + cacheRotateLeft(acc2, 7) + cacheRotateLeft(acc3, 12) + cacheRotateLeft(acc4, 18);
+		hash = cacheHashMerge(hash, acc1);
+		hash = cacheHashMerge(hash, acc2);
+		hash = cacheHashMerge(hash, acc3);
+		hash = cacheHashMerge(hash, acc4);
+	}
+	else
+	{
+		hash = seed + CACHE_PRIME5;
+	}
+
+	hash += (uint64_t)length;
+
+	for( ; pos + 8 <= end; pos += 8)
+	{
+		hash ^= cacheHashRound(0, cacheRead64(pos));
+		hash = cacheRotateLeft(hash, 27) * CACHE_PRIME1 + CACHE_PRIME4;
+	}
+
+	if(pos + 4 <= end)
+	{
+		hash ^= (uint64_t)cacheRead32(pos) * CACHE_PRIME1;
+		hash = cacheRotateLeft(hash, 23) * CACHE_PRIME2 + CACHE_PRIME3;
+		pos += 4;
+	}
+
+	for( ; pos < end; pos++)
+	{
+		hash ^= (uint64_t)(*pos) * CACHE_PRIME5;
+		hash = cacheRotateLeft(hash, 11) * CACHE_PRIME1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= CACHE_PRIME2;
+	hash ^= hash >> 29;
+	hash *= CACHE_PRIME3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+/**
+ * @fn int cacheManagerLookup(cacheManager_t *cacheManager, uint64_t inputHash, uint64_t inputSize, int outputFd, gradeStats_t *stats)
+ * @brief 입력 해시에 해당하는 캐시 항목이 있으면 저장된 결과를 출력 파일에 쓰고 통계를 복원하는 함수
+ * 적중한 항목은 mtime 을 현재 시각으로 갱신해서 LRU 정리 순서에서 뒤로 보낸다.
+ * 다른 프로세스가 같은 항목을 교체하거나 삭제해도 이미 연 파일은 그대로 읽을 수 있다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param cacheManager 캐시를 관리하는 구조체(입력 및 출력)
+ * @param inputHash 입력 파일 내용의 해시(입력)
+ * @param inputSize 입력 파일 크기(입력)
+ * @param outputFd 저장된 결과를 쓸 파일 디스크립터(입력)
+ * @param stats 복원한 등급 통계(출력)
+ * @return 적중 시 SUCCESS, 항목이 없거나 손상되었거나 출력에 실패하면 FAIL 반환
+ */
+int cacheManagerLookup(cacheManager_t *cacheManager, uint64_t inputHash, uint64_t inputSize, int outputFd, gradeStats_t *stats)
+{
+	if(cacheManager == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (cacheManager:%p, stats:%p)\n", (void*)cacheManager, (void*)stats);
+		return FAIL;
+	}
+
+	char path[PATH_MAX];
+	if(cacheManagerGetEntryPath(cacheManager, inputHash, path, sizeof(path)) == FAIL) return FAIL;
+
+	int fd = open(path, O_RDONLY);
+	if(fd == -1) return FAIL;
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1 || (size_t)fileStat.st_size < sizeof(cacheHeader_t))
+	{
+		close(fd);
+		return FAIL;
+	}
+
+	size_t size = (size_t)fileStat.st_size;
+	void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if(mapped == MAP_FAILED)
+	{
+		close(fd);
+		return FAIL;
+	}
+
+	const cacheHeader_t *header = (const cacheHeader_t*)mapped;
+	int result = FAIL;
+	if(memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) == 0 && header->version == CACHE_VERSION
+		&& header->inputHash == inputHash && header->tableHash == cacheManager->tableHash && header->inputSize == inputSize
+		&& header->outputLength == size - sizeof(cacheHeader_t))
+	{
+		result = recordBufferWriteAll(outputFd, (const char*)mapped + sizeof(cacheHeader_t), (size_t)header->outputLength);
+		if(result == SUCCESS)
+		{
+			int gradeIndex = 0;
+			for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+			{
+				stats->count[gradeIndex] = header->countList[gradeIndex];
+			}
+			stats->total = header->total;
+			stats->sum = header->sum;
+			stats->min = header->min;
+			stats->max = header->max;
+			futimens(fd, NULL);
+		}
+	}
+	else
+	{
+		printf("[ERROR] 캐시 항목 손상 또는 불일치. 다시 계산함. (fileName:%s)\n", path);
+	}
+
+	munmap(mapped, size);
+	close(fd);
+	return result;
+}
+
+/**
+ * @fn int cacheManagerStore(cacheManager_t *cacheManager, uint64_t inputHash, uint64_t inputSize, const char *output, size_t outputLength, const gradeStats_t *stats)
+ * @brief 등급 판단 결과와 통계를 캐시 항목으로 저장하고, 크기 제한을 넘으면 오래된 항목을 정리하는 함수
+ * 임시 파일에 모두 쓰고 fsync 한 뒤 rename 으로 교체하므로 다른 프로세스는 완성된 항목만 보게 된다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param cacheManager 캐시를 관리하는 구조체(입력 및 출력)
+ * @param inputHash 입력 파일 내용의 해시(입력)
+ * @param inputSize 입력 파일 크기(입력)
+ * @param output 등급 판단 결과 레코드(입력, 읽기 전용)
+ * @param outputLength 결과 레코드 길이(입력)
+ * @param stats 등급 통계(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환 (항목이 최대 크기보다 크면 저장하지 않고 SUCCESS)
+ */
+int cacheManagerStore(cacheManager_t *cacheManager, uint64_t inputHash, uint64_t inputSize, const char *output, size_t outputLength, const gradeStats_t *stats)
+{
+	if(cacheManager == NULL || (output == NULL && outputLength > 0) || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (cacheManager:%p, output:%p, stats:%p)\n", (void*)cacheManager, (const void*)output, (const void*)stats);
+		return FAIL;
+	}
+
+	if((long long)(sizeof(cacheHeader_t) + outputLength) > cacheManager->maxSize) return SUCCESS;
+
+	cacheHeader_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+	header.version = CACHE_VERSION;
+	header.inputHash = inputHash;
+	header.tableHash = cacheManager->tableHash;
+	header.inputSize = inputSize;
+	header.outputLength = outputLength;
+	header.total = stats->total;
+	header.sum = stats->sum;
+	header.min = stats->min;
+	header.max = stats->max;
+
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		header.countList[gradeIndex] = stats->count[gradeIndex];
+	}
+
+	char path[PATH_MAX];
+	char tempPath[PATH_MAX];
+	if(cacheManagerGetEntryPath(cacheManager, inputHash, path, sizeof(path)) == FAIL
+		|| snprintf(tempPath, sizeof(tempPath), "%s/%s%d.%lx", cacheManager->dir, CACHE_TEMP_PREFIX, (int)getpid(), (unsigned long)pthread_self()) >= (int)sizeof(tempPath))
+	{
+		printf("[ERROR] 캐시 항목 경로가 너무 김. (dir:%s)\n", cacheManager->dir);
+		return FAIL;
+	}
+
+	int fd = open(tempPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(fd == -1)
+	{
+		printf("[ERROR] 캐시 임시 파일 열기 실패. (fileName:%s, errno:%d)\n", tempPath, errno);
+		return FAIL;
+	}
+
+	int result = recordBufferWriteAll(fd, (const char*)&header, sizeof(header));
+	if(result == SUCCESS) result = recordBufferWriteAll(fd, output, outputLength);
+	if(result == SUCCESS && fsync(fd) == -1) result = FAIL;
+	if(close(fd) == -1) result = FAIL;
+	if(result == SUCCESS && rename(tempPath, path) == -1)
+	{
+		printf("[ERROR] 캐시 항목 교체 실패. (fileName:%s, errno:%d)\n", path, errno);
+		result = FAIL;
+	}
+
+	if(result == FAIL)
+	{
+		unlink(tempPath);
+		return FAIL;
+	}
+
+	return cacheManagerEvict(cacheManager);
+}
+
+/**
+ * @fn int cacheManagerGradeFile(cacheManager_t *cacheManager, const char *inputFileName, const char *outputFileName, gradeStats_t *stats)
+ * @brief 점수 파일의 등급 판단 결과를 캐시에서 찾아 쓰고, 없으면 계산한 뒤 캐시에 저장하는 함수
+ * 결과 형식은 batch 의 파일별 결과(recordGradeBlock)와 같다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param cacheManager 캐시를 관리하는 구조체(입력 및 출력)
+ * @param inputFileName 점수 파일 이름(입력, 읽기 전용)
+ * @param outputFileName 결과 파일 이름(입력, 읽기 전용)
+ * @param stats 등급 통계(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int cacheManagerGradeFile(cacheManager_t *cacheManager, const char *inputFileName, const char *outputFileName, gradeStats_t *stats)
+{
+	if(cacheManager == NULL || inputFileName == NULL || outputFileName == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (cacheManager:%p, inputFileName:%p, outputFileName:%p, stats:%p)\n", (void*)cacheManager, (const void*)inputFileName, (const void*)outputFileName, (void*)stats);
+		return FAIL;
+	}
+
+	int fd = open(inputFileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 입력 파일 열기 실패. (fileName:%s, errno:%d)\n", inputFileName, errno);
+		return FAIL;
+	}
+
+	struct stat fileStat;
+	char *data = NULL;
+	size_t size = 0;
+	if(fstat(fd, &fileStat) == 0) size = (size_t)fileStat.st_size;
+	if(size > 0)
+	{
+		void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapped == MAP_FAILED)
+		{
+			printf("[ERROR] 입력 파일 매핑 실패. (fileName:%s, errno:%d)\n", inputFileName, errno);
+			close(fd);
+			return FAIL;
+		}
+		madvise(mapped, size, MADV_SEQUENTIAL);
+		data = (char*)mapped;
+	}
+	close(fd);
+
+	int outputFd = open(outputFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(outputFd == -1)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", outputFileName, errno);
+		if(data != NULL) munmap(data, size);
+		return FAIL;
+	}
+
+	uint64_t inputHash = cacheHash64(data, size, 0);
+	int result = cacheManagerLookup(cacheManager, inputHash, (uint64_t)size, outputFd, stats);
+	if(result == SUCCESS)
+	{
+		cacheManager->hitNum++;
+		printf("[캐시 적중] (input:%s, hash:%016llx)\n", inputFileName, (unsigned long long)inputHash);
+	}
+	else
+	{
+		recordBuffer_t output;
+		cacheManager->missNum++;
+		printf("[캐시 없음] (input:%s, hash:%016llx)\n", inputFileName, (unsigned long long)inputHash);
+
+		// 적중 실패 중 일부를 쓴 상태일 수 있으므로 결과 파일을 비우고 다시 쓴다.
+		gradeStatsInit(stats);
+		result = (ftruncate(outputFd, 0) == 0 && lseek(outputFd, 0, SEEK_SET) == 0) ? SUCCESS : FAIL;
+		if(result == SUCCESS) result = recordBufferInit(&output, size + size / 2 + 1);
+		if(result == SUCCESS)
+		{
+			result = recordGradeBlock(cacheManager->gradeManager, data, size, &output, stats);
+			if(result == SUCCESS) result = recordBufferWriteAll(outputFd, output.data, output.length);
+			if(result == SUCCESS) result = cacheManagerStore(cacheManager, inputHash, (uint64_t)size, output.data, output.length, stats);
+			recordBufferFinal(&output);
+		}
+	}
+
+	if(close(outputFd) == -1) result = FAIL;
+	if(data != NULL) munmap(data, size);
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static uint64_t cacheRotateLeft(uint64_t value, int bits)
+ * @brief 64 비트 값을 왼쪽으로 회전하는 함수
+ * @param value 회전할 값(입력)
+ * @param bits 회전할 비트 수(입력, 1 ~ 63)
+ * @return 회전한 값 반환
+ */
+static uint64_t cacheRotateLeft(uint64_t value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * @fn static uint64_t cacheRead64(const unsigned char *data)
+ * @brief 정렬되지 않은 위치에서 64 비트 값을 읽는 함수
+ * @param data 읽을 위치(입력, 읽기 전용)
+ * @return 읽은 값 반환
+ */
+static uint64_t cacheRead64(const unsigned char *data)
+{
+	uint64_t value = 0;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+/**
+ * @fn static uint32_t cacheRead32(const unsigned char *data)
+ * @brief 정렬되지 않은 위치에서 32 비트 값을 읽는 함수
+ * @param data 읽을 위치(입력, 읽기 전용)
+ * @return 읽은 값 반환
+ */
+static uint32_t cacheRead32(const unsigned char *data)
+{
+	uint32_t value = 0;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+/**
+ * @fn static uint64_t cacheHashRound(uint64_t acc, uint64_t input)
+ * @brief 누산기에 입력 값 하나를 섞는 해시 단계 함수
+ * @param acc 누산기 값(입력)
+ * @param input 섞을 입력 값(입력)
+ * @return 갱신된 누산기 값 반환
+ */
+static uint64_t cacheHashRound(uint64_t acc, uint64_t input)
+{
+	acc += input * CACHE_PRIME2;
+	acc = cacheRotateLeft(acc, 31);
+	return acc * CACHE_PRIME1;
+}
+
+/**
+ * @fn static uint64_t cacheHashMerge(uint64_t acc, uint64_t value)
+ * @brief 누산기 하나를 최종 해시값에 합치는 함수
+ * @param acc 최종 해시값(입력)
+ * @param value 합칠 누산기 값(입력)
+ * @return 갱신된 해시값 반환
+ */
+static uint64_t cacheHashMerge(uint64_t acc, uint64_t value)
+{
+	acc ^= cacheHashRound(0, value);
+	return acc * CACHE_PRIME1 + CACHE_PRIME4;
+}
+
+/**
+ * @fn static uint64_t cacheManagerHashTable(const gradeManager_t *gradeManager)
+ * @brief 검증된 등급 테이블(배율, 전체 범위, 등급별 범위)과 캐시 형식 버전의 해시를 계산하는 함수
+ * ini 파일의 주석이나 공백만 바뀐 경우에는 같은 해시가 나오므로 기존 결과를 그대로 재사용한다.
+ * @param gradeManager 검증된 등급 정보를 가진 구조체(입력, 읽기 전용)
+ * @return 항상 등급 테이블 해시값 반환
+ */
+static uint64_t cacheManagerHashTable(const gradeManager_t *gradeManager)
+{
+	int32_t table[GRADE_TABLE_LEN + 1];
+
+	table[0] = CACHE_VERSION;
+	gradeManagerGetTable(gradeManager, table + 1);
+
+	return cacheHash64(table, sizeof(table), 0);
+}
+
+/**
+ * @fn static int cacheManagerGetEntryPath(const cacheManager_t *cacheManager, uint64_t inputHash, char *path, size_t size)
+ * @brief 입력 해시와 등급 테이블 해시로 캐시 항목 파일 경로를 만드는 함수
+ * @param cacheManager 캐시를 관리하는 구조체(입력, 읽기 전용)
+ * @param inputHash 입력 파일 내용의 해시(입력)
+ * @param path 항목 파일 경로(출력)
+ * @param size path 버퍼 크기(입력)
+ * @return 성공 시 SUCCESS, 경로가 너무 길면 FAIL 반환
+ */
+static int cacheManagerGetEntryPath(const cacheManager_t *cacheManager, uint64_t inputHash, char *path, size_t size)
+{
+	if(snprintf(path, size, "%s/%016llx-%016llx%s", cacheManager->dir, (unsigned long long)inputHash, (unsigned long long)cacheManager->tableHash, CACHE_ENTRY_SUFFIX) >= (int)size)
+	{
+		printf("[ERROR] 캐시 항목 경로가 너무 김. (dir:%s)\n", cacheManager->dir);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int cacheManagerEvict(cacheManager_t *cacheManager)
+ * @brief 캐시 디렉토리 크기가 최대 크기를 넘으면 사용 시각이 오래된 항목부터 삭제하는 함수
+ * 잠금 파일에 flock 을 잡은 프로세스 하나만 정리를 수행하고, 다른 프로세스가 정리 중이면 기다리지 않고 넘어간다.
+ * 오래된 임시 파일(중단된 프로세스가 남긴 것)도 함께 삭제한다.
+ * cacheManagerStore 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param cacheManager 캐시를 관리하는 구조체(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int cacheManagerEvict(cacheManager_t *cacheManager)
+{
+	char path[PATH_MAX];
+	if(snprintf(path, sizeof(path), "%s/%s", cacheManager->dir, CACHE_LOCK_FILE) >= (int)sizeof(path)) return FAIL;
+
+	int lockFd = open(path, O_RDWR | O_CREAT, 0644);
+	if(lockFd == -1)
+	{
+		printf("[ERROR] 캐시 잠금 파일 열기 실패. (fileName:%s, errno:%d)\n", path, errno);
+		return FAIL;
+	}
+
+	if(flock(lockFd, LOCK_EX | LOCK_NB) == -1)
+	{
+		close(lockFd);
+		return SUCCESS;
+	}
+
+	DIR *dir = opendir(cacheManager->dir);
+	if(dir == NULL)
+	{
+		printf("[ERROR] 캐시 디렉토리 열기 실패. (dir:%s, errno:%d)\n", cacheManager->dir, errno);
+		close(lockFd);
+		return FAIL;
+	}
+
+	cacheEntry_t *entryList = NULL;
+	int entryNum = 0;
+	int entryCapacity = 0;
+	long long totalSize = 0;
+	time_t now = time(NULL);
+	int result = SUCCESS;
+	struct dirent *dirEntry = NULL;
+
+	while((dirEntry = readdir(dir)) != NULL && result == SUCCESS)
+	{
+		struct stat fileStat;
+		if(fstatat(dirfd(dir), dirEntry->d_name, &fileStat, 0) == -1 || S_ISREG(fileStat.st_mode) == 0) continue;
+
+		if(strncmp(dirEntry->d_name, CACHE_TEMP_PREFIX, strlen(CACHE_TEMP_PREFIX)) == 0)
+		{
+			if(now - fileStat.st_mtime > CACHE_TEMP_EXPIRE_SEC) unlinkat(dirfd(dir), dirEntry->d_name, 0);
+			continue;
+		}
+		if(cacheHasSuffix(dirEntry->d_name, CACHE_ENTRY_SUFFIX) == FALSE) continue;
+
+		if(entryNum == entryCapacity)
+		{
+			int newCapacity = (entryCapacity == 0) ? 64 : entryCapacity * 2;
+			cacheEntry_t *newList = (cacheEntry_t*)realloc(entryList, sizeof(cacheEntry_t) * (size_t)newCapacity);
+			if(newList == NULL)
+			{
+				printf("[DEBUG] 캐시 항목 목록 동적 생성 실패. NULL.\n");
+				result = FAIL;
+				continue;
+			}
+			entryList = newList;
+			entryCapacity = newCapacity;
+		}
+
+		cacheEntry_t *entry = &(entryList[entryNum++]);
+		snprintf(entry->name, sizeof(entry->name), "%s", dirEntry->d_name);
+		entry->size = (long long)fileStat.st_size;
+		entry->mtime = fileStat.st_mtim;
+		totalSize += entry->size;
+	}
+
+	if(result == SUCCESS && totalSize > cacheManager->maxSize)
+	{
+		int entryIndex = 0;
+		qsort(entryList, (size_t)entryNum, sizeof(cacheEntry_t), cacheEntryCompare);
+		for( ; entryIndex < entryNum && totalSize > cacheManager->maxSize; entryIndex++)
+		{
+			if(unlinkat(dirfd(dir), entryList[entryIndex].name, 0) == 0 || errno == ENOENT)
+			{
+				totalSize -= entryList[entryIndex].size;
+				printf("[캐시 정리] (entry:%s, size:%lld)\n", entryList[entryIndex].name, entryList[entryIndex].size);
+			}
+		}
+	}
+
+	free(entryList);
+	closedir(dir);
+	flock(lockFd, LOCK_UN);
+	close(lockFd);
+	return result;
+}
+
+/**
+ * @fn static int cacheEntryCompare(const void *left, const void *right)
+ * @brief qsort 에서 사용하는 정렬 기준 함수 (사용 시각이 오래된 항목이 앞)
+ * @param left 비교할 cacheEntry_t(입력, 읽기 전용)
+ * @param right 비교할 cacheEntry_t(입력, 읽기 전용)
+ * @return left 가 앞이면 음수, 뒤면 양수, 같으면 0 반환
+ */
+static int cacheEntryCompare(const void *left, const void *right)
+{
+	const cacheEntry_t *leftEntry = (const cacheEntry_t*)left;
+	const cacheEntry_t *rightEntry = (const cacheEntry_t*)right;
+
+	if(leftEntry->mtime.tv_sec != rightEntry->mtime.tv_sec) return (leftEntry->mtime.tv_sec < rightEntry->mtime.tv_sec) ? -1 : 1;
+	if(leftEntry->mtime.tv_nsec != rightEntry->mtime.tv_nsec) return (leftEntry->mtime.tv_nsec < rightEntry->mtime.tv_nsec) ? -1 : 1;
+	return 0;
+}
+
+/**
+ * @fn static int cacheHasSuffix(const char *name, const char *suffix)
+ * @brief 파일 이름이 지정한 확장자로 끝나는지 확인하는 함수
+ * @param name 확인할 파일 이름(입력, 읽기 전용)
+ * @param suffix 확장자(입력, 읽기 전용)
+ * @return 끝나면 TRUE, 아니면 FALSE 반환
+ */
+static int cacheHasSuffix(const char *name, const char *suffix)
+{
+	size_t nameLength = strlen(name);
+	size_t suffixLength = strlen(suffix);
+	if(nameLength < suffixLength) return FALSE;
+	return (strcmp(name + nameLength - suffixLength, suffix) == 0) ? TRUE : FALSE;
+}
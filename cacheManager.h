@@ -0,0 +1,97 @@
+#ifndef __CACHE_MANAGER_H__
+#define __CACHE_MANAGER_H__
+
+#include <stdint.h>
+#include <limits.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 캐시 항목 파일 식별 문자열
+#define CACHE_MAGIC	"GRCH"
+// 캐시 항목 형식 버전 (출력 형식이 바뀌면 올려서 이전 항목을 무효로 만든다)
+#define CACHE_VERSION	1
+// 캐시 항목 파일 확장자
+#define CACHE_ENTRY_SUFFIX	".cache"
+// 캐시 항목을 쓰는 중인 임시 파일 접두어
+#define CACHE_TEMP_PREFIX	".tmp."
+// 정리(eviction) 작업을 한 프로세스만 수행하도록 잠그는 파일 이름
+#define CACHE_LOCK_FILE	".lock"
+// 캐시 디렉토리 기본 최대 크기 (바이트)
+#define CACHE_DEFAULT_MAX_SIZE	(256LL * 1024 * 1024)
+// 이 시간(초)보다 오래된 임시 파일은 중단된 프로세스가 남긴 것으로 보고 삭제한다.
+#define CACHE_TEMP_EXPIRE_SEC	3600
+
+/**
+ * @struct cacheHeader_t
+ * @brief 캐시 항목 파일 앞에 놓이는 고정 크기 헤더 구조체
+ * <파일 구성>
+ * (cacheHeader_t) (등급 판단 결과 레코드, outputLength 바이트)
+ * <파일 이름>
+ * (입력 해시 16 자리)-(등급 테이블 해시 16 자리).cache
+ */
+typedef struct cacheHeader_s cacheHeader_t;
+struct cacheHeader_s
+{
+	// 식별 문자열 (CACHE_MAGIC)
+	char magic[4];
+	// 형식 버전 (CACHE_VERSION)
+	uint32_t version;
+	// 입력 파일 내용의 해시
+	uint64_t inputHash;
+	// 등급 테이블의 해시
+	uint64_t tableHash;
+	// 입력 파일 크기 (해시와 함께 일치 여부 판단에 사용)
+	uint64_t inputSize;
+	// 결과 레코드 길이
+	uint64_t outputLength;
+	// 등급별 레코드 개수
+	int64_t countList[GRADE_KIND_NUM];
+	// 전체 레코드 개수
+	int64_t total;
+	// 범위 안 점수의 합
+	int64_t sum;
+	// 범위 안 점수의 최소값
+	int32_t min;
+	// 범위 안 점수의 최대값
+	int32_t max;
+};
+
+/**
+ * @struct cacheManager_t
+ * @brief 입력 파일 내용과 등급 테이블의 해시로 등급 판단 결과를 저장하고 재사용하는 구조체
+ * 여러 프로세스가 같은 디렉토리를 동시에 사용해도 안전하도록 항목은 임시 파일에 쓴 뒤 rename 으로 교체하고,
+ * 크기 제한을 넘으면 잠금 파일을 잡은 프로세스 하나가 사용 시각(mtime)이 오래된 항목부터 삭제한다. (LRU)
+ */
+typedef struct cacheManager_s cacheManager_t;
+struct cacheManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 캐시 디렉토리 경로
+	char dir[PATH_MAX];
+	// 캐시 디렉토리 최대 크기 (바이트)
+	long long maxSize;
+	// 검증된 등급 테이블의 해시
+	uint64_t tableHash;
+	// 캐시 적중 횟수
+	long long hitNum;
+	// 캐시 실패 횟수
+	long long missNum;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for cacheManager_t
+//////////////////////////////////////////////////////////////////////////
+
+cacheManager_t* cacheManagerNew(const gradeManager_t *gradeManager, const char *dir, long long maxSize);
+void cacheManagerDelete(cacheManager_t **cacheManager);
+uint64_t cacheHash64(const void *data, size_t length, uint64_t seed);
+int cacheManagerLookup(cacheManager_t *cacheManager, uint64_t inputHash, uint64_t inputSize, int outputFd, gradeStats_t *stats);
+int cacheManagerStore(cacheManager_t *cacheManager, uint64_t inputHash, uint64_t inputSize, const char *output, size_t outputLength, const gradeStats_t *stats);
+int cacheManagerGradeFile(cacheManager_t *cacheManager, const char *inputFileName, const char *outputFileName, gradeStats_t *stats);
+
+#endif // #ifndef __CACHE_MANAGER_H__
@@ -0,0 +1,487 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "checkpointManager.h"
+#include "cacheManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for checkpoint_t
+//////////////////////////////////////////////////////////////////////////
+
+static int checkpointLoad(checkpoint_t *checkpoint, uint64_t configHash, int itemNum);
+static void checkpointReset(checkpoint_t *checkpoint, uint64_t configHash, int itemNum);
+static uint64_t checkpointGetChecksum(const checkpointHeader_t *header, const checkpointItem_t *itemList);
+static void checkpointSyncDir(const char *path);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for checkpoint_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn checkpoint_t* checkpointNew(const char *path, uint64_t configHash, int itemNum, const char *outputPath)
+ * @brief 체크포인트 객체를 만들고, 같은 설정으로 저장된 체크포인트가 있으면 그 상태를 불러오는 함수
+ * 체크포인트가 없거나 설정 해시, 항목 개수, checksum 이 맞지 않으면 처음 상태(모든 위치 0)로 시작한다.
+ * 결과 파일이 체크포인트의 결과 길이보다 짧으면 결과와 진행 상태가 어긋난 것이므로 역시 처음부터 시작한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터에 대한 NULL 체크를 수행한다.
+ * @param path 체크포인트 파일 경로(입력, 읽기 전용)
+ * @param configHash 작업 설정 해시(입력, checkpointHashConfig, checkpointHashFile 로 계산)
+ * @param itemNum 파일별 항목 개수(입력, 파일 하나를 처리하는 작업이면 0)
+ * @param outputPath 결과 파일 경로(입력, 읽기 전용, 결과 파일이 여러 개라 따로 확인하면 NULL)
+ * @return 성공 시 새로 생성된 checkpoint_t 구조체 객체, 실패 시 NULL 반환
+ */
+checkpoint_t* checkpointNew(const char *path, uint64_t configHash, int itemNum, const char *outputPath)
+{
+	if(path == NULL || itemNum < 0)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (path:%p, itemNum:%d)\n", (const void*)path, itemNum);
+		return NULL;
+	}
+
+	checkpoint_t *checkpoint = (checkpoint_t*)calloc(1, sizeof(checkpoint_t));
+	if(checkpoint == NULL)
+	{
+		printf("[DEBUG] checkpoint 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	if(snprintf(checkpoint->path, sizeof(checkpoint->path), "%s", path) >= (int)sizeof(checkpoint->path)
+		|| snprintf(checkpoint->tempPath, sizeof(checkpoint->tempPath), "%s%s", path, CHECKPOINT_TEMP_SUFFIX) >= (int)sizeof(checkpoint->tempPath))
+	{
+		printf("[ERROR] 체크포인트 파일 경로가 너무 김. (path:%s)\n", path);
+		free(checkpoint);
+		return NULL;
+	}
+
+	if(itemNum > 0)
+	{
+		checkpoint->itemList = (checkpointItem_t*)calloc((size_t)itemNum, sizeof(checkpointItem_t));
+		if(checkpoint->itemList == NULL)
+		{
+			printf("[DEBUG] 체크포인트 항목 목록 동적 생성 실패. NULL.\n");
+			free(checkpoint);
+			return NULL;
+		}
+	}
+
+	if(checkpointLoad(checkpoint, configHash, itemNum) == SUCCESS)
+	{
+		struct stat outputStat;
+		if(outputPath != NULL && (stat(outputPath, &outputStat) == -1 || (uint64_t)outputStat.st_size < checkpoint->header.outputLength))
+		{
+			printf("[체크포인트] 결과 파일이 체크포인트보다 짧아서 처음부터 처리. (path:%s, outputPath:%s)\n", checkpoint->path, outputPath);
+		}
+		else
+		{
+			checkpoint->resumed = TRUE;
+			checkpoint->savedOffset = checkpoint->header.inputOffset;
+			printf("[체크포인트] 이전 진행 상태에서 이어서 처리. (path:%s, inputOffset:%llu, outputLength:%llu)\n", checkpoint->path,
+				(unsigned long long)checkpoint->header.inputOffset, (unsigned long long)checkpoint->header.outputLength);
+			return checkpoint;
+		}
+	}
+
+	checkpointReset(checkpoint, configHash, itemNum);
+	return checkpoint;
+}
+
+/**
+ * @fn void checkpointDelete(checkpoint_t **checkpoint)
+ * @brief 생성된 checkpoint_t 구조체 객체의 메모리를 해제하는 함수 (체크포인트 파일은 그대로 둔다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param checkpoint 삭제할 checkpoint_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void checkpointDelete(checkpoint_t **checkpoint)
+{
+	if(checkpoint == NULL || *checkpoint == NULL)
+	{
+		printf("[DEBUG] checkpoint 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	free((*checkpoint)->itemList);
+	free(*checkpoint);
+	*checkpoint = NULL;
+}
+
+/**
+ * @fn uint64_t checkpointHashConfig(const gradeManager_t *gradeManager, const char *outputPath)
+ * @brief 등급 테이블과 출력 경로로 작업 설정 해시를 시작하는 함수 (입력 파일은 checkpointHashFile 로 이어서 섞는다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param outputPath 결과 파일 또는 결과 디렉토리 경로(입력, 읽기 전용)
+ * @return 설정 해시 반환 (매개변수가 NULL 이면 0)
+ */
+uint64_t checkpointHashConfig(const gradeManager_t *gradeManager, const char *outputPath)
+{
+	if(gradeManager == NULL || outputPath == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, outputPath:%p)\n", (const void*)gradeManager, (const void*)outputPath);
+		return 0;
+	}
+
+	int32_t table[GRADE_TABLE_LEN + 1];
+	table[0] = CHECKPOINT_VERSION;
+	gradeManagerGetTable(gradeManager, table + 1);
+
+	uint64_t hash = cacheHash64(table, sizeof(table), 0);
+	return cacheHash64(outputPath, strlen(outputPath), hash);
+}
+
+/**
+ * @fn uint64_t checkpointHashFile(const char *path, uint64_t seed)
+ * @brief 입력 파일의 경로, 크기, 수정 시각을 설정 해시에 섞는 함수
+ * 내용을 읽지 않고 메타데이터만 사용하므로 큰 파일도 바로 계산되고, 입력이 바뀌면 체크포인트를 버리게 된다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터에 대한 NULL 체크를 수행한다.
+ * @param path 입력 파일 경로(입력, 읽기 전용)
+ * @param seed 지금까지의 설정 해시(입력)
+ * @return 파일 정보를 섞은 설정 해시 반환 (파일 정보를 읽지 못하면 경로만 섞는다)
+ */
+uint64_t checkpointHashFile(const char *path, uint64_t seed)
+{
+	if(path == NULL)
+	{
+		printf("[DEBUG] 주어진 path 가 NULL.\n");
+		return seed;
+	}
+
+	uint64_t hash = cacheHash64(path, strlen(path), seed);
+
+	struct stat fileStat;
+	if(stat(path, &fileStat) == 0)
+	{
+		int64_t fileInfo[3] = { (int64_t)fileStat.st_size, (int64_t)fileStat.st_mtim.tv_sec, (int64_t)fileStat.st_mtim.tv_nsec };
+		hash = cacheHash64(fileInfo, sizeof(fileInfo), hash);
+	}
+
+	return hash;
+}
+
+/**
+ * @fn int checkpointOpenOutput(const checkpoint_t *checkpoint, const char *outputPath)
+ * @brief 결과 파일을 열고, 이어서 처리하는 경우 체크포인트의 결과 길이로 잘라서 그 뒤부터 쓰도록 위치를 옮기는 함수
+ * 체크포인트 뒤에 기록된 결과는 다시 계산하므로 잘라낸다. (결과 파일 길이는 checkpointNew 에서 이미 확인했다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param checkpoint 체크포인트 구조체(입력, 읽기 전용)
+ * @param outputPath 결과 파일 경로(입력, 읽기 전용)
+ * @return 성공 시 쓰기용 파일 디스크립터, 실패 시 -1 반환
+ */
+int checkpointOpenOutput(const checkpoint_t *checkpoint, const char *outputPath)
+{
+	if(checkpoint == NULL || outputPath == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (checkpoint:%p, outputPath:%p)\n", (const void*)checkpoint, (const void*)outputPath);
+		return -1;
+	}
+
+	int fd = open(outputPath, O_WRONLY | O_CREAT | ((checkpoint->resumed == TRUE) ? 0 : O_TRUNC), 0644);
+	if(fd == -1)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", outputPath, errno);
+		return -1;
+	}
+	if(checkpoint->resumed == FALSE) return fd;
+
+	struct stat fileStat;
+	off_t outputLength = (off_t)checkpoint->header.outputLength;
+	if(fstat(fd, &fileStat) == -1 || fileStat.st_size < outputLength)
+	{
+		printf("[ERROR] 결과 파일이 체크포인트보다 짧음. (fileName:%s, checkpoint:%lld)\n", outputPath, (long long)outputLength);
+		close(fd);
+		return -1;
+	}
+
+	if(ftruncate(fd, outputLength) == -1 || lseek(fd, outputLength, SEEK_SET) == -1)
+	{
+		printf("[ERROR] 결과 파일을 체크포인트 길이로 자르기 실패. (fileName:%s, errno:%d)\n", outputPath, errno);
+		close(fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+/**
+ * @fn int checkpointUpdate(checkpoint_t *checkpoint, int outputFd, uint64_t inputOffset, uint64_t outputLength, const gradeStats_t *stats)
+ * @brief 진행 상태를 갱신하고, 마지막 저장 뒤로 CHECKPOINT_INTERVAL_SIZE 이상 처리했으면 체크포인트를 저장하는 함수
+ * 저장하기 전에 결과 파일을 디스크에 내려서(fdatasync) 체크포인트가 가리키는 결과가 반드시 남아있게 한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param checkpoint 체크포인트 구조체(입력 및 출력)
+ * @param outputFd 결과 파일 디스크립터(입력, 결과 파일이 여러 개라 따로 관리하면 -1)
+ * @param inputOffset 처리를 마친 입력 위치(입력, 레코드 경계)
+ * @param outputLength 처리를 마친 입력까지의 결과 길이(입력)
+ * @param stats 처리를 마친 입력까지의 등급 통계(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 저장 실패 시 FAIL 반환
+ */
+int checkpointUpdate(checkpoint_t *checkpoint, int outputFd, uint64_t inputOffset, uint64_t outputLength, const gradeStats_t *stats)
+{
+	if(checkpoint == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (checkpoint:%p, stats:%p)\n", (void*)checkpoint, (const void*)stats);
+		return FAIL;
+	}
+
+	checkpoint->header.inputOffset = inputOffset;
+	checkpoint->header.outputLength = outputLength;
+	checkpointSetStats(&(checkpoint->header.stats), stats);
+
+	if(inputOffset - checkpoint->savedOffset < (uint64_t)CHECKPOINT_INTERVAL_SIZE) return SUCCESS;
+
+	if(outputFd != -1 && fdatasync(outputFd) == -1)
+	{
+		printf("[ERROR] 결과 파일 동기화 실패. (errno:%d)\n", errno);
+		return FAIL;
+	}
+
+	return checkpointSave(checkpoint);
+}
+
+/**
+ * @fn int checkpointSave(checkpoint_t *checkpoint)
+ * @brief 현재 진행 상태를 체크포인트 파일에 원자적으로 저장하는 함수
+ * 임시 파일에 모두 쓰고 fsync 한 뒤 rename 으로 교체하고, 교체가 남도록 디렉토리도 동기화한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param checkpoint 체크포인트 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int checkpointSave(checkpoint_t *checkpoint)
+{
+	if(checkpoint == NULL)
+	{
+		printf("[DEBUG] checkpoint 가 NULL.\n");
+		return FAIL;
+	}
+
+	if(checkpointWrite(checkpoint, &(checkpoint->header), checkpoint->itemList) == FAIL) return FAIL;
+
+	checkpoint->savedOffset = checkpoint->header.inputOffset;
+	checkpoint->saveNum++;
+	return SUCCESS;
+}
+
+/**
+ * @fn int checkpointWrite(const checkpoint_t *checkpoint, checkpointHeader_t *header, const checkpointItem_t *itemList)
+ * @brief 복사해 둔 진행 상태를 체크포인트 파일에 원자적으로 저장하는 함수
+ * 여러 스레드가 진행 상태를 바꾸는 작업에서 잠금 안에서 헤더와 항목 목록을 복사한 뒤 잠금 밖에서 저장할 때 사용한다.
+ * 체크포인트 객체의 경로만 사용하므로 savedOffset, saveNum 은 호출한 쪽이 관리한다. (checkpointSave 는 직접 갱신한다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param checkpoint 체크포인트 구조체(입력, 읽기 전용)
+ * @param header 저장할 헤더(입력 및 출력, checksum 을 채운다)
+ * @param itemList 저장할 항목 목록(입력, 읽기 전용, header->itemNum 이 0 이면 NULL)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int checkpointWrite(const checkpoint_t *checkpoint, checkpointHeader_t *header, const checkpointItem_t *itemList)
+{
+	if(checkpoint == NULL || header == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (checkpoint:%p, header:%p)\n", (const void*)checkpoint, (void*)header);
+		return FAIL;
+	}
+
+	header->checksum = checkpointGetChecksum(header, itemList);
+
+	int fd = open(checkpoint->tempPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(fd == -1)
+	{
+		printf("[ERROR] 체크포인트 임시 파일 열기 실패. (fileName:%s, errno:%d)\n", checkpoint->tempPath, errno);
+		return FAIL;
+	}
+
+	int result = recordBufferWriteAll(fd, (const char*)header, sizeof(checkpointHeader_t));
+	if(result == SUCCESS && header->itemNum > 0)
+	{
+		result = recordBufferWriteAll(fd, (const char*)itemList, sizeof(checkpointItem_t) * (size_t)header->itemNum);
+	}
+	if(result == SUCCESS && fsync(fd) == -1) result = FAIL;
+	if(close(fd) == -1) result = FAIL;
+	if(result == SUCCESS && rename(checkpoint->tempPath, checkpoint->path) == -1) result = FAIL;
+
+	if(result == FAIL)
+	{
+		printf("[ERROR] 체크포인트 저장 실패. (fileName:%s, errno:%d)\n", checkpoint->path, errno);
+		unlink(checkpoint->tempPath);
+		return FAIL;
+	}
+
+	checkpointSyncDir(checkpoint->path);
+	return SUCCESS;
+}
+
+/**
+ * @fn int checkpointRemove(checkpoint_t *checkpoint)
+ * @brief 작업이 끝난 뒤 체크포인트 파일을 지우는 함수 (다음 실행은 처음부터 처리한다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param checkpoint 체크포인트 구조체(입력, 읽기 전용)
+ * @return 성공 시(파일이 없던 경우 포함) SUCCESS, 실패 시 FAIL 반환
+ */
+int checkpointRemove(checkpoint_t *checkpoint)
+{
+	if(checkpoint == NULL)
+	{
+		printf("[DEBUG] checkpoint 가 NULL.\n");
+		return FAIL;
+	}
+
+	if(unlink(checkpoint->path) == -1 && errno != ENOENT)
+	{
+		printf("[ERROR] 체크포인트 파일 삭제 실패. (fileName:%s, errno:%d)\n", checkpoint->path, errno);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn void checkpointGetStats(const checkpointStats_t *checkpointStats, gradeStats_t *stats)
+ * @brief 체크포인트에 저장된 등급 통계를 gradeStats_t 로 옮기는 함수
+ * 내부 구조체만 다루므로 NULL 체크를 수행하지 않는다.
+ * @param checkpointStats 저장된 등급 통계(입력, 읽기 전용)
+ * @param stats 등급 통계(출력)
+ * @return 반환값 없음
+ */
+void checkpointGetStats(const checkpointStats_t *checkpointStats, gradeStats_t *stats)
+{
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		stats->count[gradeIndex] = checkpointStats->countList[gradeIndex];
+	}
+	stats->total = checkpointStats->total;
+	stats->sum = checkpointStats->sum;
+	stats->min = checkpointStats->min;
+	stats->max = checkpointStats->max;
+}
+
+/**
+ * @fn void checkpointSetStats(checkpointStats_t *checkpointStats, const gradeStats_t *stats)
+ * @brief gradeStats_t 등급 통계를 체크포인트에 저장할 고정 크기 형식으로 옮기는 함수
+ * 내부 구조체만 다루므로 NULL 체크를 수행하지 않는다.
+ * @param checkpointStats 저장할 등급 통계(출력)
+ * @param stats 등급 통계(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void checkpointSetStats(checkpointStats_t *checkpointStats, const gradeStats_t *stats)
+{
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		checkpointStats->countList[gradeIndex] = stats->count[gradeIndex];
+	}
+	checkpointStats->total = stats->total;
+	checkpointStats->sum = stats->sum;
+	checkpointStats->min = stats->min;
+	checkpointStats->max = stats->max;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for checkpoint_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int checkpointLoad(checkpoint_t *checkpoint, uint64_t configHash, int itemNum)
+ * @brief 체크포인트 파일을 읽어서 형식, 설정 해시, 항목 개수, checksum 이 모두 맞으면 진행 상태로 사용하는 함수
+ * checkpointNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param checkpoint 체크포인트 구조체(출력)
+ * @param configHash 현재 작업의 설정 해시(입력)
+ * @param itemNum 현재 작업의 파일별 항목 개수(입력)
+ * @return 이어서 처리할 수 있으면 SUCCESS, 체크포인트가 없거나 맞지 않으면 FAIL 반환
+ */
+static int checkpointLoad(checkpoint_t *checkpoint, uint64_t configHash, int itemNum)
+{
+	FILE *filePtr = fopen(checkpoint->path, "rb");
+	if(filePtr == NULL) return FAIL;
+
+	checkpointHeader_t *header = &(checkpoint->header);
+	int result = FAIL;
+	const char *reason = "형식이 맞지 않음";
+
+	if(fread(header, sizeof(checkpointHeader_t), 1, filePtr) == 1
+		&& memcmp(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic)) == 0
+		&& header->version == CHECKPOINT_VERSION)
+	{
+		if(header->configHash != configHash || header->itemNum != (uint64_t)itemNum)
+		{
+			reason = "입력, 등급 테이블 또는 출력이 바뀜";
+		}
+		else if((itemNum == 0 || fread(checkpoint->itemList, sizeof(checkpointItem_t), (size_t)itemNum, filePtr) == (size_t)itemNum)
+			&& header->checksum == checkpointGetChecksum(header, checkpoint->itemList))
+		{
+			result = SUCCESS;
+		}
+		else
+		{
+			reason = "내용이 깨짐";
+		}
+	}
+
+	fclose(filePtr);
+	if(result == FAIL)
+	{
+		printf("[체크포인트] 이전 체크포인트를 사용하지 않고 처음부터 처리. (path:%s, reason:%s)\n", checkpoint->path, reason);
+	}
+	return result;
+}
+
+/**
+ * @fn static void checkpointReset(checkpoint_t *checkpoint, uint64_t configHash, int itemNum)
+ * @brief 진행 상태를 처음 상태(모든 위치 0, 빈 통계, 완료한 파일 없음)로 되돌리는 함수
+ * checkpointNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param checkpoint 체크포인트 구조체(출력)
+ * @param configHash 작업 설정 해시(입력)
+ * @param itemNum 파일별 항목 개수(입력)
+ * @return 반환값 없음
+ */
+static void checkpointReset(checkpoint_t *checkpoint, uint64_t configHash, int itemNum)
+{
+	gradeStats_t stats;
+	gradeStatsInit(&stats);
+
+	memset(&(checkpoint->header), 0, sizeof(checkpoint->header));
+	memcpy(checkpoint->header.magic, CHECKPOINT_MAGIC, sizeof(checkpoint->header.magic));
+	checkpoint->header.version = CHECKPOINT_VERSION;
+	checkpoint->header.configHash = configHash;
+	checkpoint->header.itemNum = (uint64_t)itemNum;
+	checkpointSetStats(&(checkpoint->header.stats), &stats);
+
+	int itemIndex = 0;
+	for( ; itemIndex < itemNum; itemIndex++)
+	{
+		memset(&(checkpoint->itemList[itemIndex]), 0, sizeof(checkpointItem_t));
+		checkpointSetStats(&(checkpoint->itemList[itemIndex].stats), &stats);
+	}
+}
+
+/**
+ * @fn static uint64_t checkpointGetChecksum(const checkpointHeader_t *header, const checkpointItem_t *itemList)
+ * @brief checksum 필드 앞까지의 헤더와 항목 목록 전체의 해시를 계산하는 함수
+ * @param header 체크포인트 헤더(입력, 읽기 전용)
+ * @param itemList 파일별 항목 목록(입력, 읽기 전용, itemNum 이 0 이면 NULL)
+ * @return 해시 반환
+ */
+static uint64_t checkpointGetChecksum(const checkpointHeader_t *header, const checkpointItem_t *itemList)
+{
+	uint64_t hash = cacheHash64(header, offsetof(checkpointHeader_t, checksum), 0);
+	if(header->itemNum > 0) hash = cacheHash64(itemList, sizeof(checkpointItem_t) * (size_t)header->itemNum, hash);
+	return hash;
+}
+
+/**
+ * @fn static void checkpointSyncDir(const char *path)
+ * @brief 파일이 들어있는 디렉토리를 동기화해서 rename 결과가 디스크에 남게 하는 함수 (실패해도 무시한다)
+ * @param path 파일 경로(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void checkpointSyncDir(const char *path)
+{
+	char dirPath[PATH_MAX];
+	snprintf(dirPath, sizeof(dirPath), "%s", path);
+
+	int fd = open(dirname(dirPath), O_RDONLY | O_DIRECTORY);
+	if(fd == -1) return;
+	fsync(fd);
+	close(fd);
+}
@@ -0,0 +1,129 @@
+#ifndef __CHECKPOINT_MANAGER_H__
+#define __CHECKPOINT_MANAGER_H__
+
+#include <stdint.h>
+#include <limits.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 체크포인트 파일 식별 문자열
+#define CHECKPOINT_MAGIC		"GRCK"
+// 체크포인트 파일 형식 버전
+#define CHECKPOINT_VERSION		1
+// 결과 파일(또는 결과 디렉토리) 이름 뒤에 붙는 체크포인트 파일 확장자
+#define CHECKPOINT_SUFFIX		".checkpoint"
+// 체크포인트를 쓰는 중인 임시 파일 확장자
+#define CHECKPOINT_TEMP_SUFFIX	".tmp"
+// 이만큼 입력을 더 처리할 때마다 체크포인트를 쓴다. (바이트)
+#define CHECKPOINT_INTERVAL_SIZE	(64LL * 1024 * 1024)
+
+/**
+ * @struct checkpointStats_t
+ * @brief 체크포인트 파일에 저장하는 고정 크기 등급 통계 구조체 (gradeStats_t 와 같은 내용)
+ */
+typedef struct checkpointStats_s checkpointStats_t;
+struct checkpointStats_s
+{
+	// 등급별 레코드 개수
+	int64_t countList[GRADE_KIND_NUM];
+	// 전체 레코드 개수
+	int64_t total;
+	// 범위 안 점수의 합
+	int64_t sum;
+	// 범위 안 점수의 최소값
+	int32_t min;
+	// 범위 안 점수의 최대값
+	int32_t max;
+};
+
+/**
+ * @struct checkpointHeader_t
+ * @brief 체크포인트 파일 앞에 놓이는 고정 크기 헤더 구조체
+ * <파일 구성>
+ * (checkpointHeader_t) (checkpointItem_t itemNum 개)
+ * checksum 은 checksum 필드 앞까지의 헤더와 항목 목록 전체의 해시로, 내용이 깨진 파일은 사용하지 않는다.
+ */
+typedef struct checkpointHeader_s checkpointHeader_t;
+struct checkpointHeader_s
+{
+	// 식별 문자열 (CHECKPOINT_MAGIC)
+	char magic[4];
+	// 형식 버전 (CHECKPOINT_VERSION)
+	uint32_t version;
+	// 작업 설정 해시 (등급 테이블, 입력 파일의 경로/크기/수정 시각, 출력 경로)
+	uint64_t configHash;
+	// 처리를 마친 입력 위치 (압축을 푼 바이트, 레코드 경계)
+	uint64_t inputOffset;
+	// 처리를 마친 입력까지의 결과 파일 길이
+	uint64_t outputLength;
+	// 파일별 항목 개수 (파일 단위로 진행을 기록하는 경우)
+	uint64_t itemNum;
+	// 처리를 마친 입력까지의 등급 통계
+	checkpointStats_t stats;
+	// 헤더와 항목 목록의 해시
+	uint64_t checksum;
+};
+
+/**
+ * @struct checkpointItem_t
+ * @brief 여러 파일을 처리하는 작업에서 파일 하나의 완료 여부와 결과를 저장하는 구조체
+ */
+typedef struct checkpointItem_s checkpointItem_t;
+struct checkpointItem_s
+{
+	// 결과 파일 길이
+	uint64_t outputLength;
+	// 처리를 마쳤는지 여부 (TRUE 또는 FALSE)
+	int32_t done;
+	// 예약 (0)
+	int32_t reserved;
+	// 파일의 등급 통계
+	checkpointStats_t stats;
+};
+
+/**
+ * @struct checkpoint_t
+ * @brief 오래 걸리는 등급 판단 작업의 진행 상태를 주기적으로 저장하고, 다시 시작할 때 이어서 처리하게 하는 구조체
+ * 체크포인트는 임시 파일에 쓰고 fsync 한 뒤 rename 으로 교체하므로 중간에 죽어도 이전 체크포인트나 새 체크포인트 중 하나가 남는다.
+ * 설정 해시가 다르거나(입력, 등급 테이블, 출력이 바뀐 경우) 내용이 깨진 체크포인트는 버리고 처음부터 처리한다.
+ */
+typedef struct checkpoint_s checkpoint_t;
+struct checkpoint_s
+{
+	// 체크포인트 파일 경로
+	char path[PATH_MAX];
+	// 체크포인트를 쓰는 중인 임시 파일 경로
+	char tempPath[PATH_MAX];
+	// 현재 진행 상태 (저장할 내용)
+	checkpointHeader_t header;
+	// 파일별 항목 목록 (itemNum 이 0 이면 NULL)
+	checkpointItem_t *itemList;
+	// 마지막으로 저장한 입력 위치
+	uint64_t savedOffset;
+	// 이전 체크포인트에서 이어서 시작했는지 여부 (TRUE 또는 FALSE)
+	int resumed;
+	// 체크포인트를 저장한 횟수
+	long long saveNum;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for checkpoint_t
+//////////////////////////////////////////////////////////////////////////
+
+checkpoint_t* checkpointNew(const char *path, uint64_t configHash, int itemNum, const char *outputPath);
+void checkpointDelete(checkpoint_t **checkpoint);
+uint64_t checkpointHashConfig(const gradeManager_t *gradeManager, const char *outputPath);
+uint64_t checkpointHashFile(const char *path, uint64_t seed);
+int checkpointOpenOutput(const checkpoint_t *checkpoint, const char *outputPath);
+int checkpointUpdate(checkpoint_t *checkpoint, int outputFd, uint64_t inputOffset, uint64_t outputLength, const gradeStats_t *stats);
+int checkpointSave(checkpoint_t *checkpoint);
+int checkpointWrite(const checkpoint_t *checkpoint, checkpointHeader_t *header, const checkpointItem_t *itemList);
+int checkpointRemove(checkpoint_t *checkpoint);
+void checkpointGetStats(const checkpointStats_t *checkpointStats, gradeStats_t *stats);
+void checkpointSetStats(checkpointStats_t *checkpointStats, const gradeStats_t *stats);
+
+#endif // #ifndef __CHECKPOINT_MANAGER_H__
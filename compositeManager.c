@@ -0,0 +1,451 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "compositeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for compositeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static int compositeManagerLoadWeight(compositeManager_t *compositeManager, const char *fileName);
+static int compositeManagerSetBoundary(compositeManager_t *compositeManager);
+static int compositeManagerAllocateBlock(compositeManager_t *compositeManager);
+static void compositeManagerParseRecord(compositeManager_t *compositeManager, int row, const char *line, size_t length);
+static void compositeManagerGradeBlock(compositeManager_t *compositeManager, int rowNum);
+static int compositeManagerWriteBlock(const compositeManager_t *compositeManager, int rowNum, recordBuffer_t *output, gradeStats_t *stats);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for compositeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn compositeManager_t* compositeManagerNew(const gradeManager_t *gradeManager, const char *fileName)
+ * @brief ini 파일의 [Weight] 필드로 가중 합산 점수를 판단하는 compositeManager_t 객체를 새로 생성하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보와 ini 파일 내용을 가진 구조체(입력, 읽기 전용)
+ * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용, 메시지 출력용)
+ * @return 성공 시 새로 생성된 compositeManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+compositeManager_t* compositeManagerNew(const gradeManager_t *gradeManager, const char *fileName)
+{
+	if(gradeManager == NULL || fileName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, fileName:%p)\n", (const void*)gradeManager, (const void*)fileName);
+		return NULL;
+	}
+
+	compositeManager_t *compositeManager = (compositeManager_t*)calloc(1, sizeof(compositeManager_t));
+	if(compositeManager == NULL)
+	{
+		printf("[DEBUG] compositeManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	compositeManager->gradeManager = gradeManager;
+
+	if(compositeManagerLoadWeight(compositeManager, fileName) == FAIL
+		|| compositeManagerSetBoundary(compositeManager) == FAIL
+		|| compositeManagerAllocateBlock(compositeManager) == FAIL)
+	{
+		compositeManagerDelete(&compositeManager);
+		return NULL;
+	}
+
+	return compositeManager;
+}
+
+/**
+ * @fn void compositeManagerDelete(compositeManager_t **compositeManager)
+ * @brief 생성된 compositeManager_t 구조체 객체의 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param compositeManager 삭제할 compositeManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void compositeManagerDelete(compositeManager_t **compositeManager)
+{
+	if(compositeManager == NULL || *compositeManager == NULL)
+	{
+		printf("[DEBUG] compositeManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	compositeManager_t *manager = *compositeManager;
+	int column = 0;
+	for( ; column < COMPOSITE_MAX_COLUMN_NUM; column++)
+	{
+		free(manager->columnList[column]);
+	}
+	free(manager->numeratorList);
+	free(manager->invalidList);
+	free(manager->gradeList);
+	free(manager->lineList);
+	free(manager->lineLengthList);
+
+	free(manager);
+	*compositeManager = NULL;
+}
+
+/**
+ * @fn int compositeManagerGradeFile(compositeManager_t *compositeManager, const char *inputFileName, const char *outputFileName, gradeStats_t *stats)
+ * @brief 여러 열의 점수를 가진 레코드 파일을 블록 단위로 읽어 가중 합산 점수와 등급을 출력하는 함수
+ * <입력 레코드> (필드 ...) (항목1 점수) ... (항목N 점수) -> 마지막 N 개 토큰이 [Weight] 순서의 항목 점수
+ * <출력 레코드> (입력 레코드) (합산 점수) (등급) -> 항목을 읽을 수 없거나 범위를 벗어나면 합산 점수와 등급은 '?'
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param compositeManager 가중치 정보를 가진 구조체(입력 및 출력, 블록 버퍼 사용)
+ * @param inputFileName 입력 레코드 파일 이름(입력, 읽기 전용)
+ * @param outputFileName 결과 파일 이름(입력, 읽기 전용)
+ * @param stats 합산 점수의 등급 통계(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int compositeManagerGradeFile(compositeManager_t *compositeManager, const char *inputFileName, const char *outputFileName, gradeStats_t *stats)
+{
+	if(compositeManager == NULL || inputFileName == NULL || outputFileName == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (compositeManager:%p, inputFileName:%p, outputFileName:%p, stats:%p)\n", (void*)compositeManager, (const void*)inputFileName, (const void*)outputFileName, (void*)stats);
+		return FAIL;
+	}
+
+	int fd = open(inputFileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 입력 파일 열기 실패. (fileName:%s, errno:%d)\n", inputFileName, errno);
+		return FAIL;
+	}
+
+	struct stat fileStat;
+	char *data = NULL;
+	size_t size = 0;
+	if(fstat(fd, &fileStat) == 0) size = (size_t)fileStat.st_size;
+	if(size > 0)
+	{
+		void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapped == MAP_FAILED)
+		{
+			printf("[ERROR] 입력 파일 매핑 실패. (fileName:%s, errno:%d)\n", inputFileName, errno);
+			close(fd);
+			return FAIL;
+		}
+		madvise(mapped, size, MADV_SEQUENTIAL);
+		data = (char*)mapped;
+	}
+	close(fd);
+
+	int outputFd = open(outputFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	recordBuffer_t output;
+	if(outputFd == -1 || recordBufferInit(&output, 0) == FAIL)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", outputFileName, errno);
+		if(outputFd != -1) close(outputFd);
+		if(data != NULL) munmap(data, size);
+		return FAIL;
+	}
+
+	gradeStatsInit(stats);
+
+	int result = SUCCESS;
+	int rowNum = 0;
+	size_t pos = 0;
+	while(pos < size && result == SUCCESS)
+	{
+		const char *line = data + pos;
+		const char *newLine = (const char*)memchr(line, '\n', size - pos);
+		size_t lineLength = (newLine == NULL) ? (size - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		while(lineLength > 0 && (line[lineLength - 1] == '\r' || line[lineLength - 1] == ' ' || line[lineLength - 1] == '\t')) lineLength--;
+		if(lineLength == 0) continue;
+
+		compositeManagerParseRecord(compositeManager, rowNum, line, lineLength);
+		rowNum++;
+
+		if(rowNum == COMPOSITE_BLOCK_SIZE || pos >= size)
+		{
+			compositeManagerGradeBlock(compositeManager, rowNum);
+			result = compositeManagerWriteBlock(compositeManager, rowNum, &output, stats);
+			if(result == SUCCESS) result = recordBufferWriteAll(outputFd, output.data, output.length);
+			output.length = 0;
+			rowNum = 0;
+		}
+	}
+
+	// 마지막 줄이 빈 줄이라 남은 블록이 처리되지 않은 경우
+	if(rowNum > 0 && result == SUCCESS)
+	{
+		compositeManagerGradeBlock(compositeManager, rowNum);
+		result = compositeManagerWriteBlock(compositeManager, rowNum, &output, stats);
+		if(result == SUCCESS) result = recordBufferWriteAll(outputFd, output.data, output.length);
+	}
+
+	recordBufferFinal(&output);
+	if(close(outputFd) == -1) result = FAIL;
+	if(data != NULL) munmap(data, size);
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for compositeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int compositeManagerLoadWeight(compositeManager_t *compositeManager, const char *fileName)
+ * @brief ini 파일의 [Weight] 필드에서 항목 이름과 가중치를 읽는 함수
+ * 가중치는 0 이상이고, 소수점 아래 3 자리까지 쓸 수 있으며, 합이 0 보다 커야 한다.
+ * compositeManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 이름에 대한 NULL 체크를 수행하지 않는다.
+ * @param compositeManager 가중치를 저장할 구조체(출력)
+ * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용, 메시지 출력용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int compositeManagerLoadWeight(compositeManager_t *compositeManager, const char *fileName)
+{
+	const iniManager_t *iniManager = compositeManager->gradeManager->iniManager;
+	int columnNum = iniManagerGetKeyNum(iniManager, COMPOSITE_WEIGHT_FIELD);
+	if(columnNum <= 0 || columnNum > COMPOSITE_MAX_COLUMN_NUM)
+	{
+		printf("[ERROR] 가중치 필드가 없거나 항목 개수가 잘못됨. (fileName:%s, field:%s, columns:%d, max:%d)\n", fileName, COMPOSITE_WEIGHT_FIELD, columnNum, COMPOSITE_MAX_COLUMN_NUM);
+		return FAIL;
+	}
+
+	long long weightSum = 0;
+	int keyIndex = 0;
+	int column = 0;
+	printf("\n[가중치 로딩 중...]\n");
+	for( ; column < columnNum; keyIndex++)
+	{
+		const iniKey_t *key = iniManagerGetKeyByIndex(iniManager, COMPOSITE_WEIGHT_FIELD, keyIndex);
+		if(key == NULL) continue;
+
+		int weight = 0;
+		if(iniParseFixedPoint(key->valueText, strlen(key->valueText), COMPOSITE_WEIGHT_SCALE, &weight) == FAIL || weight < 0)
+		{
+			printf("[ERROR] 잘못된 가중치. (key:%s, value:%s)\n", key->name, key->valueText);
+			return FAIL;
+		}
+
+		snprintf(compositeManager->columnNameList[column], MAX_KEY_LEN, "%s", key->name);
+		compositeManager->weightList[column] = weight;
+		weightSum += weight;
+		printf("%s %s weight : %s\n", COMPOSITE_WEIGHT_FIELD, key->name, key->valueText);
+		column++;
+	}
+
+	if(weightSum <= 0 || weightSum > INT_MAX)
+	{
+		printf("[ERROR] 가중치 합이 0 이거나 너무 큼. (sum:%lld)\n", weightSum);
+		return FAIL;
+	}
+
+	compositeManager->columnNum = columnNum;
+	compositeManager->weightSum = (int)weightSum;
+	printf("[로딩 완료] (columns:%d)\n\n", columnNum);
+	return SUCCESS;
+}
+
+/**
+ * @fn static int compositeManagerSetBoundary(compositeManager_t *compositeManager)
+ * @brief 등급 경계값에 가중치 합을 곱한 정수 경계값을 계산하는 함수
+ * 합산 점수 round(N / W) 가 [min, max] 에 포함되는 조건은 (2 * min - 1) * W <= 2 * N < (2 * max + 1) * W 이므로
+ * 레코드마다 나눗셈 없이 정수 비교만으로 판단할 수 있다. (N : 가중 합 분자, W : 가중치 합, 반올림은 0.5 올림)
+ * 모든 항목 점수는 등급 전체 범위 안으로 제한하므로, 전체 범위에서 32 비트 정수가 넘치지 않는지 미리 검사한다.
+ * compositeManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param compositeManager 경계값을 저장할 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 범위가 넘치면 FAIL 반환
+ */
+static int compositeManagerSetBoundary(compositeManager_t *compositeManager)
+{
+	const gradeManager_t *gradeManager = compositeManager->gradeManager;
+	const gradeInfo_t *gradeInfoList[4] = { &(gradeManager->gradeA), &(gradeManager->gradeB), &(gradeManager->gradeC), &(gradeManager->gradeD) };
+	long long weightSum = compositeManager->weightSum;
+	long long maxAbs = llabs((long long)gradeManager->totalMin);
+	if(llabs((long long)gradeManager->totalMax) > maxAbs) maxAbs = llabs((long long)gradeManager->totalMax);
+
+	if((2 * maxAbs + 1) * weightSum > INT_MAX)
+	{
+		printf("[ERROR] 점수 범위와 가중치 합이 너무 커서 정수로 계산할 수 없음. (maxAbs:%lld, weightSum:%lld)\n", maxAbs, weightSum);
+		return FAIL;
+	}
+
+	int gradeIndex = 0;
+	for( ; gradeIndex < 4; gradeIndex++)
+	{
+		compositeManager->lowerList[gradeIndex] = (int)((2LL * gradeInfoList[gradeIndex]->min - 1) * weightSum);
+		compositeManager->upperList[gradeIndex] = (int)((2LL * gradeInfoList[gradeIndex]->max + 1) * weightSum);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int compositeManagerAllocateBlock(compositeManager_t *compositeManager)
+ * @brief 블록 단위 처리에 사용할 열 배열들과 레코드별 배열들을 할당하는 함수
+ * compositeManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param compositeManager 블록 버퍼를 저장할 구조체(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int compositeManagerAllocateBlock(compositeManager_t *compositeManager)
+{
+	int column = 0;
+	for( ; column < compositeManager->columnNum; column++)
+	{
+		compositeManager->columnList[column] = (int*)malloc(sizeof(int) * COMPOSITE_BLOCK_SIZE);
+		if(compositeManager->columnList[column] == NULL) break;
+	}
+
+	compositeManager->numeratorList = (int*)malloc(sizeof(int) * COMPOSITE_BLOCK_SIZE);
+	compositeManager->invalidList = (unsigned char*)malloc(COMPOSITE_BLOCK_SIZE);
+	compositeManager->gradeList = (char*)malloc(COMPOSITE_BLOCK_SIZE);
+	compositeManager->lineList = (const char**)malloc(sizeof(const char*) * COMPOSITE_BLOCK_SIZE);
+	compositeManager->lineLengthList = (size_t*)malloc(sizeof(size_t) * COMPOSITE_BLOCK_SIZE);
+
+	if(column < compositeManager->columnNum || compositeManager->numeratorList == NULL || compositeManager->invalidList == NULL
+		|| compositeManager->gradeList == NULL || compositeManager->lineList == NULL || compositeManager->lineLengthList == NULL)
+	{
+		printf("[DEBUG] 블록 버퍼 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void compositeManagerParseRecord(compositeManager_t *compositeManager, int row, const char *line, size_t length)
+ * @brief 레코드 한 줄의 마지막 항목 점수들을 뒤에서부터 읽어 블록의 열 배열에 저장하는 함수
+ * 항목이 모자라거나 숫자가 아니면 해당 레코드를 오류로 표시하고, 열 값은 범위 안의 값으로 채운다.
+ * @param compositeManager 블록 버퍼를 가진 구조체(입력 및 출력)
+ * @param row 블록 안에서의 레코드 위치(입력)
+ * @param line 레코드 문자열(입력, 읽기 전용)
+ * @param length 레코드 문자열 길이(입력, 끝 공백 제외)
+ * @return 반환값 없음
+ */
+static void compositeManagerParseRecord(compositeManager_t *compositeManager, int row, const char *line, size_t length)
+{
+	const gradeManager_t *gradeManager = compositeManager->gradeManager;
+	size_t end = length;
+	int column = compositeManager->columnNum - 1;
+	unsigned char invalid = 0;
+
+	compositeManager->lineList[row] = line;
+	compositeManager->lineLengthList[row] = length;
+
+	for( ; column >= 0; column--)
+	{
+		while(end > 0 && (line[end - 1] == ' ' || line[end - 1] == '\t')) end--;
+		size_t begin = end;
+		while(begin > 0 && line[begin - 1] != ' ' && line[begin - 1] != '\t') begin--;
+
+		int score = gradeManager->totalMin;
+		if(begin == end || gradeManagerParseScore(gradeManager, line + begin, end - begin, &score) == FAIL)
+		{
+			invalid = 1;
+			score = gradeManager->totalMin;
+		}
+
+		compositeManager->columnList[column][row] = score;
+		end = begin;
+	}
+
+	compositeManager->invalidList[row] = invalid;
+}
+
+/**
+ * @fn static void compositeManagerGradeBlock(compositeManager_t *compositeManager, int rowNum)
+ * @brief 블록의 열 배열들로 가중 합 분자를 계산하고 같은 블록 안에서 바로 등급을 판단하는 함수
+ * 열마다 레코드 방향으로 곱셈-덧셈을 누적하고(SoA), 등급 판단도 분기 없는 정수 비교이므로 두 반복문 모두 벡터화된다.
+ * 중간 결과(분자)는 캐시에 남아 있는 블록 크기 배열에만 저장하고 파일 전체 크기의 배열은 만들지 않는다.
+ * @param compositeManager 블록 버퍼를 가진 구조체(입력 및 출력)
+ * @param rowNum 블록의 레코드 개수(입력)
+ * @return 반환값 없음
+ */
+static void compositeManagerGradeBlock(compositeManager_t *compositeManager, int rowNum)
+{
+	const int totalMin = compositeManager->gradeManager->totalMin;
+	const int totalMax = compositeManager->gradeManager->totalMax;
+	int *numeratorList = compositeManager->numeratorList;
+	unsigned char *invalidList = compositeManager->invalidList;
+	char *gradeList = compositeManager->gradeList;
+	int row = 0;
+	int column = 0;
+
+	for(row = 0; row < rowNum; row++)
+	{
+		numeratorList[row] = 0;
+	}
+
+	for( ; column < compositeManager->columnNum; column++)
+	{
+		const int weight = compositeManager->weightList[column];
+		const int *scoreList = compositeManager->columnList[column];
+		for(row = 0; row < rowNum; row++)
+		{
+			int score = scoreList[row];
+			invalidList[row] |= (unsigned char)((score < totalMin) | (score > totalMax));
+			score = (score < totalMin) ? totalMin : score;
+			score = (score > totalMax) ? totalMax : score;
+			numeratorList[row] += weight * score;
+		}
+	}
+
+	const int lowerA = compositeManager->lowerList[0], upperA = compositeManager->upperList[0];
+	const int lowerB = compositeManager->lowerList[1], upperB = compositeManager->upperList[1];
+	const int lowerC = compositeManager->lowerList[2], upperC = compositeManager->upperList[2];
+	const int lowerD = compositeManager->lowerList[3], upperD = compositeManager->upperList[3];
+	for(row = 0; row < rowNum; row++)
+	{
+		int twice = 2 * numeratorList[row];
+		char grade = 'F';
+		grade = (twice >= lowerD && twice < upperD) ? 'D' : grade;
+		grade = (twice >= lowerC && twice < upperC) ? 'C' : grade;
+		grade = (twice >= lowerB && twice < upperB) ? 'B' : grade;
+		grade = (twice >= lowerA && twice < upperA) ? 'A' : grade;
+		gradeList[row] = (invalidList[row] != 0) ? '?' : grade;
+	}
+}
+
+/**
+ * @fn static int compositeManagerWriteBlock(const compositeManager_t *compositeManager, int rowNum, recordBuffer_t *output, gradeStats_t *stats)
+ * @brief 블록의 각 레코드 뒤에 반올림한 합산 점수와 등급을 붙여 출력 버퍼에 쓰고 통계에 누적하는 함수
+ * @param compositeManager 블록 버퍼를 가진 구조체(입력, 읽기 전용)
+ * @param rowNum 블록의 레코드 개수(입력)
+ * @param output 출력 버퍼(출력)
+ * @param stats 등급 통계(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int compositeManagerWriteBlock(const compositeManager_t *compositeManager, int rowNum, recordBuffer_t *output, gradeStats_t *stats)
+{
+	const long long twiceWeightSum = 2LL * compositeManager->weightSum;
+	char suffix[GRADE_SCORE_TEXT_LEN + 4];
+	int row = 0;
+
+	for( ; row < rowNum; row++)
+	{
+		char grade = compositeManager->gradeList[row];
+		int suffixLength = 0;
+		int composite = 0;
+
+		suffix[suffixLength++] = ' ';
+		if(grade == '?')
+		{
+			suffix[suffixLength++] = '?';
+		}
+		else
+		{
+			// floor((2N + W) / 2W) : 0.5 올림 반올림 (분자가 음수여도 같은 규칙)
+			long long dividend = 2LL * compositeManager->numeratorList[row] + compositeManager->weightSum;
+			long long quotient = dividend / twiceWeightSum;
+			if(dividend % twiceWeightSum != 0 && dividend < 0) quotient--;
+			composite = (int)quotient;
+			suffixLength += gradeManagerFormatScore(compositeManager->gradeManager, composite, suffix + suffixLength, GRADE_SCORE_TEXT_LEN);
+		}
+		suffix[suffixLength++] = ' ';
+		suffix[suffixLength++] = grade;
+		suffix[suffixLength++] = '\n';
+
+		gradeStatsAdd(stats, composite, grade);
+		if(recordBufferAppend(output, compositeManager->lineList[row], compositeManager->lineLengthList[row]) == FAIL) return FAIL;
+		if(recordBufferAppend(output, suffix, (size_t)suffixLength) == FAIL) return FAIL;
+	}
+
+	return SUCCESS;
+}
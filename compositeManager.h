@@ -0,0 +1,67 @@
+#ifndef __COMPOSITE_MANAGER_H__
+#define __COMPOSITE_MANAGER_H__
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 가중치를 정의하는 ini 필드 이름
+#define COMPOSITE_WEIGHT_FIELD	"[Weight]"
+// 평가 항목(열) 최대 개수
+#define COMPOSITE_MAX_COLUMN_NUM	16
+// 가중치 고정 소수점 배율 (소수점 아래 3 자리)
+#define COMPOSITE_WEIGHT_SCALE	1000
+// 한 번에 처리하는 레코드 블록 크기 (블록의 열 배열들이 캐시에 남도록 정한 값)
+#define COMPOSITE_BLOCK_SIZE	2048
+
+/**
+ * @struct compositeManager_t
+ * @brief 여러 평가 항목(중간, 기말, 과제 등)의 가중 합산 점수로 등급을 판단하는 구조체
+ * <ini 파일 구성>
+ * [Weight]
+ * (항목 이름)=(가중치) -> 입력 레코드의 마지막 열들과 같은 순서
+ * 합산 점수는 sum(가중치 * 점수) / sum(가중치) 를 점수 배율 단위로 반올림한 값이며,
+ * 나눗셈 없이 판단하기 위해 등급 경계값에 가중치 합을 곱해 두고 분자(2 배)와 비교한다.
+ */
+typedef struct compositeManager_s compositeManager_t;
+struct compositeManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 평가 항목 개수
+	int columnNum;
+	// 평가 항목 이름 목록
+	char columnNameList[COMPOSITE_MAX_COLUMN_NUM][MAX_KEY_LEN];
+	// 평가 항목별 가중치 (COMPOSITE_WEIGHT_SCALE 배)
+	int weightList[COMPOSITE_MAX_COLUMN_NUM];
+	// 가중치 합
+	int weightSum;
+	// 등급별 하한 (2 * 분자가 이 값 이상이면 해당 등급, A ~ D 순서)
+	int lowerList[4];
+	// 등급별 상한 (2 * 분자가 이 값 미만이면 해당 등급, A ~ D 순서)
+	int upperList[4];
+	// 열 방향(SoA)으로 저장한 블록 점수 배열 (열마다 COMPOSITE_BLOCK_SIZE 개)
+	int *columnList[COMPOSITE_MAX_COLUMN_NUM];
+	// 블록 레코드별 가중 합 분자
+	int *numeratorList;
+	// 블록 레코드별 오류 여부 (읽을 수 없거나 범위를 벗어난 항목이 있으면 0 이 아님)
+	unsigned char *invalidList;
+	// 블록 레코드별 판단된 등급
+	char *gradeList;
+	// 블록 레코드별 원본 줄 시작 위치
+	const char **lineList;
+	// 블록 레코드별 원본 줄 길이
+	size_t *lineLengthList;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for compositeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+compositeManager_t* compositeManagerNew(const gradeManager_t *gradeManager, const char *fileName);
+void compositeManagerDelete(compositeManager_t **compositeManager);
+int compositeManagerGradeFile(compositeManager_t *compositeManager, const char *inputFileName, const char *outputFileName, gradeStats_t *stats);
+
+#endif // #ifndef __COMPOSITE_MANAGER_H__
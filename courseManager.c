@@ -0,0 +1,413 @@
+#include <dirent.h>
+#include <errno.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "courseManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for courseManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static int courseManagerScanDir(courseManager_t *courseManager);
+static int courseManagerAddSlot(courseManager_t *courseManager, const char *fileName, int *capacity);
+static int courseManagerLoadAll(courseManager_t *courseManager);
+static void* courseManagerWorkerThread(void *data);
+static void courseManagerLoadSlot(const courseManager_t *courseManager, courseSlot_t *slot);
+static int courseManagerBuildTable(courseManager_t *courseManager);
+static int compareCourseName(const void *course1, const void *course2);
+static int compareCourseErrorName(const void *error1, const void *error2);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for courseManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn courseManager_t* courseManagerNew(const char *dirPath, int threadNum)
+ * @brief 디렉토리의 과목별 ini 파일들을 여러 스레드로 로딩해서 과목 표를 만드는 함수
+ * 일부 파일이 잘못되어도 나머지 파일은 계속 로딩하고, 실패한 파일은 오류 목록에 남긴다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터에 대한 NULL 체크를 수행한다.
+ * @param dirPath 과목별 ini 파일 디렉토리(입력, 읽기 전용)
+ * @param threadNum 작업 스레드 개수(입력, 0 이하면 온라인 CPU 개수 사용)
+ * @return 성공 시 새로 생성된 courseManager_t 구조체 객체, 디렉토리를 읽지 못하면 NULL 반환
+ */
+courseManager_t* courseManagerNew(const char *dirPath, int threadNum)
+{
+	if(dirPath == NULL)
+	{
+		printf("[DEBUG] 주어진 dirPath 가 NULL.\n");
+		return NULL;
+	}
+
+	courseManager_t *courseManager = (courseManager_t*)calloc(1, sizeof(courseManager_t));
+	if(courseManager == NULL)
+	{
+		printf("[DEBUG] courseManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	if(threadNum <= 0) threadNum = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(threadNum <= 0) threadNum = 1;
+	if(threadNum > COURSE_MAX_THREAD_NUM) threadNum = COURSE_MAX_THREAD_NUM;
+	courseManager->threadNum = threadNum;
+	courseManager->schemeManager = schemeManagerNew();
+	if(courseManager->schemeManager == NULL)
+	{
+		courseManagerDelete(&courseManager);
+		return NULL;
+	}
+	snprintf(courseManager->dirPath, sizeof(courseManager->dirPath), "%s", dirPath);
+
+	struct timespec startTime, endTime;
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	if(courseManagerScanDir(courseManager) == FAIL
+		|| courseManagerLoadAll(courseManager) == FAIL
+		|| courseManagerBuildTable(courseManager) == FAIL)
+	{
+		courseManagerDelete(&courseManager);
+		return NULL;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	courseManager->elapsedSec = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+	return courseManager;
+}
+
+/**
+ * @fn void courseManagerDelete(courseManager_t **courseManager)
+ * @brief 생성된 courseManager_t 구조체 객체를 해제하고 과목들이 공유하던 등급 정보의 참조를 놓는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param courseManager 삭제할 courseManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void courseManagerDelete(courseManager_t **courseManager)
+{
+	if(courseManager == NULL || *courseManager == NULL)
+	{
+		printf("[DEBUG] courseManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	courseManager_t *manager = *courseManager;
+	int index = 0;
+
+	// 표를 만들기 전에 실패한 경우에는 등급 정보가 아직 파일별 결과 목록에 있다.
+	if(manager->slotList != NULL)
+	{
+		for( ; index < manager->fileNum; index++)
+		{
+			if(manager->slotList[index].gradeManager != NULL) schemeManagerRelease(manager->schemeManager, manager->slotList[index].gradeManager);
+		}
+		free(manager->slotList);
+	}
+
+	if(manager->courseList != NULL)
+	{
+		for(index = 0; index < manager->courseNum; index++)
+		{
+			schemeManagerRelease(manager->schemeManager, manager->courseList[index].gradeManager);
+		}
+		free(manager->courseList);
+	}
+
+	if(manager->schemeManager != NULL) schemeManagerDelete(&(manager->schemeManager));
+
+	free(manager->errorList);
+	free(manager);
+	*courseManager = NULL;
+}
+
+/**
+ * @fn const gradeManager_t* courseManagerFind(const courseManager_t *courseManager, const char *courseName)
+ * @brief 과목 이름으로 과목의 등급 정보를 찾는 함수
+ * 과목 목록은 정렬된 뒤 바뀌지 않으므로 이진 탐색하고, 여러 스레드가 동시에 호출해도 된다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param courseManager 과목 표를 가진 구조체(입력, 읽기 전용)
+ * @param courseName 찾을 과목 이름(입력, 읽기 전용)
+ * @return 성공 시 과목의 등급 정보, 없으면 NULL 반환
+ */
+const gradeManager_t* courseManagerFind(const courseManager_t *courseManager, const char *courseName)
+{
+	if(courseManager == NULL || courseName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (courseManager:%p, courseName:%p)\n", (const void*)courseManager, (const void*)courseName);
+		return NULL;
+	}
+
+	if(courseManager->courseNum == 0) return NULL;
+
+	course_t key;
+	snprintf(key.name, sizeof(key.name), "%s", courseName);
+	const course_t *course = (const course_t*)bsearch(&key, courseManager->courseList, (size_t)courseManager->courseNum, sizeof(course_t), compareCourseName);
+	return (course != NULL) ? course->gradeManager : NULL;
+}
+
+/**
+ * @fn void courseManagerPrintSummary(FILE *filePtr, const courseManager_t *courseManager)
+ * @brief 로딩 결과 요약과 실패한 파일별 오류 메시지를 출력하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param filePtr 출력할 파일(입력)
+ * @param courseManager 과목 표를 가진 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void courseManagerPrintSummary(FILE *filePtr, const courseManager_t *courseManager)
+{
+	if(filePtr == NULL || courseManager == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (filePtr:%p, courseManager:%p)\n", (void*)filePtr, (const void*)courseManager);
+		return;
+	}
+
+	fprintf(filePtr, "[과목 로딩] (dir:%s, files:%d, loaded:%d, failed:%d, schemes:%d, threads:%d, elapsed:%.3fs)\n", courseManager->dirPath,
+		courseManager->fileNum, courseManager->courseNum, courseManager->errorNum, courseManager->schemeManager->schemeNum,
+		courseManager->threadNum, courseManager->elapsedSec);
+
+	int errorIndex = 0;
+	for( ; errorIndex < courseManager->errorNum; errorIndex++)
+	{
+		const courseError_t *error = &(courseManager->errorList[errorIndex]);
+		fprintf(filePtr, "[로딩 실패] %s : %s\n", error->name, error->message);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for courseManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int courseManagerScanDir(courseManager_t *courseManager)
+ * @brief 디렉토리에서 COURSE_INI_SUFFIX 로 끝나는 일반 파일을 찾아 파일별 결과 목록을 만드는 함수
+ * courseManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param courseManager 과목 표를 만드는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int courseManagerScanDir(courseManager_t *courseManager)
+{
+	DIR *dir = opendir(courseManager->dirPath);
+	if(dir == NULL)
+	{
+		printf("[ERROR] 디렉토리 열기 실패. (dirPath:%s, errno:%d)\n", courseManager->dirPath, errno);
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	int capacity = 0;
+	size_t suffixLength = strlen(COURSE_INI_SUFFIX);
+	struct dirent *entry = NULL;
+	while((entry = readdir(dir)) != NULL)
+	{
+		size_t nameLength = strlen(entry->d_name);
+		if(entry->d_name[0] == '.' || nameLength <= suffixLength) continue;
+		if(strcmp(entry->d_name + nameLength - suffixLength, COURSE_INI_SUFFIX) != 0) continue;
+
+		char path[PATH_MAX];
+		struct stat fileStat;
+		if(snprintf(path, sizeof(path), "%s/%s", courseManager->dirPath, entry->d_name) >= (int)sizeof(path)) continue;
+		if(stat(path, &fileStat) == -1 || S_ISREG(fileStat.st_mode) == 0) continue;
+
+		if(courseManagerAddSlot(courseManager, entry->d_name, &capacity) == FAIL)
+		{
+			result = FAIL;
+			break;
+		}
+	}
+
+	closedir(dir);
+	return result;
+}
+
+/**
+ * @fn static int courseManagerAddSlot(courseManager_t *courseManager, const char *fileName, int *capacity)
+ * @brief 파일별 결과 목록에 ini 파일 하나를 추가하는 함수, 목록이 모자라면 두 배로 늘린다.
+ * courseManagerScanDir 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param courseManager 과목 표를 만드는 구조체(입력 및 출력)
+ * @param fileName 디렉토리 안의 ini 파일 이름(입력, 읽기 전용)
+ * @param capacity 파일별 결과 목록의 크기(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int courseManagerAddSlot(courseManager_t *courseManager, const char *fileName, int *capacity)
+{
+	if(courseManager->fileNum == *capacity)
+	{
+		int newCapacity = (*capacity == 0) ? 64 : *capacity * 2;
+		courseSlot_t *newSlotList = (courseSlot_t*)realloc(courseManager->slotList, sizeof(courseSlot_t) * (size_t)newCapacity);
+		if(newSlotList == NULL)
+		{
+			printf("[DEBUG] slotList 크기 확장 실패. NULL. (capacity:%d)\n", newCapacity);
+			return FAIL;
+		}
+		courseManager->slotList = newSlotList;
+		*capacity = newCapacity;
+	}
+
+	courseSlot_t *slot = &(courseManager->slotList[courseManager->fileNum]);
+	memset(slot, 0, sizeof(courseSlot_t));
+	snprintf(slot->name, sizeof(slot->name), "%.*s", (int)(strlen(fileName) - strlen(COURSE_INI_SUFFIX)), fileName);
+	courseManager->fileNum++;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int courseManagerLoadAll(courseManager_t *courseManager)
+ * @brief 작업 스레드들이 다음 파일 번호를 받아 로딩하는 것을 파일이 남지 않을 때까지 반복하게 하는 함수
+ * courseManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param courseManager 과목 표를 만드는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 스레드를 하나도 만들지 못하면 FAIL 반환
+ */
+static int courseManagerLoadAll(courseManager_t *courseManager)
+{
+	if(courseManager->threadNum > courseManager->fileNum) courseManager->threadNum = (courseManager->fileNum > 0) ? courseManager->fileNum : 1;
+
+	pthread_t threadList[COURSE_MAX_THREAD_NUM];
+	int createdNum = 0;
+	int threadIndex = 0;
+	for( ; threadIndex < courseManager->threadNum; threadIndex++)
+	{
+		if(pthread_create(&(threadList[threadIndex]), NULL, courseManagerWorkerThread, courseManager) != 0)
+		{
+			printf("[ERROR] 작업 스레드 생성 실패. (threadIndex:%d)\n", threadIndex);
+			break;
+		}
+		createdNum++;
+	}
+
+	for(threadIndex = 0; threadIndex < createdNum; threadIndex++)
+	{
+		pthread_join(threadList[threadIndex], NULL);
+	}
+
+	// 일부 스레드만 만들어진 경우에도 만들어진 스레드들이 남은 파일을 모두 로딩한다.
+	return (createdNum > 0) ? SUCCESS : FAIL;
+}
+
+/**
+ * @fn static void* courseManagerWorkerThread(void *data)
+ * @brief 다음 파일 번호를 원자적으로 받아 로딩하는 작업 스레드 함수
+ * @param data 과목 표를 만드는 구조체(courseManager_t)
+ * @return 항상 NULL 반환
+ */
+static void* courseManagerWorkerThread(void *data)
+{
+	courseManager_t *courseManager = (courseManager_t*)data;
+
+	while(1)
+	{
+		int fileIndex = __atomic_fetch_add(&(courseManager->nextFile), 1, __ATOMIC_RELAXED);
+		if(fileIndex >= courseManager->fileNum) break;
+
+		courseManagerLoadSlot(courseManager, &(courseManager->slotList[fileIndex]));
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static void courseManagerLoadSlot(const courseManager_t *courseManager, courseSlot_t *slot)
+ * @brief ini 파일 하나를 gradeManagerNew 로 읽고 검증한 뒤 등급 테이블 공유 목록에 등록하는 함수
+ * 로딩하는 동안 이 스레드의 로그는 출력하지 않고 모아서, 실패하면 첫 오류 메시지를 파일별 결과에 남긴다.
+ * 같은 등급 테이블이 이미 등록되어 있으면 방금 읽은 객체는 바로 해제되므로 과목 수가 많아도 메모리는 테이블 종류만큼만 쓴다.
+ * courseManagerWorkerThread 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param courseManager 과목 표를 만드는 구조체(입력, 읽기 전용)
+ * @param slot 파일별 결과(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void courseManagerLoadSlot(const courseManager_t *courseManager, courseSlot_t *slot)
+{
+	char path[PATH_MAX];
+	if(snprintf(path, sizeof(path), "%s/%s%s", courseManager->dirPath, slot->name, COURSE_INI_SUFFIX) >= (int)sizeof(path))
+	{
+		snprintf(slot->message, sizeof(slot->message), "[ERROR] 파일 경로가 너무 김.");
+		return;
+	}
+
+	logCaptureBegin(slot->message, sizeof(slot->message));
+	gradeManager_t *gradeManager = gradeManagerNew(path);
+	logCaptureEnd();
+
+	if(gradeManager == NULL)
+	{
+		if(slot->message[0] == '\0') snprintf(slot->message, sizeof(slot->message), "[ERROR] 등급 정보 로딩 실패.");
+		return;
+	}
+
+	slot->gradeManager = schemeManagerIntern(courseManager->schemeManager, &gradeManager);
+	if(slot->gradeManager == NULL) snprintf(slot->message, sizeof(slot->message), "[ERROR] 등급 테이블 등록 실패.");
+}
+
+/**
+ * @fn static int courseManagerBuildTable(courseManager_t *courseManager)
+ * @brief 파일별 결과를 로딩한 과목 목록과 실패 목록으로 나누고 이름 순으로 정렬하는 함수
+ * courseManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param courseManager 과목 표를 만드는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int courseManagerBuildTable(courseManager_t *courseManager)
+{
+	int slotIndex = 0;
+	int courseNum = 0;
+	for( ; slotIndex < courseManager->fileNum; slotIndex++)
+	{
+		if(courseManager->slotList[slotIndex].gradeManager != NULL) courseNum++;
+	}
+	int errorNum = courseManager->fileNum - courseNum;
+
+	courseManager->courseList = (course_t*)calloc((size_t)courseNum + 1, sizeof(course_t));
+	courseManager->errorList = (courseError_t*)calloc((size_t)errorNum + 1, sizeof(courseError_t));
+	if(courseManager->courseList == NULL || courseManager->errorList == NULL)
+	{
+		printf("[DEBUG] 과목 목록 동적 생성 실패. NULL. (courses:%d, errors:%d)\n", courseNum, errorNum);
+		return FAIL;
+	}
+
+	for(slotIndex = 0; slotIndex < courseManager->fileNum; slotIndex++)
+	{
+		courseSlot_t *slot = &(courseManager->slotList[slotIndex]);
+		if(slot->gradeManager != NULL)
+		{
+			course_t *course = &(courseManager->courseList[courseManager->courseNum++]);
+			memcpy(course->name, slot->name, sizeof(course->name));
+			course->gradeManager = slot->gradeManager;
+			slot->gradeManager = NULL;
+		}
+		else
+		{
+			courseError_t *error = &(courseManager->errorList[courseManager->errorNum++]);
+			memcpy(error->name, slot->name, sizeof(error->name));
+			memcpy(error->message, slot->message, sizeof(error->message));
+		}
+	}
+
+	free(courseManager->slotList);
+	courseManager->slotList = NULL;
+
+	qsort(courseManager->courseList, (size_t)courseManager->courseNum, sizeof(course_t), compareCourseName);
+	qsort(courseManager->errorList, (size_t)courseManager->errorNum, sizeof(courseError_t), compareCourseErrorName);
+	return SUCCESS;
+}
+
+/**
+ * @fn static int compareCourseName(const void *course1, const void *course2)
+ * @brief qsort, bsearch 에서 과목을 이름 순으로 정렬하기 위한 비교 함수
+ * @param course1 비교할 첫 번째 과목(입력, 읽기 전용)
+ * @param course2 비교할 두 번째 과목(입력, 읽기 전용)
+ * @return 이름의 strcmp 결과 반환
+ */
+static int compareCourseName(const void *course1, const void *course2)
+{
+	return strcmp(((const course_t*)course1)->name, ((const course_t*)course2)->name);
+}
+
+/**
+ * @fn static int compareCourseErrorName(const void *error1, const void *error2)
+ * @brief qsort 에서 실패 목록을 과목 이름 순으로 정렬하기 위한 비교 함수
+ * @param error1 비교할 첫 번째 실패 항목(입력, 읽기 전용)
+ * @param error2 비교할 두 번째 실패 항목(입력, 읽기 전용)
+ * @return 이름의 strcmp 결과 반환
+ */
+static int compareCourseErrorName(const void *error1, const void *error2)
+{
+	return strcmp(((const courseError_t*)error1)->name, ((const courseError_t*)error2)->name);
+}
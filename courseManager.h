@@ -0,0 +1,106 @@
+#ifndef __COURSE_MANAGER_H__
+#define __COURSE_MANAGER_H__
+
+#include <pthread.h>
+#include <limits.h>
+
+#include "schemeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 과목 ini 파일 확장자 (파일 이름에서 확장자를 뺀 부분이 과목 이름)
+#define COURSE_INI_SUFFIX		".ini"
+// 과목 이름 최대 길이 (디렉토리 항목 이름 최대 길이)
+#define COURSE_NAME_LEN			(NAME_MAX + 1)
+// 파일별 오류 메시지 최대 길이
+#define COURSE_ERROR_LEN		LOG_MESSAGE_LEN
+// 작업 스레드 최대 개수
+#define COURSE_MAX_THREAD_NUM	64
+
+/**
+ * @struct course_t
+ * @brief 과목 이름과 과목의 등급 정보를 저장하는 구조체
+ */
+typedef struct course_s course_t;
+struct course_s
+{
+	// 과목 이름
+	char name[COURSE_NAME_LEN];
+	// 과목의 등급 정보 (같은 등급 테이블을 가진 과목들이 공유하는 읽기 전용 객체)
+	const gradeManager_t *gradeManager;
+};
+
+/**
+ * @struct courseError_t
+ * @brief 로딩에 실패한 ini 파일과 첫 오류 메시지를 저장하는 구조체
+ */
+typedef struct courseError_s courseError_t;
+struct courseError_s
+{
+	// 과목 이름
+	char name[COURSE_NAME_LEN];
+	// 로딩 중 처음 발생한 오류 메시지
+	char message[COURSE_ERROR_LEN];
+};
+
+/**
+ * @struct courseSlot_t
+ * @brief 작업 스레드 하나가 ini 파일 하나를 로딩한 결과를 저장하는 구조체
+ */
+typedef struct courseSlot_s courseSlot_t;
+struct courseSlot_s
+{
+	// 과목 이름
+	char name[COURSE_NAME_LEN];
+	// 로딩해서 공유 목록에 등록한 등급 정보 (실패하면 NULL)
+	const gradeManager_t *gradeManager;
+	// 실패한 경우의 오류 메시지
+	char message[COURSE_ERROR_LEN];
+};
+
+/**
+ * @struct courseManager_t
+ * @brief 디렉토리에 있는 과목별 ini 파일들을 여러 스레드로 읽고 검증해서 과목 이름으로 찾을 수 있는 표로 만드는 구조체
+ * 파일마다 gradeManagerNew 와 같은 검증을 거치고, 진행 메시지는 출력하지 않으며 오류는 파일별로 모은다.
+ * 로딩이 끝나면 과목 목록은 이름 순으로 정렬된 뒤 바뀌지 않으므로 여러 스레드가 잠금 없이 찾을 수 있다.
+ * 등급 테이블이 같은 과목들은 schemeManager_t 에 등록된 등급 정보 하나를 공유한다.
+ */
+typedef struct courseManager_s courseManager_t;
+struct courseManager_s
+{
+	// ini 파일 디렉토리
+	char dirPath[PATH_MAX];
+	// 로딩한 과목 목록 (이름 순으로 정렬)
+	course_t *courseList;
+	// 로딩한 과목 개수
+	int courseNum;
+	// 로딩에 실패한 파일 목록 (이름 순으로 정렬)
+	courseError_t *errorList;
+	// 로딩에 실패한 파일 개수
+	int errorNum;
+	// 과목들이 공유하는 등급 테이블 목록
+	schemeManager_t *schemeManager;
+	// 로딩 중 파일별 결과 목록
+	courseSlot_t *slotList;
+	// ini 파일 개수
+	int fileNum;
+	// 다음에 로딩할 파일 번호 (원자적으로 증가)
+	int nextFile;
+	// 작업 스레드 개수
+	int threadNum;
+	// 로딩에 걸린 시간 (초)
+	double elapsedSec;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for courseManager_t
+//////////////////////////////////////////////////////////////////////////
+
+courseManager_t* courseManagerNew(const char *dirPath, int threadNum);
+void courseManagerDelete(courseManager_t **courseManager);
+const gradeManager_t* courseManagerFind(const courseManager_t *courseManager, const char *courseName);
+void courseManagerPrintSummary(FILE *filePtr, const courseManager_t *courseManager);
+
+#endif // #ifndef __COURSE_MANAGER_H__
@@ -0,0 +1,658 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <libgen.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "deltaManager.h"
+#include "cacheManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 출력 버퍼를 파일에 쓰는 기준 크기 (바이트)
+#define DELTA_FLUSH_SIZE	(1024 * 1024)
+// 해시 테이블 최소 크기
+#define DELTA_MIN_CAPACITY	16
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static char* deltaMapFile(const char *fileName, size_t *size);
+static int deltaManagerBuildTable(deltaManager_t *deltaManager);
+static int deltaManagerParsePrevious(const char *line, size_t length, deltaEntry_t *entry);
+static deltaEntry_t* deltaManagerFind(deltaManager_t *deltaManager, const char *id, size_t idLength, uint64_t hash);
+static size_t deltaGetToken(const char *line, size_t length, size_t *begin);
+static int deltaFlush(int fd, recordBuffer_t *buffer, size_t threshold);
+static uint64_t deltaHashTable(const gradeManager_t *gradeManager);
+static int deltaGetTablePath(const char *fileName, char *path, size_t size);
+static int deltaReadTableHash(const char *fileName, uint64_t *tableHash);
+static int deltaWriteTableHash(const char *path, uint64_t tableHash);
+static int deltaIsSameFile(const char *fileName1, const char *fileName2);
+static void deltaSyncDir(const char *path);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for deltaManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn deltaManager_t* deltaManagerNew(const gradeManager_t *gradeManager, const char *previousFileName)
+ * @brief 이전 결과 파일을 매핑하고 학번 해시 테이블(조인의 build 단계)을 만드는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param previousFileName 이전 결과 파일 이름(입력, 읽기 전용)
+ * @return 성공 시 새로 생성된 deltaManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+deltaManager_t* deltaManagerNew(const gradeManager_t *gradeManager, const char *previousFileName)
+{
+	if(gradeManager == NULL || previousFileName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, previousFileName:%p)\n", (const void*)gradeManager, (const void*)previousFileName);
+		return NULL;
+	}
+
+	deltaManager_t *deltaManager = (deltaManager_t*)calloc(1, sizeof(deltaManager_t));
+	if(deltaManager == NULL)
+	{
+		printf("[DEBUG] deltaManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	deltaManager->gradeManager = gradeManager;
+	deltaManager->previousData = deltaMapFile(previousFileName, &(deltaManager->previousSize));
+	if((deltaManager->previousData == NULL && deltaManager->previousSize > 0) || deltaManagerBuildTable(deltaManager) == FAIL)
+	{
+		deltaManagerDelete(&deltaManager);
+		return NULL;
+	}
+
+	// 이전 결과를 만든 등급 테이블을 알 수 없거나 다르면 이전 등급은 쓰지 않는다.
+	uint64_t previousHash = 0;
+	deltaManager->tableHash = deltaHashTable(gradeManager);
+	deltaManager->tableMatched = (deltaReadTableHash(previousFileName, &previousHash) == SUCCESS && previousHash == deltaManager->tableHash) ? TRUE : FALSE;
+	if(deltaManager->tableMatched == FALSE)
+	{
+		printf("[변경분 판단] 이전 결과의 등급 테이블 기록(%s%s)이 없거나 현재 등급 테이블과 달라서 모든 레코드를 다시 판단함.\n", previousFileName, DELTA_TABLE_SUFFIX);
+	}
+
+	return deltaManager;
+}
+
+/**
+ * @fn void deltaManagerDelete(deltaManager_t **deltaManager)
+ * @brief 생성된 deltaManager_t 구조체 객체의 매핑과 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param deltaManager 삭제할 deltaManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void deltaManagerDelete(deltaManager_t **deltaManager)
+{
+	if(deltaManager == NULL || *deltaManager == NULL)
+	{
+		printf("[DEBUG] deltaManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	if((*deltaManager)->previousData != NULL) munmap((*deltaManager)->previousData, (*deltaManager)->previousSize);
+	free((*deltaManager)->entryList);
+	free(*deltaManager);
+	*deltaManager = NULL;
+}
+
+/**
+ * @fn int deltaManagerRun(deltaManager_t *deltaManager, const char *inputFileName, const char *outputFileName, const char *changeFileName, gradeStats_t *stats)
+ * @brief 새 점수 파일의 레코드마다 학번으로 이전 결과를 찾아(조인의 probe 단계) 바뀐 레코드와 새 레코드만 등급을 판단하는 함수
+ * 이전 레코드와 내용이 같으면 이전 등급을 그대로 쓰고, 마지막에 찾지 못한 이전 레코드를 삭제된 레코드로 기록한다.
+ * 이전 결과의 등급 테이블이 다르면 내용이 같은 레코드도 다시 판단해서, 등급이 바뀐 레코드를 바뀐 레코드로 기록한다.
+ * 전체 결과와 변경 목록은 (파일 이름).tmp 에 쓰고 fsync 한 뒤, 병합을 마치고 입력과 이전 결과의 매핑을 해제한 다음 rename 으로 교체한다.
+ * 그래서 전체 결과 파일이 이전 결과 파일이나 새 점수 파일과 같아도 되고, 실패하면 이전 결과와 그 등급 테이블 기록이 그대로 남는다.
+ * 이전 결과의 매핑을 해제하므로 한 객체로 한 번만 호출할 수 있다.
+ * 성공하면 전체 결과를 만든 등급 테이블 해시를 (결과 파일).table 에 기록한다. (교체 전에 이전 기록을 지운다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param deltaManager 이전 결과 해시 테이블을 가진 구조체(입력 및 출력)
+ * @param inputFileName 새 점수 파일 이름(입력, 읽기 전용)
+ * @param outputFileName 갱신된 전체 결과 파일 이름(입력, 읽기 전용)
+ * @param changeFileName 변경 목록 파일 이름(입력, 읽기 전용)
+ * @param stats 전체 결과의 등급 통계(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int deltaManagerRun(deltaManager_t *deltaManager, const char *inputFileName, const char *outputFileName, const char *changeFileName, gradeStats_t *stats)
+{
+	if(deltaManager == NULL || inputFileName == NULL || outputFileName == NULL || changeFileName == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (deltaManager:%p, inputFileName:%p, outputFileName:%p, changeFileName:%p, stats:%p)\n",
+			(void*)deltaManager, (const void*)inputFileName, (const void*)outputFileName, (const void*)changeFileName, (void*)stats);
+		return FAIL;
+	}
+
+	if(deltaManager->entryList == NULL)
+	{
+		printf("[DEBUG] 이미 실행한 deltaManager.\n");
+		return FAIL;
+	}
+
+	char tablePath[PATH_MAX], outputTempPath[PATH_MAX], changeTempPath[PATH_MAX];
+	if(deltaGetTablePath(outputFileName, tablePath, sizeof(tablePath)) == FAIL
+		|| snprintf(outputTempPath, sizeof(outputTempPath), "%s%s", outputFileName, DELTA_TEMP_SUFFIX) >= (int)sizeof(outputTempPath)
+		|| snprintf(changeTempPath, sizeof(changeTempPath), "%s%s", changeFileName, DELTA_TEMP_SUFFIX) >= (int)sizeof(changeTempPath))
+	{
+		printf("[ERROR] 결과 파일 경로가 너무 김. (output:%s, change:%s)\n", outputFileName, changeFileName);
+		return FAIL;
+	}
+
+	if(deltaIsSameFile(outputFileName, changeFileName) == TRUE)
+	{
+		printf("[ERROR] 전체 결과 파일과 변경 목록 파일이 같음. (output:%s, change:%s)\n", outputFileName, changeFileName);
+		return FAIL;
+	}
+
+	size_t size = 0;
+	char *data = deltaMapFile(inputFileName, &size);
+	if(data == NULL && size > 0)
+	{
+		return FAIL;
+	}
+
+	int outputFd = open(outputTempPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	int changeFd = open(changeTempPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	recordBuffer_t output;
+	recordBuffer_t change;
+	int result = SUCCESS;
+
+	memset(&output, 0, sizeof(output));
+	memset(&change, 0, sizeof(change));
+	if(outputFd == -1 || changeFd == -1 || recordBufferInit(&output, DELTA_FLUSH_SIZE * 2) == FAIL || recordBufferInit(&change, DELTA_FLUSH_SIZE * 2) == FAIL)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (output:%s, change:%s, errno:%d)\n", outputFileName, changeFileName, errno);
+		result = FAIL;
+	}
+
+	const gradeManager_t *gradeManager = deltaManager->gradeManager;
+	deltaStats_t *deltaStats = &(deltaManager->deltaStats);
+	size_t pos = 0;
+	gradeStatsInit(stats);
+
+	while(pos < size && result == SUCCESS)
+	{
+		const char *line = data + pos;
+		const char *newLine = (const char*)memchr(line, '\n', size - pos);
+		size_t lineLength = (newLine == NULL) ? (size - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		size_t textLength = lineLength;
+		while(textLength > 0 && (line[textLength - 1] == ' ' || line[textLength - 1] == '\t' || line[textLength - 1] == '\r')) textLength--;
+		if(textLength == 0) continue;
+
+		size_t idBegin = 0;
+		size_t idLength = deltaGetToken(line, textLength, &idBegin);
+		uint64_t hash = cacheHash64(line + idBegin, idLength, 0);
+		deltaEntry_t *entry = deltaManagerFind(deltaManager, line + idBegin, idLength, hash);
+
+		int score = 0;
+		char grade = '?';
+		int sameRecord = (entry != NULL && entry->seen == FALSE && entry->bodyLength == textLength && memcmp(entry->line, line, textLength) == 0) ? TRUE : FALSE;
+		if(sameRecord == TRUE && deltaManager->tableMatched == TRUE)
+		{
+			// 이전 레코드와 같으므로 등급 판단 없이 이전 등급을 사용한다. (통계용 점수만 읽는다)
+			grade = entry->grade;
+			if(gradeManagerParseScore(gradeManager, entry->line + entry->scoreOffset, entry->scoreLength, &score) == FAIL) grade = '?';
+			deltaStats->unchangedNum++;
+		}
+		else
+		{
+			size_t scoreBegin = textLength;
+			while(scoreBegin > 0 && line[scoreBegin - 1] != ' ' && line[scoreBegin - 1] != '\t') scoreBegin--;
+			if(gradeManagerParseScore(gradeManager, line + scoreBegin, textLength - scoreBegin, &score) == SUCCESS)
+			{
+				grade = gradeManagerClassifyScore(gradeManager, score);
+			}
+
+			// 등급 테이블이 달라서 다시 판단한 레코드는 등급까지 같아야 바뀌지 않은 레코드다.
+			if(sameRecord == TRUE && grade == entry->grade)
+			{
+				deltaStats->unchangedNum++;
+			}
+			else
+			{
+				char header[2] = { (entry == NULL) ? DELTA_NEW : DELTA_CHANGED, ' ' };
+				result = recordBufferAppend(&change, header, sizeof(header));
+				if(result == SUCCESS) result = recordBufferAppend(&change, line + idBegin, idLength);
+				if(result == SUCCESS && entry != NULL)
+				{
+					result = recordBufferAppend(&change, " ", 1);
+					if(result == SUCCESS) result = recordBufferAppend(&change, entry->line + entry->scoreOffset, entry->scoreLength);
+				}
+				if(result == SUCCESS) result = recordBufferAppend(&change, " ", 1);
+				if(result == SUCCESS) result = recordBufferAppend(&change, line + scoreBegin, textLength - scoreBegin);
+				if(result == SUCCESS && entry != NULL)
+				{
+					char gradeText[2] = { ' ', entry->grade };
+					result = recordBufferAppend(&change, gradeText, sizeof(gradeText));
+				}
+				char suffix[3] = { ' ', grade, '\n' };
+				if(result == SUCCESS) result = recordBufferAppend(&change, suffix, sizeof(suffix));
+
+				if(entry == NULL) deltaStats->newNum++;
+				else deltaStats->changedNum++;
+			}
+		}
+
+		if(entry != NULL) entry->seen = TRUE;
+		gradeStatsAdd(stats, score, grade);
+
+		char suffix[3] = { ' ', grade, '\n' };
+		if(result == SUCCESS) result = recordBufferAppend(&output, line, textLength);
+		if(result == SUCCESS) result = recordBufferAppend(&output, suffix, sizeof(suffix));
+		if(result == SUCCESS) result = deltaFlush(outputFd, &output, DELTA_FLUSH_SIZE);
+		if(result == SUCCESS) result = deltaFlush(changeFd, &change, DELTA_FLUSH_SIZE);
+	}
+
+	// 새 점수 파일에서 찾지 못한 이전 레코드는 삭제된 레코드로 기록한다.
+	size_t entryIndex = 0;
+	for( ; entryIndex < deltaManager->entryCapacity && result == SUCCESS; entryIndex++)
+	{
+		const deltaEntry_t *entry = &(deltaManager->entryList[entryIndex]);
+		if(entry->line == NULL || entry->seen == TRUE) continue;
+
+		char header[2] = { DELTA_DELETED, ' ' };
+		char suffix[3] = { ' ', entry->grade, '\n' };
+		result = recordBufferAppend(&change, header, sizeof(header));
+		if(result == SUCCESS) result = recordBufferAppend(&change, entry->line + entry->idOffset, entry->idLength);
+		if(result == SUCCESS) result = recordBufferAppend(&change, " ", 1);
+		if(result == SUCCESS) result = recordBufferAppend(&change, entry->line + entry->scoreOffset, entry->scoreLength);
+		if(result == SUCCESS) result = recordBufferAppend(&change, suffix, sizeof(suffix));
+		if(result == SUCCESS) result = deltaFlush(changeFd, &change, DELTA_FLUSH_SIZE);
+		deltaStats->deletedNum++;
+	}
+
+	if(result == SUCCESS) result = deltaFlush(outputFd, &output, 0);
+	if(result == SUCCESS) result = deltaFlush(changeFd, &change, 0);
+	if(result == SUCCESS && (fsync(outputFd) == -1 || fsync(changeFd) == -1))
+	{
+		printf("[ERROR] 결과 파일 동기화 실패. (output:%s, change:%s, errno:%d)\n", outputTempPath, changeTempPath, errno);
+		result = FAIL;
+	}
+
+	recordBufferFinal(&output);
+	recordBufferFinal(&change);
+	if(outputFd != -1 && close(outputFd) == -1) result = FAIL;
+	if(changeFd != -1 && close(changeFd) == -1) result = FAIL;
+
+	// 결과 파일이 입력이나 이전 결과 자리에 들어가므로 교체하기 전에 매핑을 모두 해제한다.
+	if(data != NULL) munmap(data, size);
+	if(deltaManager->previousData != NULL) munmap(deltaManager->previousData, deltaManager->previousSize);
+	free(deltaManager->entryList);
+	deltaManager->previousData = NULL;
+	deltaManager->previousSize = 0;
+	deltaManager->entryList = NULL;
+	deltaManager->entryCapacity = 0;
+	deltaManager->entryNum = 0;
+
+	// 교체 도중에 멈춰도 새 결과가 이전 기록과 짝지어지지 않도록 기록을 먼저 지운다.
+	if(result == SUCCESS && unlink(tablePath) == -1 && errno != ENOENT)
+	{
+		printf("[ERROR] 등급 테이블 기록 파일 삭제 실패. (fileName:%s, errno:%d)\n", tablePath, errno);
+		result = FAIL;
+	}
+	if(result == SUCCESS && (rename(outputTempPath, outputFileName) == -1 || rename(changeTempPath, changeFileName) == -1))
+	{
+		printf("[ERROR] 결과 파일 이름 변경 실패. (output:%s, change:%s, errno:%d)\n", outputFileName, changeFileName, errno);
+		result = FAIL;
+	}
+
+	if(result == SUCCESS)
+	{
+		deltaSyncDir(outputFileName);
+		deltaSyncDir(changeFileName);
+		result = deltaWriteTableHash(tablePath, deltaManager->tableHash);
+	}
+	else
+	{
+		unlink(outputTempPath);
+		unlink(changeTempPath);
+	}
+
+	printf("[변경분 판단] (unchanged:%lld, changed:%lld, new:%lld, deleted:%lld, malformed:%lld)\n", deltaStats->unchangedNum,
+		deltaStats->changedNum, deltaStats->newNum, deltaStats->deletedNum, deltaStats->malformedNum);
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static char* deltaMapFile(const char *fileName, size_t *size)
+ * @brief 파일 전체를 읽기 전용으로 매핑하는 함수
+ * @param fileName 매핑할 파일 이름(입력, 읽기 전용)
+ * @param size 파일 크기(출력, 실패하면 1)
+ * @return 성공 시 매핑된 주소(빈 파일이면 NULL 이고 size 는 0), 실패 시 NULL 반환
+ */
+static char* deltaMapFile(const char *fileName, size_t *size)
+{
+	*size = 1;
+
+	int fd = open(fileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 파일 열기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		return NULL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1)
+	{
+		printf("[ERROR] 파일 정보 읽기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		close(fd);
+		return NULL;
+	}
+
+	*size = (size_t)fileStat.st_size;
+	if(*size == 0)
+	{
+		close(fd);
+		return NULL;
+	}
+
+	void *mapped = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(mapped == MAP_FAILED)
+	{
+		printf("[ERROR] 파일 매핑 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		*size = 1;
+		return NULL;
+	}
+
+	madvise(mapped, *size, MADV_SEQUENTIAL);
+	return (char*)mapped;
+}
+
+/**
+ * @fn static int deltaManagerBuildTable(deltaManager_t *deltaManager)
+ * @brief 이전 결과 레코드 개수의 두 배 이상인 해시 테이블을 만들고 레코드들을 학번으로 넣는 함수
+ * 같은 학번이 여러 번 나오면 처음 레코드만 사용한다.
+ * deltaManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param deltaManager 해시 테이블을 저장할 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int deltaManagerBuildTable(deltaManager_t *deltaManager)
+{
+	const char *data = deltaManager->previousData;
+	size_t size = deltaManager->previousSize;
+	size_t lineNum = 0;
+	size_t pos = 0;
+
+	while(pos < size)
+	{
+		const char *newLine = (const char*)memchr(data + pos, '\n', size - pos);
+		lineNum++;
+		if(newLine == NULL) break;
+		pos = (size_t)(newLine - data) + 1;
+	}
+
+	deltaManager->entryCapacity = DELTA_MIN_CAPACITY;
+	while(deltaManager->entryCapacity < lineNum * 2) deltaManager->entryCapacity *= 2;
+	deltaManager->entryList = (deltaEntry_t*)calloc(deltaManager->entryCapacity, sizeof(deltaEntry_t));
+	if(deltaManager->entryList == NULL)
+	{
+		printf("[DEBUG] 해시 테이블 동적 생성 실패. NULL. (capacity:%zu)\n", deltaManager->entryCapacity);
+		return FAIL;
+	}
+
+	for(pos = 0; pos < size; )
+	{
+		const char *line = data + pos;
+		const char *newLine = (const char*)memchr(line, '\n', size - pos);
+		size_t lineLength = (newLine == NULL) ? (size - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		while(lineLength > 0 && (line[lineLength - 1] == ' ' || line[lineLength - 1] == '\t' || line[lineLength - 1] == '\r')) lineLength--;
+		if(lineLength == 0) continue;
+
+		deltaEntry_t parsed;
+		if(deltaManagerParsePrevious(line, lineLength, &parsed) == FAIL)
+		{
+			deltaManager->deltaStats.malformedNum++;
+			continue;
+		}
+
+		size_t mask = deltaManager->entryCapacity - 1;
+		size_t slot = (size_t)parsed.hash & mask;
+		int duplicated = FALSE;
+		while(deltaManager->entryList[slot].line != NULL)
+		{
+			const deltaEntry_t *entry = &(deltaManager->entryList[slot]);
+			if(entry->hash == parsed.hash && entry->idLength == parsed.idLength && memcmp(entry->line + entry->idOffset, line + parsed.idOffset, parsed.idLength) == 0)
+			{
+				duplicated = TRUE;
+				break;
+			}
+			slot = (slot + 1) & mask;
+		}
+
+		if(duplicated == TRUE)
+		{
+			deltaManager->deltaStats.malformedNum++;
+			continue;
+		}
+
+		deltaManager->entryList[slot] = parsed;
+		deltaManager->entryNum++;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int deltaManagerParsePrevious(const char *line, size_t length, deltaEntry_t *entry)
+ * @brief 이전 결과 레코드 한 줄에서 학번(첫 토큰), 점수(끝에서 두 번째 토큰), 등급(마지막 토큰)의 위치를 찾는 함수
+ * @param line 이전 결과 레코드(입력, 읽기 전용, 끝 공백 제외)
+ * @param length 레코드 길이(입력)
+ * @param entry 찾은 위치를 저장할 항목(출력)
+ * @return 성공 시 SUCCESS, 형식이 맞지 않으면 FAIL 반환
+ */
+static int deltaManagerParsePrevious(const char *line, size_t length, deltaEntry_t *entry)
+{
+	if(length < 3 || length > UINT32_MAX || line[length - 2] != ' ' ) return FAIL;
+
+	size_t bodyLength = length - 2;
+	while(bodyLength > 0 && (line[bodyLength - 1] == ' ' || line[bodyLength - 1] == '\t')) bodyLength--;
+	if(bodyLength == 0) return FAIL;
+
+	size_t scoreBegin = bodyLength;
+	while(scoreBegin > 0 && line[scoreBegin - 1] != ' ' && line[scoreBegin - 1] != '\t') scoreBegin--;
+
+	size_t idBegin = 0;
+	size_t idLength = deltaGetToken(line, bodyLength, &idBegin);
+
+	entry->line = line;
+	entry->bodyLength = (uint32_t)bodyLength;
+	entry->idOffset = (uint32_t)idBegin;
+	entry->idLength = (uint32_t)idLength;
+	entry->scoreOffset = (uint32_t)scoreBegin;
+	entry->scoreLength = (uint32_t)(bodyLength - scoreBegin);
+	entry->grade = line[length - 1];
+	entry->seen = FALSE;
+	entry->hash = cacheHash64(line + idBegin, idLength, 0);
+	return SUCCESS;
+}
+
+/**
+ * @fn static deltaEntry_t* deltaManagerFind(deltaManager_t *deltaManager, const char *id, size_t idLength, uint64_t hash)
+ * @brief 해시 테이블에서 학번이 같은 이전 레코드를 찾는 함수
+ * @param deltaManager 해시 테이블을 가진 구조체(입력)
+ * @param id 찾을 학번(입력, 읽기 전용)
+ * @param idLength 학번 길이(입력)
+ * @param hash 학번의 해시(입력)
+ * @return 찾으면 해당 항목, 없으면 NULL 반환
+ */
+static deltaEntry_t* deltaManagerFind(deltaManager_t *deltaManager, const char *id, size_t idLength, uint64_t hash)
+{
+	size_t mask = deltaManager->entryCapacity - 1;
+	size_t slot = (size_t)hash & mask;
+
+	while(deltaManager->entryList[slot].line != NULL)
+	{
+		deltaEntry_t *entry = &(deltaManager->entryList[slot]);
+		if(entry->hash == hash && entry->idLength == idLength && memcmp(entry->line + entry->idOffset, id, idLength) == 0) return entry;
+		slot = (slot + 1) & mask;
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static size_t deltaGetToken(const char *line, size_t length, size_t *begin)
+ * @brief 레코드의 첫 토큰(학번) 위치와 길이를 찾는 함수
+ * @param line 레코드(입력, 읽기 전용)
+ * @param length 레코드 길이(입력)
+ * @param begin 첫 토큰 시작 위치(출력)
+ * @return 첫 토큰 길이 반환
+ */
+static size_t deltaGetToken(const char *line, size_t length, size_t *begin)
+{
+	size_t start = 0;
+	while(start < length && (line[start] == ' ' || line[start] == '\t')) start++;
+
+	size_t end = start;
+	while(end < length && line[end] != ' ' && line[end] != '\t') end++;
+
+	*begin = start;
+	return end - start;
+}
+
+/**
+ * @fn static int deltaFlush(int fd, recordBuffer_t *buffer, size_t threshold)
+ * @brief 출력 버퍼가 기준 크기 이상이면 파일에 쓰고 비우는 함수
+ * @param fd 기록할 파일 디스크립터(입력)
+ * @param buffer 출력 버퍼(입력 및 출력)
+ * @param threshold 기준 크기(입력, 0 이면 남은 내용을 모두 쓴다)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int deltaFlush(int fd, recordBuffer_t *buffer, size_t threshold)
+{
+	if(buffer->length == 0 || buffer->length < threshold) return SUCCESS;
+
+	int result = recordBufferWriteAll(fd, buffer->data, buffer->length);
+	buffer->length = 0;
+	return result;
+}
+
+/**
+ * @fn static uint64_t deltaHashTable(const gradeManager_t *gradeManager)
+ * @brief 검증된 등급 테이블(배율, 전체 범위, 등급별 범위)과 기록 형식 버전의 해시를 계산하는 함수
+ * cacheManager 와 같이 ini 파일의 주석이나 공백만 바뀐 경우에는 같은 해시가 나온다.
+ * @param gradeManager 검증된 등급 정보를 가진 구조체(입력, 읽기 전용)
+ * @return 항상 등급 테이블 해시값 반환
+ */
+static uint64_t deltaHashTable(const gradeManager_t *gradeManager)
+{
+	int32_t table[GRADE_TABLE_LEN + 1];
+
+	table[0] = DELTA_TABLE_VERSION;
+	gradeManagerGetTable(gradeManager, table + 1);
+
+	return cacheHash64(table, sizeof(table), 0);
+}
+
+/**
+ * @fn static int deltaGetTablePath(const char *fileName, char *path, size_t size)
+ * @brief 결과 파일의 등급 테이블 기록 파일 경로((결과 파일).table)를 만드는 함수
+ * @param fileName 결과 파일 이름(입력, 읽기 전용)
+ * @param path 기록 파일 경로(출력)
+ * @param size path 버퍼 크기(입력)
+ * @return 성공 시 SUCCESS, 경로가 너무 길면 FAIL 반환
+ */
+static int deltaGetTablePath(const char *fileName, char *path, size_t size)
+{
+	if(snprintf(path, size, "%s%s", fileName, DELTA_TABLE_SUFFIX) >= (int)size)
+	{
+		printf("[ERROR] 등급 테이블 기록 파일 경로가 너무 김. (fileName:%s)\n", fileName);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int deltaReadTableHash(const char *fileName, uint64_t *tableHash)
+ * @brief 결과 파일 옆의 기록 파일에서 결과를 만든 등급 테이블 해시를 읽는 함수
+ * batch, cached 등이 만든 결과처럼 기록 파일이 없으면 실패로 보고, 호출한 쪽에서 모든 레코드를 다시 판단한다.
+ * @param fileName 결과 파일 이름(입력, 읽기 전용)
+ * @param tableHash 읽은 등급 테이블 해시(출력)
+ * @return 성공 시 SUCCESS, 기록 파일이 없거나 형식이 맞지 않으면 FAIL 반환
+ */
+static int deltaReadTableHash(const char *fileName, uint64_t *tableHash)
+{
+	char path[PATH_MAX];
+	if(deltaGetTablePath(fileName, path, sizeof(path)) == FAIL) return FAIL;
+
+	FILE *filePtr = fopen(path, "r");
+	if(filePtr == NULL) return FAIL;
+
+	unsigned long long value = 0;
+	int result = (fscanf(filePtr, "%16llx", &value) == 1) ? SUCCESS : FAIL;
+	fclose(filePtr);
+
+	*tableHash = (uint64_t)value;
+	return result;
+}
+
+/**
+ * @fn static int deltaWriteTableHash(const char *path, uint64_t tableHash)
+ * @brief 결과 파일을 만든 등급 테이블 해시를 기록 파일에 쓰는 함수
+ * @param path 기록 파일 경로(입력, 읽기 전용)
+ * @param tableHash 등급 테이블 해시(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int deltaWriteTableHash(const char *path, uint64_t tableHash)
+{
+	FILE *filePtr = fopen(path, "w");
+	if(filePtr == NULL)
+	{
+		printf("[ERROR] 등급 테이블 기록 파일 쓰기 실패. (fileName:%s, errno:%d)\n", path, errno);
+		return FAIL;
+	}
+
+	int result = (fprintf(filePtr, "%016llx\n", (unsigned long long)tableHash) > 0) ? SUCCESS : FAIL;
+	if(fclose(filePtr) != 0) result = FAIL;
+	if(result == FAIL) printf("[ERROR] 등급 테이블 기록 파일 쓰기 실패. (fileName:%s)\n", path);
+
+	return result;
+}
+
+/**
+ * @fn static int deltaIsSameFile(const char *fileName1, const char *fileName2)
+ * @brief 두 경로가 같은 파일을 가리키는지 확인하는 함수 (아직 없는 파일은 경로 문자열로 비교한다)
+ * @param fileName1 첫 번째 파일 이름(입력, 읽기 전용)
+ * @param fileName2 두 번째 파일 이름(입력, 읽기 전용)
+ * @return 같은 파일이면 TRUE, 다르면 FALSE 반환
+ */
+static int deltaIsSameFile(const char *fileName1, const char *fileName2)
+{
+	if(strcmp(fileName1, fileName2) == 0) return TRUE;
+
+	struct stat fileStat1, fileStat2;
+	if(stat(fileName1, &fileStat1) == -1 || stat(fileName2, &fileStat2) == -1) return FALSE;
+	return (fileStat1.st_dev == fileStat2.st_dev && fileStat1.st_ino == fileStat2.st_ino) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static void deltaSyncDir(const char *path)
+ * @brief 파일이 들어있는 디렉토리를 동기화해서 rename 결과가 디스크에 남게 하는 함수 (실패해도 무시한다)
+ * @param path 파일 경로(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void deltaSyncDir(const char *path)
+{
+	char dirPath[PATH_MAX];
+	snprintf(dirPath, sizeof(dirPath), "%s", path);
+
+	int fd = open(dirname(dirPath), O_RDONLY | O_DIRECTORY);
+	if(fd == -1) return;
+	fsync(fd);
+	close(fd);
+}
@@ -0,0 +1,114 @@
+#ifndef __DELTA_MANAGER_H__
+#define __DELTA_MANAGER_H__
+
+#include <stdint.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 변경 목록의 레코드 종류 문자 (새 레코드, 바뀐 레코드, 없어진 레코드)
+#define DELTA_NEW		'N'
+#define DELTA_CHANGED	'C'
+#define DELTA_DELETED	'D'
+// 결과 파일을 만든 등급 테이블의 해시를 기록하는 파일 이름에 붙는 확장자 ((결과 파일).table)
+#define DELTA_TABLE_SUFFIX	".table"
+// 등급 테이블 해시 형식 버전 (해시에 함께 넣는다)
+#define DELTA_TABLE_VERSION	1
+// 전체 결과와 변경 목록을 쓰는 중인 임시 파일 이름에 붙는 확장자 (다 쓴 뒤 rename 으로 교체)
+#define DELTA_TEMP_SUFFIX	".tmp"
+
+/**
+ * @struct deltaEntry_t
+ * @brief 이전 결과의 레코드 하나를 학번으로 찾기 위한 해시 테이블 항목 구조체
+ * 문자열은 모두 매핑된 이전 결과 파일을 가리키며 복사하지 않는다.
+ */
+typedef struct deltaEntry_s deltaEntry_t;
+struct deltaEntry_s
+{
+	// 학번의 해시 (빈 항목 판단은 line 으로 한다)
+	uint64_t hash;
+	// 이전 레코드 시작 위치 (NULL 이면 빈 항목)
+	const char *line;
+	// 등급을 뺀 이전 레코드 길이 (새 점수 파일의 레코드와 비교하는 부분)
+	uint32_t bodyLength;
+	// 학번 시작 위치 (line 기준)
+	uint32_t idOffset;
+	// 학번 길이
+	uint32_t idLength;
+	// 이전 점수 토큰 시작 위치 (line 기준)
+	uint32_t scoreOffset;
+	// 이전 점수 토큰 길이
+	uint32_t scoreLength;
+	// 이전 등급
+	char grade;
+	// 새 점수 파일에서 같은 학번을 찾았는지 여부 (TRUE 또는 FALSE)
+	char seen;
+};
+
+/**
+ * @struct deltaStats_t
+ * @brief 변경분 등급 판단 결과의 레코드 종류별 개수를 저장하는 구조체
+ */
+typedef struct deltaStats_s deltaStats_t;
+struct deltaStats_s
+{
+	// 이전 결과와 같아서 등급을 그대로 사용한 레코드 개수
+	long long unchangedNum;
+	// 내용이 바뀌어 다시 판단한 레코드 개수
+	long long changedNum;
+	// 이전 결과에 없어서 새로 판단한 레코드 개수
+	long long newNum;
+	// 새 점수 파일에 없는 이전 레코드 개수
+	long long deletedNum;
+	// 형식이 맞지 않거나 학번이 중복되어 건너뛴 이전 결과 레코드 개수
+	long long malformedNum;
+};
+
+/**
+ * @struct deltaManager_t
+ * @brief 이전 결과(학번 ... 점수 등급)와 새 점수 파일을 학번으로 해시 조인해서 바뀐 레코드만 다시 판단하는 구조체
+ * <입력>
+ * 이전 결과 : batch, cached 등이 출력한 (레코드) (등급) 형식, 첫 토큰이 학번
+ * 새 점수 파일 : (학번) (필드 ...) (점수) 형식
+ * <출력>
+ * 전체 결과 : 새 점수 파일 순서의 (레코드) (등급), 바뀌지 않은 레코드는 이전 등급을 그대로 사용
+ * 변경 목록 : N (학번) (점수) (등급) / C (학번) (이전 점수) (새 점수) (이전 등급) (새 등급) / D (학번) (이전 점수) (이전 등급)
+ * 전체 결과를 쓸 때 등급 테이블 해시를 (결과 파일).table 에 남기고, 이전 결과의 해시가 없거나 현재 등급 테이블과 다르면
+ * 이전 등급을 믿지 않고 모든 레코드를 다시 판단한다. (등급만 바뀐 레코드는 변경 목록에 C 로 기록된다)
+ * 결과는 임시 파일에 쓴 뒤 rename 으로 교체하므로 전체 결과 파일을 이전 결과 파일 자리에 그대로 갱신할 수 있다.
+ */
+typedef struct deltaManager_s deltaManager_t;
+struct deltaManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 매핑된 이전 결과 파일 (deltaManagerRun 이 병합을 마치면 해제)
+	char *previousData;
+	// 이전 결과 파일 크기
+	size_t previousSize;
+	// 학번 해시 테이블 (개방 주소법, 선형 탐사)
+	deltaEntry_t *entryList;
+	// 해시 테이블 크기 (2 의 거듭제곱)
+	size_t entryCapacity;
+	// 해시 테이블에 들어있는 항목 개수
+	size_t entryNum;
+	// 레코드 종류별 개수
+	deltaStats_t deltaStats;
+	// 현재 등급 테이블 해시
+	uint64_t tableHash;
+	// 이전 결과가 현재 등급 테이블로 만들어졌는지 여부 (TRUE 일 때만 이전 등급을 그대로 사용)
+	int tableMatched;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for deltaManager_t
+//////////////////////////////////////////////////////////////////////////
+
+deltaManager_t* deltaManagerNew(const gradeManager_t *gradeManager, const char *previousFileName);
+void deltaManagerDelete(deltaManager_t **deltaManager);
+int deltaManagerRun(deltaManager_t *deltaManager, const char *inputFileName, const char *outputFileName, const char *changeFileName, gradeStats_t *stats);
+
+#endif // #ifndef __DELTA_MANAGER_H__
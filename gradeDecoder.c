@@ -0,0 +1,132 @@
+#include "packManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Macro
+//////////////////////////////////////////////////////////////////////////
+
+// 한 번에 복원할 등급 개수
+#define DECODE_BLOCK_SIZE	65536
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static void gradeDecoderPrintSummary(const packReader_t *reader);
+static int gradeDecoderPrintGrades(const packReader_t *reader);
+
+//////////////////////////////////////////////////////////////////////////
+/// Main Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int main(int argc, char **argv)
+ * @brief pack 으로 저장한 등급 결과 파일을 복원해서 출력하는 함수
+ * 사용법 : gradeDecode (등급 결과 파일) [-s]
+ * -s 를 지정하면 payload 를 읽지 않고 헤더와 꼬리의 분포 통계만 출력하고, 아니면 한 줄에 등급 하나씩 출력한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 0, 실패 시 1 반환
+ */
+int main(int argc, char **argv)
+{
+	if(argc < 2)
+	{
+		printf("Usage: %s <packFile> [-s]\n", argv[0]);
+		return 1;
+	}
+
+	packReader_t *reader = packReaderNew(argv[1]);
+	if(reader == NULL)
+	{
+		return 1;
+	}
+
+	int result = SUCCESS;
+	if(argc > 2 && strcmp(argv[2], "-s") == 0) gradeDecoderPrintSummary(reader);
+	else result = gradeDecoderPrintGrades(reader);
+
+	packReaderDelete(&reader);
+	return (result == SUCCESS) ? 0 : 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void gradeDecoderPrintSummary(const packReader_t *reader)
+ * @brief 등급 결과 파일의 형식 정보와 꼬리에 저장된 등급 분포를 출력하는 함수
+ * @param reader 등급 결과 파일을 가진 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void gradeDecoderPrintSummary(const packReader_t *reader)
+{
+	const packHeader_t *header = reader->header;
+	const packFooter_t *footer = reader->footer;
+	uint64_t validNum = 0;
+	uint32_t code = 0;
+
+	printf("file=%s size=%zu encoding=%s bitWidth=%u records=%llu payload=%llu\n", reader->fileName, reader->size,
+		packGetEncodingName(header->encoding), header->bitWidth, (unsigned long long)header->recordNum, (unsigned long long)header->payloadSize);
+
+	for( ; code < header->dictNum; code++)
+	{
+		printf("%c=%llu ", header->dictList[code], (unsigned long long)footer->countList[code]);
+		if(header->dictList[code] != '?') validNum += footer->countList[code];
+	}
+
+	if(validNum > 0 && footer->scale > 0)
+	{
+		printf("min=%g max=%g avg=%.2f\n", (double)footer->scoreMin / footer->scale, (double)footer->scoreMax / footer->scale,
+			(double)footer->scoreSum / (double)validNum / footer->scale);
+	}
+	else
+	{
+		printf("\n");
+	}
+}
+
+/**
+ * @fn static int gradeDecoderPrintGrades(const packReader_t *reader)
+ * @brief 등급 결과 파일의 모든 등급을 블록 단위로 복원해서 한 줄에 하나씩 표준 출력으로 쓰는 함수
+ * @param reader 등급 결과 파일을 가진 구조체(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int gradeDecoderPrintGrades(const packReader_t *reader)
+{
+	char *gradeList = (char*)malloc(DECODE_BLOCK_SIZE);
+	char *lineList = (char*)malloc(DECODE_BLOCK_SIZE * 2);
+	if(gradeList == NULL || lineList == NULL)
+	{
+		printf("[DEBUG] 복원 버퍼 동적 생성 실패. NULL.\n");
+		free(gradeList);
+		free(lineList);
+		return FAIL;
+	}
+
+	packCursor_t cursor;
+	packCursorInit(&cursor);
+
+	int result = SUCCESS;
+	int num = 0;
+	while((num = packReaderDecode(reader, &cursor, gradeList, DECODE_BLOCK_SIZE)) > 0)
+	{
+		int gradePos = 0;
+		for( ; gradePos < num; gradePos++)
+		{
+			lineList[gradePos * 2] = gradeList[gradePos];
+			lineList[gradePos * 2 + 1] = '\n';
+		}
+
+		if(fwrite(lineList, 2, (size_t)num, stdout) != (size_t)num)
+		{
+			result = FAIL;
+			break;
+		}
+	}
+	if(num == FAIL) result = FAIL;
+
+	free(gradeList);
+	free(lineList);
+	return result;
+}
@@ -0,0 +1,160 @@
+#include "gradeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Macro
+//////////////////////////////////////////////////////////////////////////
+
+// 조회 테이블로 만들 수 있는 등급 전체 범위의 최대 크기 (이보다 크면 비교문으로 생성)
+#define GRADE_TABLE_LOOKUP_MAX	65536
+// 조회 테이블 한 줄에 출력할 등급 문자 개수
+#define GRADE_TABLE_LINE_NUM	16
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static int gradeGeneratorWriteHeader(const gradeManager_t *gradeManager, const char *iniFileName, FILE *filePtr);
+static void gradeGeneratorWriteGradeInfo(FILE *filePtr, const gradeInfo_t *gradeInfo);
+
+//////////////////////////////////////////////////////////////////////////
+/// Main Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int main(int argc, char **argv)
+ * @brief ini 파일의 등급 정보를 컴파일 시간 상수와 static inline 분류 함수로 담은 C 헤더 파일을 생성하는 함수
+ * 사용법 : gradeGen (ini 파일) (출력 헤더 파일)
+ * ini 파일은 gradeManagerNew 로 읽기 때문에 실행 시간 경로와 같은 검증을 거친다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 0, 실패 시 1 반환
+ */
+int main(int argc, char **argv)
+{
+	if(argc < 3)
+	{
+		printf("Usage: %s <grade.ini> <gradeTable.h>\n", argv[0]);
+		return 1;
+	}
+
+	gradeManager_t *gradeManager = gradeManagerNew(argv[1]);
+	if(gradeManager == NULL)
+	{
+		return 1;
+	}
+
+	FILE *filePtr = fopen(argv[2], "w");
+	if(filePtr == NULL)
+	{
+		printf("[ERROR] 헤더 파일 쓰기 실패. (fileName:%s)\n", argv[2]);
+		gradeManagerDelete(&gradeManager);
+		return 1;
+	}
+
+	int result = gradeGeneratorWriteHeader(gradeManager, argv[1], filePtr);
+	if(fclose(filePtr) != 0) result = FAIL;
+	gradeManagerDelete(&gradeManager);
+
+	if(result == FAIL)
+	{
+		printf("[ERROR] 헤더 파일 생성 실패. (fileName:%s)\n", argv[2]);
+		remove(argv[2]);
+		return 1;
+	}
+
+	printf("[헤더 파일 생성 완료] (%s -> %s)\n", argv[1], argv[2]);
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int gradeGeneratorWriteHeader(const gradeManager_t *gradeManager, const char *iniFileName, FILE *filePtr)
+ * @brief 등급 정보를 헤더 파일 내용으로 출력하는 함수
+ * 등급 전체 범위가 GRADE_TABLE_LOOKUP_MAX 이하면 범위 전체에 대한 등급 조회 테이블을, 아니면 상수 비교문을 생성한다.
+ * 조회 테이블 내용은 gradeManagerClassifyScore 로 채우므로 실행 시간 경로와 결과가 같다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param iniFileName 등급 정보를 읽은 ini 파일 이름(입력, 읽기 전용)
+ * @param filePtr 헤더 내용을 출력할 파일 스트림(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int gradeGeneratorWriteHeader(const gradeManager_t *gradeManager, const char *iniFileName, FILE *filePtr)
+{
+	long long domainSize = (long long)gradeManager->totalMax - (long long)gradeManager->totalMin + 1;
+
+	fprintf(filePtr, "#ifndef __GRADE_TABLE_H__\n");
+	fprintf(filePtr, "#define __GRADE_TABLE_H__\n\n");
+	fprintf(filePtr, "// gradeGen 이 %s 로부터 생성한 파일. 직접 수정하지 말 것.\n\n", iniFileName);
+
+	fprintf(filePtr, "//////////////////////////////////////////////////////////////////////////\n");
+	fprintf(filePtr, "/// Definitions & Macros\n");
+	fprintf(filePtr, "//////////////////////////////////////////////////////////////////////////\n\n");
+
+	fprintf(filePtr, "// 고정 소수점 배율 (아래 범위값은 모두 이 배율을 곱한 정수)\n#define GRADE_TABLE_SCALE\t%d\n", gradeManager->scale);
+	fprintf(filePtr, "// 전체 범위의 최소값\n#define GRADE_TABLE_TOTAL_MIN\t%d\n", gradeManager->totalMin);
+	fprintf(filePtr, "// 전체 범위의 최대값\n#define GRADE_TABLE_TOTAL_MAX\t%d\n", gradeManager->totalMax);
+	gradeGeneratorWriteGradeInfo(filePtr, &(gradeManager->gradeA));
+	gradeGeneratorWriteGradeInfo(filePtr, &(gradeManager->gradeB));
+	gradeGeneratorWriteGradeInfo(filePtr, &(gradeManager->gradeC));
+	gradeGeneratorWriteGradeInfo(filePtr, &(gradeManager->gradeD));
+	fprintf(filePtr, "\n");
+
+	if(domainSize <= GRADE_TABLE_LOOKUP_MAX)
+	{
+		long long domainPos = 0;
+
+		fprintf(filePtr, "// 전체 범위의 점수별 등급 조회 테이블 (인덱스 : 점수 - GRADE_TABLE_TOTAL_MIN)\n");
+		fprintf(filePtr, "static const char gradeTableLookup[%lld] =\n{", domainSize);
+		for( ; domainPos < domainSize; domainPos++)
+		{
+			if(domainPos % GRADE_TABLE_LINE_NUM == 0) fprintf(filePtr, "\n\t");
+			char grade = gradeManagerClassifyScore(gradeManager, (int)(gradeManager->totalMin + domainPos));
+			fprintf(filePtr, "'%c',%s", grade, (domainPos % GRADE_TABLE_LINE_NUM == GRADE_TABLE_LINE_NUM - 1) ? "" : " ");
+		}
+		fprintf(filePtr, "\n};\n\n");
+	}
+
+	fprintf(filePtr, "/**\n");
+	fprintf(filePtr, " * @fn static inline char gradeTableClassify(int score)\n");
+	fprintf(filePtr, " * @brief 컴파일 시간 상수로 지정한 점수의 등급을 판단하는 함수\n");
+	fprintf(filePtr, " * @param score 등급 판단에 사용될 고정 소수점 점수(입력, GRADE_TABLE_SCALE 배)\n");
+	fprintf(filePtr, " * @return 결정된 등급 문자, 어떤 등급에도 속하지 않으면 'F' 문자, 등급 전체 범위를 벗어나면 '?' 문자 반환\n");
+	fprintf(filePtr, " */\n");
+	fprintf(filePtr, "static inline char gradeTableClassify(int score)\n{\n");
+	fprintf(filePtr, "\tif(score < GRADE_TABLE_TOTAL_MIN || score > GRADE_TABLE_TOTAL_MAX) return '?';\n");
+	if(domainSize <= GRADE_TABLE_LOOKUP_MAX)
+	{
+		fprintf(filePtr, "\treturn gradeTableLookup[score - GRADE_TABLE_TOTAL_MIN];\n");
+	}
+	else
+	{
+		const char *gradeNameList = "ABCD";
+		int gradeIndex = 0;
+		for( ; gradeIndex < 4; gradeIndex++)
+		{
+			fprintf(filePtr, "\tif(score >= GRADE_TABLE_%c_MIN && score <= GRADE_TABLE_%c_MAX) return '%c';\n", gradeNameList[gradeIndex], gradeNameList[gradeIndex], gradeNameList[gradeIndex]);
+		}
+		fprintf(filePtr, "\treturn 'F';\n");
+	}
+	fprintf(filePtr, "}\n\n");
+
+	fprintf(filePtr, "#endif // #ifndef __GRADE_TABLE_H__\n");
+
+	return (ferror(filePtr) != 0) ? FAIL : SUCCESS;
+}
+
+/**
+ * @fn static void gradeGeneratorWriteGradeInfo(FILE *filePtr, const gradeInfo_t *gradeInfo)
+ * @brief 등급 하나의 최소, 최대값을 매크로 상수로 출력하는 함수
+ * @param filePtr 헤더 내용을 출력할 파일 스트림(입력)
+ * @param gradeInfo 출력할 등급 정보(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void gradeGeneratorWriteGradeInfo(FILE *filePtr, const gradeInfo_t *gradeInfo)
+{
+	fprintf(filePtr, "// 등급 %c 범위\n", gradeInfo->grade);
+	fprintf(filePtr, "#define GRADE_TABLE_%c_MIN\t%d\n", gradeInfo->grade, gradeInfo->min);
+	fprintf(filePtr, "#define GRADE_TABLE_%c_MAX\t%d\n", gradeInfo->grade, gradeInfo->max);
+}
@@ -1,10 +1,20 @@
+#include <pthread.h>
+
 #include "gradeManager.h"
+#ifdef GRADE_TABLE_STATIC
+#include "gradeTable.h"
+#endif
 
 //////////////////////////////////////////////////////////////////////////
 /// Predefinition of Static Util Function
 //////////////////////////////////////////////////////////////////////////
 
 static int compareNumbers(const char *valueName1, int value1, const char *valueName2, int value2, int type);
+static void registerMemReport(void);
+static void printMemReport(void);
+
+// 할당 보고서를 종료할 때 한 번만 출력하도록 등록한다. (여러 스레드가 동시에 gradeManagerNew 를 호출할 수 있다)
+static pthread_once_t memReportOnce = PTHREAD_ONCE_INIT;
 
 //////////////////////////////////////////////////////////////////////////
 /// Predefinitions of Static Functions
@@ -16,6 +26,13 @@ static const gradeInfo_t* gradeManagerGetGradeInfo(const gradeManager_t *gradeMa
 static int gradeManagerLoadINI(gradeManager_t *gradeManager, const char *fileName);
 static int gradeManagerSetGradeInfo(gradeManager_t *gradeManager, char grade, int min, int max);
 static int gradeManagerGetValueFromINI(const gradeManager_t *gradeManager, const char *field, const char *key, int defaultValue, const char *fileName);
+static int gradeManagerLoadScale(gradeManager_t *gradeManager, const char *fileName);
+#ifndef GRADE_TABLE_STATIC
+static void gradeManagerGetNarrowTable(const gradeManager_t *gradeManager, int *table);
+#endif
+#ifdef GRADE_TABLE_STATIC
+static int gradeManagerCheckStaticTable(const gradeManager_t *gradeManager);
+#endif
 
 //////////////////////////////////////////////////////////////////////////
 /// Static Function for gradeInfo_t
@@ -34,7 +51,7 @@ static void gradeInfoSetData(gradeInfo_t *info, char grade, int min, int max)
 {
 	if(info == NULL)
 	{
-		printf("[DEBUG] gradeInfo 가 NULL.\n");
+		LOG_DEBUG("[DEBUG] gradeInfo 가 NULL.\n");
 		return;
 	}
 
@@ -58,25 +75,32 @@ gradeManager_t* gradeManagerNew(const char *fileName)
 {
 	if(fileName == NULL)
 	{
-		printf("[DEBUG] 주어진 fileName 이 NULL.\n");
+		LOG_DEBUG("[DEBUG] 주어진 fileName 이 NULL.\n");
 		return NULL;
 	}
 
-	gradeManager_t *gradeManager = (gradeManager_t*)malloc(sizeof(gradeManager_t));
+	pthread_once(&memReportOnce, registerMemReport);
+
+	gradeManager_t *gradeManager = (gradeManager_t*)MEM_MALLOC(MEM_SUBSYSTEM_GRADE, sizeof(gradeManager_t));
 	if(gradeManager == NULL)
 	{
-		printf("[DEBUG] gradeManager 객체 동적 생성 실패. NULL.\n");
+		LOG_DEBUG("[DEBUG] gradeManager 객체 동적 생성 실패. NULL.\n");
 		return NULL;
 	}
 
 	gradeManager->iniManager = NULL;
+	gradeManager->scale = 1;
 	if(gradeManagerLoadINI(gradeManager, fileName) == FAIL)
 	{
-		printf("[로딩 실패]\n\n");
+		LOG_INFO("[로딩 실패]\n\n");
+		logFlush();
 		gradeManagerDelete(&gradeManager);
 		return NULL;
 	}
 
+	// 로딩 과정 메시지가 호출한 쪽의 결과 출력보다 먼저 나오도록 기다린다.
+	logFlush();
+
 	return gradeManager;
 }
 
@@ -91,7 +115,7 @@ void gradeManagerDelete(gradeManager_t **gradeManager)
 {
 	if(*gradeManager == NULL)
 	{
-		printf("[DEBUG] gradeManager 해제 실패. 객체가 NULL.\n");
+		LOG_DEBUG("[DEBUG] gradeManager 해제 실패. 객체가 NULL.\n");
 		return;
 	}
 
@@ -100,7 +124,7 @@ void gradeManagerDelete(gradeManager_t **gradeManager)
 		iniManagerDelete(&((*gradeManager)->iniManager));
 	}
 
-	free(*gradeManager);
+	MEM_FREE(*gradeManager);
 	*gradeManager = NULL;
 }
 
@@ -117,30 +141,443 @@ void gradeManagerEvaluateGrade(const gradeManager_t *gradeManager, const int *sc
 {
 	if(gradeManager == NULL)
 	{
-		printf("[DEBUG] gradeManager 가 NULL.\n");
+		LOG_DEBUG("[DEBUG] gradeManager 가 NULL.\n");
 		return;
 	}
 
 	if(scores == NULL)
 	{
-		printf("[DEBUG] 입력받은 점수 목록이 NULL.\n");
+		LOG_DEBUG("[DEBUG] 입력받은 점수 목록이 NULL.\n");
 		return;
 	}
 
 	if(size <= 0)
 	{
-		printf("[ERROR] 입력받은 점수 목록의 크기가 0 보다 작거나 같음. (size:%d)\n", size);
+		LOG_ERROR("[ERROR] 입력받은 점수 목록의 크기가 0 보다 작거나 같음. (size:%d)\n", size);
 		return;
 	}
 
 	int scorePos = 0;
+	char scoreText[GRADE_SCORE_TEXT_LEN];
 	for( ; scorePos < size; scorePos++)	
 	{
-		printf("[%d] [%d -> %c]\n", scorePos, scores[scorePos], gradeManagerGetGradeFromNumber(gradeManager, scores[scorePos]));
+		gradeManagerFormatScore(gradeManager, scores[scorePos], scoreText, sizeof(scoreText));
+		char grade = gradeManagerGetGradeFromNumber(gradeManager, scores[scorePos]);
+		// 범위를 벗어난 점수의 오류 메시지가 해당 결과 줄 앞에 나오도록 기다린다. (남은 메시지가 없으면 바로 반환)
+		logFlush();
+		printf("[%d] [%s -> %c]\n", scorePos, scoreText, grade);
 	}
 	printf("\n");
 }
 
+/**
+ * @fn char gradeManagerClassifyScore(const gradeManager_t *gradeManager, int score)
+ * @brief 지정한 점수에 대한 등급을 출력 없이 판단하는 함수
+ * 대량의 점수를 처리하는 경로에서 사용되므로 등급 전체 범위를 벗어난 점수에 대해서도 메시지를 출력하지 않는다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param score 등급 판단에 사용될 점수(입력)
+ * @return 성공 시 결정된 등급 문자, 어떤 등급에도 속하지 않으면 'F' 문자, 등급 전체 범위를 벗어나거나 실패 시 '?' 문자 반환
+ */
+char gradeManagerClassifyScore(const gradeManager_t *gradeManager, int score)
+{
+	if(gradeManager == NULL)
+	{
+		LOG_DEBUG("[DEBUG] gradeManager 가 NULL.\n");
+		return '?';
+	}
+
+#ifdef GRADE_TABLE_STATIC
+	// 특화 빌드에서는 로딩 시 ini 파일과 일치함을 확인한 컴파일 시간 상수로 판단한다.
+	return gradeTableClassify(score);
+#else
+	if(score < gradeManager->totalMin || score > gradeManager->totalMax) return '?';
+	if(score >= gradeManager->gradeA.min && score <= gradeManager->gradeA.max) return 'A';
+	if(score >= gradeManager->gradeB.min && score <= gradeManager->gradeB.max) return 'B';
+	if(score >= gradeManager->gradeC.min && score <= gradeManager->gradeC.max) return 'C';
+	if(score >= gradeManager->gradeD.min && score <= gradeManager->gradeD.max) return 'D';
+
+	return 'F';
+#endif
+}
+
+/**
+ * @fn void gradeManagerClassifyScores(const gradeManager_t *gradeManager, const int *restrict scores, char *restrict grades, int size)
+ * @brief 점수 배열 전체에 대한 등급을 출력 없이 판단해서 등급 배열에 저장하는 함수
+ * 분기 없이 정수 비교와 선택만 사용하므로 컴파일러가 정수 SIMD 명령으로 벡터화할 수 있다.
+ * 점수는 고정 소수점 정수이므로 소수점 점수도 정수 점수와 같은 속도로 판단한다.
+ * 등급 범위가 겹치면 gradeManagerClassifyScore 와 같이 A, B, C, D 순서로 먼저 맞는 등급을 고르도록 D 부터 덮어쓴다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터와 배열에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param scores 등급 판단을 위한 점수들을 담은 정수 배열(입력, 읽기 전용)
+ * @param grades 판단된 등급 문자를 저장할 배열(출력, scores 와 같은 크기)
+ * @param size 배열의 전체 크기(입력)
+ * @return 반환값 없음
+ */
+void gradeManagerClassifyScores(const gradeManager_t *gradeManager, const int *restrict scores, char *restrict grades, int size)
+{
+	if(gradeManager == NULL || scores == NULL || grades == NULL)
+	{
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, scores:%p, grades:%p)\n", (const void*)gradeManager, (const void*)scores, (void*)grades);
+		return;
+	}
+
+	int scorePos = 0;
+#ifdef GRADE_TABLE_STATIC
+	for( ; scorePos < size; scorePos++)
+	{
+		grades[scorePos] = gradeTableClassify(scores[scorePos]);
+	}
+#else
+	const int totalMin = gradeManager->totalMin, totalMax = gradeManager->totalMax;
+	const int minA = gradeManager->gradeA.min, maxA = gradeManager->gradeA.max;
+	const int minB = gradeManager->gradeB.min, maxB = gradeManager->gradeB.max;
+	const int minC = gradeManager->gradeC.min, maxC = gradeManager->gradeC.max;
+	const int minD = gradeManager->gradeD.min, maxD = gradeManager->gradeD.max;
+
+	for( ; scorePos < size; scorePos++)
+	{
+		int score = scores[scorePos];
+		char grade = 'F';
+		grade = (score >= minD && score <= maxD) ? 'D' : grade;
+		grade = (score >= minC && score <= maxC) ? 'C' : grade;
+		grade = (score >= minB && score <= maxB) ? 'B' : grade;
+		grade = (score >= minA && score <= maxA) ? 'A' : grade;
+		grade = (score < totalMin || score > totalMax) ? '?' : grade;
+		grades[scorePos] = grade;
+	}
+#endif
+}
+
+/**
+ * @fn void gradeManagerClassifyScores8(const gradeManager_t *gradeManager, const uint8_t *restrict scores, char *restrict grades, int size)
+ * @brief 전체 최소값을 뺀 uint8_t 점수 배열 전체에 대한 등급을 출력 없이 판단해서 등급 배열에 저장하는 함수
+ * 원소가 1 바이트이므로 같은 SIMD 레지스터에 int 배열의 4 배 점수를 담아 비교하고, 읽는 메모리 양도 1/4 로 줄어든다.
+ * 등급 전체 범위를 벗어난 원래 점수는 좁히기 전에 GRADE_NARROW8_INVALID 로 표시되어 있어야 하며 '?' 로 판단한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터와 배열에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용, 전체 범위가 SCORE_WIDTH_8 에 맞아야 함)
+ * @param scores 점수에서 전체 최소값을 뺀 값들을 담은 배열(입력, 읽기 전용)
+ * @param grades 판단된 등급 문자를 저장할 배열(출력, scores 와 같은 크기)
+ * @param size 배열의 전체 크기(입력)
+ * @return 반환값 없음
+ */
+void gradeManagerClassifyScores8(const gradeManager_t *gradeManager, const uint8_t *restrict scores, char *restrict grades, int size)
+{
+	if(gradeManager == NULL || scores == NULL || grades == NULL)
+	{
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, scores:%p, grades:%p)\n", (const void*)gradeManager, (const void*)scores, (void*)grades);
+		return;
+	}
+
+	int scorePos = 0;
+#ifdef GRADE_TABLE_STATIC
+	for( ; scorePos < size; scorePos++)
+	{
+		int score = scores[scorePos];
+		grades[scorePos] = (score == GRADE_NARROW8_INVALID) ? '?' : gradeTableClassify(score + GRADE_TABLE_TOTAL_MIN);
+	}
+#else
+	int table[8];
+	gradeManagerGetNarrowTable(gradeManager, table);
+	const uint8_t minA = (uint8_t)table[0], maxA = (uint8_t)table[1];
+	const uint8_t minB = (uint8_t)table[2], maxB = (uint8_t)table[3];
+	const uint8_t minC = (uint8_t)table[4], maxC = (uint8_t)table[5];
+	const uint8_t minD = (uint8_t)table[6], maxD = (uint8_t)table[7];
+
+	for( ; scorePos < size; scorePos++)
+	{
+		uint8_t score = scores[scorePos];
+		char grade = 'F';
+		grade = (score >= minD && score <= maxD) ? 'D' : grade;
+		grade = (score >= minC && score <= maxC) ? 'C' : grade;
+		grade = (score >= minB && score <= maxB) ? 'B' : grade;
+		grade = (score >= minA && score <= maxA) ? 'A' : grade;
+		grade = (score == GRADE_NARROW8_INVALID) ? '?' : grade;
+		grades[scorePos] = grade;
+	}
+#endif
+}
+
+/**
+ * @fn void gradeManagerClassifyScores16(const gradeManager_t *gradeManager, const uint16_t *restrict scores, char *restrict grades, int size)
+ * @brief 전체 최소값을 뺀 uint16_t 점수 배열 전체에 대한 등급을 출력 없이 판단해서 등급 배열에 저장하는 함수
+ * gradeManagerClassifyScores8 과 같으며, 소수점 배율을 쓰는 등 전체 범위가 1 바이트를 넘는 경우에 사용한다.
+ * 등급 전체 범위를 벗어난 원래 점수는 좁히기 전에 GRADE_NARROW16_INVALID 로 표시되어 있어야 하며 '?' 로 판단한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터와 배열에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용, 전체 범위가 SCORE_WIDTH_16 에 맞아야 함)
+ * @param scores 점수에서 전체 최소값을 뺀 값들을 담은 배열(입력, 읽기 전용)
+ * @param grades 판단된 등급 문자를 저장할 배열(출력, scores 와 같은 크기)
+ * @param size 배열의 전체 크기(입력)
+ * @return 반환값 없음
+ */
+void gradeManagerClassifyScores16(const gradeManager_t *gradeManager, const uint16_t *restrict scores, char *restrict grades, int size)
+{
+	if(gradeManager == NULL || scores == NULL || grades == NULL)
+	{
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, scores:%p, grades:%p)\n", (const void*)gradeManager, (const void*)scores, (void*)grades);
+		return;
+	}
+
+	int scorePos = 0;
+#ifdef GRADE_TABLE_STATIC
+	for( ; scorePos < size; scorePos++)
+	{
+		int score = scores[scorePos];
+		grades[scorePos] = (score == GRADE_NARROW16_INVALID) ? '?' : gradeTableClassify(score + GRADE_TABLE_TOTAL_MIN);
+	}
+#else
+	int table[8];
+	gradeManagerGetNarrowTable(gradeManager, table);
+	const uint16_t minA = (uint16_t)table[0], maxA = (uint16_t)table[1];
+	const uint16_t minB = (uint16_t)table[2], maxB = (uint16_t)table[3];
+	const uint16_t minC = (uint16_t)table[4], maxC = (uint16_t)table[5];
+	const uint16_t minD = (uint16_t)table[6], maxD = (uint16_t)table[7];
+
+	for( ; scorePos < size; scorePos++)
+	{
+		uint16_t score = scores[scorePos];
+		char grade = 'F';
+		grade = (score >= minD && score <= maxD) ? 'D' : grade;
+		grade = (score >= minC && score <= maxC) ? 'C' : grade;
+		grade = (score >= minB && score <= maxB) ? 'B' : grade;
+		grade = (score >= minA && score <= maxA) ? 'A' : grade;
+		grade = (score == GRADE_NARROW16_INVALID) ? '?' : grade;
+		grades[scorePos] = grade;
+	}
+#endif
+}
+
+/**
+ * @fn int gradeManagerGetScoreWidth(const gradeManager_t *gradeManager)
+ * @brief 등급 전체 범위의 점수를 담을 수 있는 가장 작은 점수 배열 원소 크기를 구하는 함수
+ * 좁은 배열은 점수에서 전체 최소값을 뺀 값을 저장하고 자료형의 최대값을 범위 밖 표시로 쓰므로, 전체 범위의 길이가 최대값보다 작아야 한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @return 성공 시 SCORE_WIDTH_8, SCORE_WIDTH_16, SCORE_WIDTH_32 중 하나, 실패 시 FAIL 반환
+ */
+int gradeManagerGetScoreWidth(const gradeManager_t *gradeManager)
+{
+	if(gradeManager == NULL)
+	{
+		LOG_DEBUG("[DEBUG] gradeManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	long long range = (long long)gradeManager->totalMax - gradeManager->totalMin;
+	if(range < GRADE_NARROW8_INVALID) return SCORE_WIDTH_8;
+	if(range < GRADE_NARROW16_INVALID) return SCORE_WIDTH_16;
+
+	return SCORE_WIDTH_32;
+}
+
+/**
+ * @fn int gradeManagerGetGradeIndex(char grade)
+ * @brief 등급 문자를 등급별 통계 배열의 인덱스로 변환하는 함수
+ * @param grade 변환할 등급 문자(입력)
+ * @return 항상 0 ~ GRADE_KIND_NUM - 1 사이의 인덱스 반환 (알 수 없는 문자는 '?' 의 인덱스)
+ */
+int gradeManagerGetGradeIndex(char grade)
+{
+	switch(grade)
+	{
+		case 'A': return 0;
+		case 'B': return 1;
+		case 'C': return 2;
+		case 'D': return 3;
+		case 'F': return 4;
+		default: return 5;
+	}
+}
+
+/**
+ * @fn char gradeManagerGetGradeFromIndex(int index)
+ * @brief 등급별 통계 배열의 인덱스를 등급 문자로 변환하는 함수
+ * @param index 변환할 인덱스(입력)
+ * @return 항상 등급 문자 반환 (범위를 벗어난 인덱스는 '?')
+ */
+char gradeManagerGetGradeFromIndex(int index)
+{
+	static const char gradeTable[GRADE_KIND_NUM] = { 'A', 'B', 'C', 'D', 'F', '?' };
+	if(index < 0 || index >= GRADE_KIND_NUM) return '?';
+	return gradeTable[index];
+}
+
+/**
+ * @fn int gradeManagerParseScore(const gradeManager_t *gradeManager, const char *text, size_t length, int *score)
+ * @brief 소수점이 있을 수 있는 점수 문자열을 ini 파일의 고정 소수점 배율로 변환하는 함수
+ * 예) scale 10 : "87.5" -> 875, scale 1 : "87.5" -> 실패
+ * 점수마다 호출되는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param text 점수 문자열(입력, 읽기 전용, NULL 종료 문자가 없어도 됨)
+ * @param length 점수 문자열 길이(입력)
+ * @param score 변환된 고정 소수점 점수(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int gradeManagerParseScore(const gradeManager_t *gradeManager, const char *text, size_t length, int *score)
+{
+	return iniParseFixedPoint(text, length, gradeManager->scale, score);
+}
+
+/**
+ * @fn int gradeManagerFormatScore(const gradeManager_t *gradeManager, int score, char *buffer, size_t size)
+ * @brief 고정 소수점 점수를 소수점이 있는 문자열로 변환하는 함수 (scale 이 1 이면 정수 그대로)
+ * 예) scale 10 : 875 -> "87.5", -5 -> "-0.5"
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param score 변환할 고정 소수점 점수(입력)
+ * @param buffer 변환된 문자열을 저장할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @return 성공 시 문자열 길이, 실패 시 FAIL 반환
+ */
+int gradeManagerFormatScore(const gradeManager_t *gradeManager, int score, char *buffer, size_t size)
+{
+	if(gradeManager == NULL || buffer == NULL || size == 0)
+	{
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, buffer:%p)\n", (const void*)gradeManager, (void*)buffer);
+		return FAIL;
+	}
+
+	int scale = gradeManager->scale;
+	if(scale <= 1) return snprintf(buffer, size, "%d", score);
+
+	int decimalNum = 0;
+	int scaleRemain = scale;
+	for( ; scaleRemain > 1; scaleRemain /= 10) decimalNum++;
+
+	long long value = score;
+	const char *sign = (value < 0) ? "-" : "";
+	if(value < 0) value = -value;
+
+	return snprintf(buffer, size, "%s%lld.%0*lld", sign, value / scale, decimalNum, value % scale);
+}
+
+/**
+ * @fn int gradeManagerGetTable(const gradeManager_t *gradeManager, int *table)
+ * @brief 검증된 등급 테이블을 정해진 순서의 정수 배열로 꺼내는 함수
+ * 순서는 배율, 전체 최소값, 전체 최대값, A ~ D 의 최소값과 최대값이다. ini 파일의 주석, 공백, 필드 순서는 결과에 영향을 주지 않는다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param table 등급 테이블을 저장할 배열(출력, GRADE_TABLE_LEN 크기)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int gradeManagerGetTable(const gradeManager_t *gradeManager, int *table)
+{
+	if(gradeManager == NULL || table == NULL)
+	{
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, table:%p)\n", (const void*)gradeManager, (void*)table);
+		return FAIL;
+	}
+
+	const gradeInfo_t *gradeInfoList[4] = { &(gradeManager->gradeA), &(gradeManager->gradeB), &(gradeManager->gradeC), &(gradeManager->gradeD) };
+	int tableNum = 0;
+	int gradeIndex = 0;
+
+	table[tableNum++] = gradeManager->scale;
+	table[tableNum++] = gradeManager->totalMin;
+	table[tableNum++] = gradeManager->totalMax;
+	for( ; gradeIndex < 4; gradeIndex++)
+	{
+		table[tableNum++] = gradeInfoList[gradeIndex]->min;
+		table[tableNum++] = gradeInfoList[gradeIndex]->max;
+	}
+
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for gradeStats_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void gradeStatsInit(gradeStats_t *stats)
+ * @brief 등급 통계 구조체를 초기화하는 함수
+ * @param stats 초기화할 gradeStats_t 구조체(출력)
+ * @return 반환값 없음
+ */
+void gradeStatsInit(gradeStats_t *stats)
+{
+	if(stats == NULL) return;
+
+	memset(stats, 0, sizeof(gradeStats_t));
+	stats->min = INT_MAX;
+	stats->max = INT_MIN;
+}
+
+/**
+ * @fn void gradeStatsAdd(gradeStats_t *stats, int score, char grade)
+ * @brief 판단된 점수 하나를 등급 통계에 누적하는 함수
+ * 등급 전체 범위를 벗어난 점수('?')는 개수만 누적하고 합과 최소, 최대값에는 포함하지 않는다.
+ * @param stats 통계를 누적할 gradeStats_t 구조체(입력 및 출력)
+ * @param score 판단된 점수(입력)
+ * @param grade 판단된 등급 문자(입력)
+ * @return 반환값 없음
+ */
+void gradeStatsAdd(gradeStats_t *stats, int score, char grade)
+{
+	int index = gradeManagerGetGradeIndex(grade);
+
+	stats->count[index]++;
+	stats->total++;
+	if(grade == '?') return;
+
+	stats->sum += score;
+	if(score < stats->min) stats->min = score;
+	if(score > stats->max) stats->max = score;
+}
+
+/**
+ * @fn void gradeStatsMerge(gradeStats_t *dst, const gradeStats_t *src)
+ * @brief 두 등급 통계를 합치는 함수
+ * @param dst 합친 결과를 저장할 gradeStats_t 구조체(입력 및 출력)
+ * @param src 더할 gradeStats_t 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void gradeStatsMerge(gradeStats_t *dst, const gradeStats_t *src)
+{
+	if(dst == NULL || src == NULL) return;
+
+	int index = 0;
+	for( ; index < GRADE_KIND_NUM; index++)
+	{
+		dst->count[index] += src->count[index];
+	}
+
+	dst->total += src->total;
+	dst->sum += src->sum;
+	if(src->min < dst->min) dst->min = src->min;
+	if(src->max > dst->max) dst->max = src->max;
+}
+
+/**
+ * @fn void gradeStatsPrint(FILE *filePtr, const gradeStats_t *stats)
+ * @brief 등급 통계를 지정한 파일 스트림에 출력하는 함수
+ * @param filePtr 통계를 출력할 파일 스트림(입력)
+ * @param stats 출력할 gradeStats_t 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void gradeStatsPrint(FILE *filePtr, const gradeStats_t *stats)
+{
+	if(filePtr == NULL || stats == NULL) return;
+
+	int index = 0;
+	long long validNum = stats->total - stats->count[gradeManagerGetGradeIndex('?')];
+
+	fprintf(filePtr, "total=%lld", stats->total);
+	for( ; index < GRADE_KIND_NUM; index++)
+	{
+		fprintf(filePtr, " %c=%lld", gradeManagerGetGradeFromIndex(index), stats->count[index]);
+	}
+
+	if(validNum > 0)
+	{
+		fprintf(filePtr, " min=%d max=%d avg=%.2f\n", stats->min, stats->max, (double)stats->sum / (double)validNum);
+	}
+	else
+	{
+		fprintf(filePtr, "\n");
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Static Functions for gradeManager_t
 //////////////////////////////////////////////////////////////////////////
@@ -157,7 +594,7 @@ static char gradeManagerGetGradeFromNumber(const gradeManager_t *gradeManager, i
 {
 	if(score < gradeManager->totalMin || score > gradeManager->totalMax)
 	{
-		printf("\n[ERROR] 입력받은 점수에 대한 등급을 판단할 수 없음.\n");
+		LOG_ERROR("\n[ERROR] 입력받은 점수에 대한 등급을 판단할 수 없음.\n");
 		return '?';
 	}
 
@@ -183,7 +620,7 @@ static int gradeManagerCheckGrade(const gradeManager_t *gradeManager, char grade
 	const gradeInfo_t *gradeInfo = gradeManagerGetGradeInfo(gradeManager, grade);
 	if(gradeInfo == NULL)
 	{
-		printf("[DEBUG] 입력받은 등급에 대한 정보(min, max)가 없음.\n");
+		LOG_DEBUG("[DEBUG] 입력받은 등급에 대한 정보(min, max)가 없음.\n");
 		return FALSE;
 	}
 	return ((score >= gradeInfo->min) && (score <= gradeInfo->max)) ? TRUE : FALSE;
@@ -235,61 +672,68 @@ static int gradeManagerLoadINI(gradeManager_t *gradeManager, const char *fileNam
 		return FAIL;
 	}
 
-	printf("\n[등급 정보 로딩 중...]\n");
+	LOG_INFO("\n[등급 정보 로딩 중...]\n");
+
+	if(gradeManagerLoadScale(gradeManager, fileName) == FAIL) return FAIL;
+	int scale = gradeManager->scale;
 
-	int totalMin = gradeManagerGetValueFromINI(gradeManager, "[Total]", "min", 0, fileName);
+	int totalMin = gradeManagerGetValueFromINI(gradeManager, "[Total]", "min", 0 * scale, fileName);
 	if(totalMin == FAIL) return FAIL;
-	int totalMax = gradeManagerGetValueFromINI(gradeManager, "[Total]", "max", 100, fileName);
+	int totalMax = gradeManagerGetValueFromINI(gradeManager, "[Total]", "max", 100 * scale, fileName);
 	if(totalMax == FAIL) return FAIL;
 	
 	gradeManager->totalMin = totalMin;
 	gradeManager->totalMax = totalMax;
 
-	int minA = gradeManagerGetValueFromINI(gradeManager, "[A]", "min", 90, fileName);
+	int minA = gradeManagerGetValueFromINI(gradeManager, "[A]", "min", 90 * scale, fileName);
 	if(minA == FAIL) return FAIL;
-	if(compareNumbers("A min", minA, "Total min", totalMin, GT) == FAIL) return FAIL;
+	if(compareNumbers("A min", minA, "Total min", totalMin, GT) == FALSE) return FAIL;
 
-	int maxA = gradeManagerGetValueFromINI(gradeManager, "[A]", "max", 100, fileName);
+	int maxA = gradeManagerGetValueFromINI(gradeManager, "[A]", "max", 100 * scale, fileName);
 	if(maxA == FAIL) return FAIL;
-	if(compareNumbers("A max", maxA, "Total max", totalMax, LT) == FAIL) return FAIL;
-	if(compareNumbers("A min", minA, "A max", maxA, LT) == FAIL) return FAIL;
+	if(compareNumbers("A max", maxA, "Total max", totalMax, LT) == FALSE) return FAIL;
+	if(compareNumbers("A min", minA, "A max", maxA, LT) == FALSE) return FAIL;
 
-	int minB = gradeManagerGetValueFromINI(gradeManager, "[B]", "min", 80, fileName);
+	int minB = gradeManagerGetValueFromINI(gradeManager, "[B]", "min", 80 * scale, fileName);
 	if(minB == FAIL) return FAIL;
-	if(compareNumbers("B min", minB, "A min", minA, LT) == FAIL) return FAIL;
-	if(compareNumbers("B min", minB, "Total min", totalMin, GT) == FAIL) return FAIL;
+	if(compareNumbers("B min", minB, "A min", minA, LT) == FALSE) return FAIL;
+	if(compareNumbers("B min", minB, "Total min", totalMin, GT) == FALSE) return FAIL;
 
-	int maxB = gradeManagerGetValueFromINI(gradeManager, "[B]", "max", 89, fileName);
+	int maxB = gradeManagerGetValueFromINI(gradeManager, "[B]", "max", 89 * scale, fileName);
 	if(maxB == FAIL) return FAIL;
-	if(compareNumbers("B max", maxB, "A max", maxA, LT) == FAIL) return FAIL;
-	if(compareNumbers("B min", minB, "B max", maxB, LT) == FAIL) return FAIL;
+	if(compareNumbers("B max", maxB, "A max", maxA, LT) == FALSE) return FAIL;
+	if(compareNumbers("B min", minB, "B max", maxB, LT) == FALSE) return FAIL;
 
-	int minC = gradeManagerGetValueFromINI(gradeManager, "[C]", "min", 70, fileName);
+	int minC = gradeManagerGetValueFromINI(gradeManager, "[C]", "min", 70 * scale, fileName);
 	if(minC == FAIL) return FAIL;
-	if(compareNumbers("C min", minC, "B min", minB, LT) == FAIL) return FAIL;
-	if(compareNumbers("C min", minC, "Total min", totalMin, GT) == FAIL) return FAIL;
+	if(compareNumbers("C min", minC, "B min", minB, LT) == FALSE) return FAIL;
+	if(compareNumbers("C min", minC, "Total min", totalMin, GT) == FALSE) return FAIL;
 
-	int maxC = gradeManagerGetValueFromINI(gradeManager, "[C]", "max", 79, fileName);
+	int maxC = gradeManagerGetValueFromINI(gradeManager, "[C]", "max", 79 * scale, fileName);
 	if(maxC == FAIL) return FAIL;
-	if(compareNumbers("C max", maxC, "B max", maxB, LT) == FAIL) return FAIL;
-	if(compareNumbers("C min", minC, "C max", maxC, LT) == FAIL) return FAIL;
+	if(compareNumbers("C max", maxC, "B max", maxB, LT) == FALSE) return FAIL;
+	if(compareNumbers("C min", minC, "C max", maxC, LT) == FALSE) return FAIL;
 
-	int minD = gradeManagerGetValueFromINI(gradeManager, "[D]", "min", 60, fileName);
+	int minD = gradeManagerGetValueFromINI(gradeManager, "[D]", "min", 60 * scale, fileName);
 	if(minD == FAIL) return FAIL;
-	if(compareNumbers("D min", minD, "C min", minC, LT) == FAIL) return FAIL;
-	if(compareNumbers("D min", minD, "Total min", totalMin, GT) == FAIL) return FAIL;
+	if(compareNumbers("D min", minD, "C min", minC, LT) == FALSE) return FAIL;
+	if(compareNumbers("D min", minD, "Total min", totalMin, GT) == FALSE) return FAIL;
 
-	int maxD = gradeManagerGetValueFromINI(gradeManager, "[D]", "max", 69, fileName);
+	int maxD = gradeManagerGetValueFromINI(gradeManager, "[D]", "max", 69 * scale, fileName);
 	if(maxD == FAIL) return FAIL;
-	if(compareNumbers("D max", maxD, "C max", maxC, LT) == FAIL) return FAIL;
-	if(compareNumbers("D min", minD, "D max", maxD, LT) == FAIL) return FAIL;
+	if(compareNumbers("D max", maxD, "C max", maxC, LT) == FALSE) return FAIL;
+	if(compareNumbers("D min", minD, "D max", maxD, LT) == FALSE) return FAIL;
 
 	if(gradeManagerSetGradeInfo(gradeManager, 'A', minA, maxA) == FAIL) return FAIL;
 	if(gradeManagerSetGradeInfo(gradeManager, 'B', minB, maxB) == FAIL) return FAIL;
 	if(gradeManagerSetGradeInfo(gradeManager, 'C', minC, maxC) == FAIL) return FAIL;
 	if(gradeManagerSetGradeInfo(gradeManager, 'D', minD, maxD) == FAIL) return FAIL;
 
-	printf("[로딩 완료]\n\n");
+#ifdef GRADE_TABLE_STATIC
+	if(gradeManagerCheckStaticTable(gradeManager) == FAIL) return FAIL;
+#endif
+
+	LOG_INFO("[로딩 완료]\n\n");
 	return SUCCESS;
 }
 
@@ -326,26 +770,109 @@ static int gradeManagerSetGradeInfo(gradeManager_t *gradeManager, char grade, in
 	return SUCCESS;
 }
 
+/**
+ * @fn static int gradeManagerLoadScale(gradeManager_t *gradeManager, const char *fileName)
+ * @brief ini 파일의 선택 필드 [Scale] 의 factor 키로 고정 소수점 배율을 정하는 함수
+ * 필드가 없으면 배율은 1 (정수 점수)이고, 배율은 1 ~ GRADE_MAX_SCALE 사이의 10 의 거듭제곱이어야 한다.
+ * gradeManagerLoadINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 이름에 대한 NULL 체크를 수행하지 않는다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력 및 출력)
+ * @param fileName 등급 정보를 관리하는 ini 파일 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int gradeManagerLoadScale(gradeManager_t *gradeManager, const char *fileName)
+{
+	gradeManager->scale = 1;
+	if(iniManagerHasField(gradeManager->iniManager, "[Scale]") == 0) return SUCCESS;
+
+	int result = FAIL;
+	int scale = iniManagerGetValueFromField(gradeManager->iniManager, "[Scale]", "factor", 1, fileName, &result);
+	if(result == FAIL) return FAIL;
+
+	int scaleRemain = scale;
+	while(scaleRemain > 1 && scaleRemain % 10 == 0) scaleRemain /= 10;
+	if(scale < 1 || scale > GRADE_MAX_SCALE || scaleRemain != 1)
+	{
+		LOG_ERROR("[ERROR] 잘못된 고정 소수점 배율. 10 의 거듭제곱이어야 함. (factor:%d, max:%d)\n", scale, GRADE_MAX_SCALE);
+		return FAIL;
+	}
+
+	LOG_INFO("[Scale] factor value : %d\n", scale);
+	gradeManager->scale = scale;
+	return SUCCESS;
+}
+
 /**
  * @fn static int gradeManagerGetValueFromINI(const gradeManager_t *gradeManager, const char *field, const char *key, int defaultValue, const char *fileName)
- * @brief iniManager 로 부터 지정한 필드와 키에 해당하는 값을 반환하는 함수
+ * @brief iniManager 로 부터 지정한 필드와 키에 해당하는 값을 고정 소수점 배율(scale)을 곱한 정수로 반환하는 함수
  * gradeManagerLoadINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 필드, 키, 파일 이름에 대한 NULL 체크를 수행하지 않는다.
  * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
  * @param field 키를 찾기 위한 필드 이름(입력, 읽기 전용)
  * @param key 값을 찾기 위한 키 이름(입력, 읽기 전용)
- * @param defaultValue 찾고자 하는 키에 대한 값이 존재하지 않을 때 반환될 값(입력)
+ * @param defaultValue 찾고자 하는 키에 대한 값이 존재하지 않을 때 반환될 값(입력, 이미 scale 을 곱한 값)
  * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용)
  * @return 성공 시 지정한 필드에 대한 키의 값, 실패 시 FAIL 반환
  */
 static int gradeManagerGetValueFromINI(const gradeManager_t *gradeManager, const char *field, const char *key, int defaultValue, const char *fileName)
 {
 	int result = FAIL;
-	int value = iniManagerGetValueFromField(gradeManager->iniManager, field, key, defaultValue, fileName, &result);
+	int value = iniManagerGetFixedValueFromField(gradeManager->iniManager, field, key, gradeManager->scale, defaultValue, fileName, &result);
 	if(result == FAIL) return FAIL;
-	printf("%s %s value : %d\n", field, key, value);
+
+	char valueText[GRADE_SCORE_TEXT_LEN];
+	gradeManagerFormatScore(gradeManager, value, valueText, sizeof(valueText));
+	LOG_INFO("%s %s value : %s\n", field, key, valueText);
 	return value;
 }
 
+#ifndef GRADE_TABLE_STATIC
+/**
+ * @fn static void gradeManagerGetNarrowTable(const gradeManager_t *gradeManager, int *table)
+ * @brief 등급 A ~ D 의 최소값과 최대값을 전체 최소값 기준의 상대값으로 꺼내는 함수
+ * 로딩할 때 모든 등급 범위가 전체 범위 안에 있음을 확인했으므로 상대값은 0 이상 전체 범위 길이 이하이다.
+ * 좁은 점수 배열 판단 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param table A ~ D 순서의 최소값과 최대값을 저장할 배열(출력, 8 크기)
+ * @return 반환값 없음
+ */
+static void gradeManagerGetNarrowTable(const gradeManager_t *gradeManager, int *table)
+{
+	const gradeInfo_t *gradeInfoList[4] = { &(gradeManager->gradeA), &(gradeManager->gradeB), &(gradeManager->gradeC), &(gradeManager->gradeD) };
+	int gradeIndex = 0;
+
+	for( ; gradeIndex < 4; gradeIndex++)
+	{
+		table[gradeIndex * 2] = gradeInfoList[gradeIndex]->min - gradeManager->totalMin;
+		table[gradeIndex * 2 + 1] = gradeInfoList[gradeIndex]->max - gradeManager->totalMin;
+	}
+}
+#endif
+
+#ifdef GRADE_TABLE_STATIC
+/**
+ * @fn static int gradeManagerCheckStaticTable(const gradeManager_t *gradeManager)
+ * @brief 특화 빌드에 포함된 컴파일 시간 등급 상수(gradeTable.h)가 로딩한 ini 파일 내용과 같은지 검사하는 함수
+ * ini 파일이 바뀌었는데 헤더를 다시 생성하지 않은 경우 실행 시간 경로와 결과가 달라지므로 로딩을 실패시킨다.
+ * gradeManagerLoadINI 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @return 일치하면 SUCCESS, 다르면 FAIL 반환
+ */
+static int gradeManagerCheckStaticTable(const gradeManager_t *gradeManager)
+{
+	if(gradeManager->scale != GRADE_TABLE_SCALE
+		|| gradeManager->totalMin != GRADE_TABLE_TOTAL_MIN || gradeManager->totalMax != GRADE_TABLE_TOTAL_MAX
+		|| gradeManager->gradeA.min != GRADE_TABLE_A_MIN || gradeManager->gradeA.max != GRADE_TABLE_A_MAX
+		|| gradeManager->gradeB.min != GRADE_TABLE_B_MIN || gradeManager->gradeB.max != GRADE_TABLE_B_MAX
+		|| gradeManager->gradeC.min != GRADE_TABLE_C_MIN || gradeManager->gradeC.max != GRADE_TABLE_C_MAX
+		|| gradeManager->gradeD.min != GRADE_TABLE_D_MIN || gradeManager->gradeD.max != GRADE_TABLE_D_MAX)
+	{
+		LOG_ERROR("[ERROR] ini 파일이 생성된 등급 테이블(gradeTable.h)과 다름. 헤더를 다시 생성해야 함.\n");
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 /// Static Util Function
 //////////////////////////////////////////////////////////////////////////
@@ -375,11 +902,34 @@ static int compareNumbers(const char *valueName1, int value1, const char *valueN
 	}
 	else
 	{
-		printf("[DEBUG] 알 수 없는 숫자 비교 유형.\n");
+		LOG_DEBUG("[DEBUG] 알 수 없는 숫자 비교 유형.\n");
 		return FALSE;
 	}
 
-	if(result == FALSE) printf("[ERROR] 잘못된 범위 (%s:%d, %s:%d)\n", valueName1, value1, valueName2, value2);
+	if(result == FALSE) LOG_ERROR("[ERROR] 잘못된 범위 (%s:%d, %s:%d)\n", valueName1, value1, valueName2, value2);
 	return result;
 }
 
+/**
+ * @fn static void registerMemReport(void)
+ * @brief MEM_REPORT_ENV 가 설정되어 있으면 할당 보고서를 프로세스 종료 시 출력하도록 등록하는 함수
+ * gradeManagerNew 에서 pthread_once 로 한 번만 호출한다.
+ * @return 반환값 없음
+ */
+static void registerMemReport(void)
+{
+	if(memReportIsEnabled() == TRUE) atexit(printMemReport);
+}
+
+/**
+ * @fn static void printMemReport(void)
+ * @brief 종료할 때 할당 보고서를 출력하는 함수 (atexit 에 등록)
+ * 모든 gradeManager 를 해제한 뒤에 출력하므로 사용 중인 바이트가 남은 항목은 해제되지 않은 블록이 있다는 뜻이다.
+ * 로그 기록 스레드를 멈추는 함수보다 나중에 등록되므로 먼저 실행되며, 남은 로그를 먼저 출력한다.
+ * @return 반환값 없음
+ */
+static void printMemReport(void)
+{
+	logFlush();
+	memReportPrint(stdout);
+}
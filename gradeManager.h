@@ -1,6 +1,9 @@
 #ifndef __GRADE_LIMIT_H__
 #define __GRADE_LIMIT_H__
 
+#include <limits.h>
+#include <stdint.h>
+
 #include "iniManager.h"
 
 //////////////////////////////////////////////////////////////////////////
@@ -12,6 +15,30 @@
 // 조건 거짓
 #define FALSE	0
 
+// 고정 소수점 배율 최대값 (소수점 아래 6 자리)
+#define GRADE_MAX_SCALE	1000000
+// 점수 문자열 최대 길이
+#define GRADE_SCORE_TEXT_LEN	24
+
+// 등급 종류 전체 개수 (A, B, C, D, F, ?)
+#define GRADE_KIND_NUM	6
+
+// gradeManagerGetTable 로 꺼내는 등급 테이블 길이 (배율, 전체 범위, A ~ D 범위)
+#define GRADE_TABLE_LEN	11
+
+// 좁은 점수 배열에서 등급 전체 범위를 벗어난 점수를 나타내는 값 (원소 자료형의 최대값)
+#define GRADE_NARROW8_INVALID	UINT8_MAX
+#define GRADE_NARROW16_INVALID	UINT16_MAX
+
+// 점수 배열 원소 크기 열거형 (바이트)
+enum SCORE_WIDTH
+{
+	SCORE_WIDTH_AUTO = 0,	// 등급 전체 범위에 맞는 가장 작은 크기를 고른다.
+	SCORE_WIDTH_8 = 1,		// uint8_t (점수 - 전체 최소값)
+	SCORE_WIDTH_16 = 2,		// uint16_t (점수 - 전체 최소값)
+	SCORE_WIDTH_32 = 4		// int (원래 점수)
+};
+
 // 숫자 비교 유형 열거형
 enum COMPARE_TYPE
 {
@@ -37,6 +64,7 @@ struct gradeInfo_s
 /**
  * @struct gradeManager_t
  * @brief 지정한 점수에 대한 등급 A ~ D 까지의 정보를 관리하고, 등급 전체 범위와 ini 파일에 대한 정보를 관리하는 구조체
+ * 모든 점수와 범위값은 고정 소수점 배율(scale)을 곱한 정수로 저장한다. (예: scale 10 에서 87.5 -> 875)
  */
 typedef struct gradeManager_s gradeManager_t;
 struct gradeManager_s
@@ -53,10 +81,40 @@ struct gradeManager_s
 	int totalMin;
 	// 전체 범위의 최대값
 	int totalMax;
+	// 고정 소수점 배율 (ini 파일의 [Scale] factor, 없으면 1)
+	int scale;
 	// ini 파일에 대한 정보를 관리하는 구조체
 	iniManager_t *iniManager;
 };
 
+/**
+ * @struct gradeStats_t
+ * @brief 등급 판단 결과에 대한 등급별 개수와 점수 통계를 저장하는 구조체
+ */
+typedef struct gradeStats_s gradeStats_t;
+struct gradeStats_s
+{
+	// 등급별 개수 (gradeManagerGetGradeIndex 의 인덱스 순서)
+	long long count[GRADE_KIND_NUM];
+	// 판단한 점수 전체 개수
+	long long total;
+	// 등급 전체 범위에 포함된 점수들의 합
+	long long sum;
+	// 등급 전체 범위에 포함된 점수 중 최소값
+	int min;
+	// 등급 전체 범위에 포함된 점수 중 최대값
+	int max;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for gradeStats_t
+//////////////////////////////////////////////////////////////////////////
+
+void gradeStatsInit(gradeStats_t *stats);
+void gradeStatsAdd(gradeStats_t *stats, int score, char grade);
+void gradeStatsMerge(gradeStats_t *dst, const gradeStats_t *src);
+void gradeStatsPrint(FILE *filePtr, const gradeStats_t *stats);
+
 //////////////////////////////////////////////////////////////////////////
 /// Public Functions for gradeManager_t
 //////////////////////////////////////////////////////////////////////////
@@ -64,5 +122,15 @@ struct gradeManager_s
 gradeManager_t* gradeManagerNew(const char *fileName);
 void gradeManagerDelete(gradeManager_t **manager);
 void gradeManagerEvaluateGrade(const gradeManager_t *manager, const int *scores, int size);
+char gradeManagerClassifyScore(const gradeManager_t *manager, int score);
+void gradeManagerClassifyScores(const gradeManager_t *manager, const int *restrict scores, char *restrict grades, int size);
+void gradeManagerClassifyScores8(const gradeManager_t *manager, const uint8_t *restrict scores, char *restrict grades, int size);
+void gradeManagerClassifyScores16(const gradeManager_t *manager, const uint16_t *restrict scores, char *restrict grades, int size);
+int gradeManagerGetScoreWidth(const gradeManager_t *manager);
+int gradeManagerGetGradeIndex(char grade);
+char gradeManagerGetGradeFromIndex(int index);
+int gradeManagerParseScore(const gradeManager_t *manager, const char *text, size_t length, int *score);
+int gradeManagerFormatScore(const gradeManager_t *manager, int score, char *buffer, size_t size);
+int gradeManagerGetTable(const gradeManager_t *manager, int *table);
 
 #endif // #ifndef __GRADE_LIMIT_H__
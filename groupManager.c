@@ -0,0 +1,726 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "groupManager.h"
+#include "cacheManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for groupTable_t
+//////////////////////////////////////////////////////////////////////////
+
+static int groupTableInit(groupTable_t *table);
+static void groupTableFinal(groupTable_t *table);
+static int groupTableFindSlot(const groupTable_t *table, const char *key, int keyLength, uint64_t hash);
+static groupEntry_t* groupTableUpsert(groupTable_t *table, const char *key, int keyLength, int level, uint64_t hash);
+static int groupTableGrow(groupTable_t *table);
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for groupManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static void* groupManagerWorkerThread(void *data);
+static int groupManagerMerge(groupManager_t *groupManager, groupWorker_t *workerList);
+static int groupManagerRollup(groupManager_t *groupManager);
+static int groupManagerSort(groupManager_t *groupManager);
+static void groupManagerWriteEntry(FILE *filePtr, const groupManager_t *groupManager, const groupEntry_t *entry);
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinition of Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+static int isBlank(char c);
+static int compareGroupEntry(const void *entry1, const void *entry2);
+static double getElapsedSec(const struct timespec *startTime, const struct timespec *endTime);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for groupManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn groupManager_t* groupManagerNew(const gradeManager_t *gradeManager, const char *fileName, int keyFieldNum, int threadNum)
+ * @brief 그룹 필드와 점수로 구성된 레코드 파일을 매핑하고 그룹 집계를 준비하는 함수
+ * 작업 스레드들이 파일의 서로 다른 구간을 동시에 읽으므로 압축되지 않은 파일만 읽는다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param fileName 입력 파일 이름(입력, 읽기 전용)
+ * @param keyFieldNum 그룹 키로 쓸 앞쪽 필드 개수(입력, 0 이하이면 점수 앞의 모든 필드)
+ * @param threadNum 작업 스레드 개수(입력, 0 이하이면 CPU 개수)
+ * @return 성공 시 새로 생성된 groupManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+groupManager_t* groupManagerNew(const gradeManager_t *gradeManager, const char *fileName, int keyFieldNum, int threadNum)
+{
+	if(gradeManager == NULL || fileName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, fileName:%p)\n", (const void*)gradeManager, (const void*)fileName);
+		return NULL;
+	}
+
+	if(threadNum <= 0) threadNum = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(threadNum <= 0) threadNum = 1;
+	if(threadNum > GROUP_MAX_THREAD_NUM) threadNum = GROUP_MAX_THREAD_NUM;
+
+	groupManager_t *groupManager = (groupManager_t*)calloc(1, sizeof(groupManager_t));
+	if(groupManager == NULL)
+	{
+		printf("[DEBUG] groupManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	groupManager->gradeManager = gradeManager;
+	groupManager->keyFieldNum = (keyFieldNum > 0) ? keyFieldNum : 0;
+	groupManager->threadNum = threadNum;
+	if(snprintf(groupManager->fileName, sizeof(groupManager->fileName), "%s", fileName) >= (int)sizeof(groupManager->fileName))
+	{
+		printf("[ERROR] 파일 경로가 너무 김. (fileName:%s)\n", fileName);
+		groupManagerDelete(&groupManager);
+		return NULL;
+	}
+
+	int fd = open(fileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 입력 파일 열기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		groupManagerDelete(&groupManager);
+		return NULL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1)
+	{
+		printf("[ERROR] 입력 파일 정보 읽기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		close(fd);
+		groupManagerDelete(&groupManager);
+		return NULL;
+	}
+
+	groupManager->size = (size_t)fileStat.st_size;
+	if(groupManager->size > 0)
+	{
+		void *mapped = mmap(NULL, groupManager->size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapped == MAP_FAILED)
+		{
+			printf("[ERROR] 입력 파일 매핑 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+			close(fd);
+			groupManager->size = 0;
+			groupManagerDelete(&groupManager);
+			return NULL;
+		}
+		madvise(mapped, groupManager->size, MADV_SEQUENTIAL);
+		groupManager->data = (char*)mapped;
+	}
+	close(fd);
+
+	return groupManager;
+}
+
+/**
+ * @fn void groupManagerDelete(groupManager_t **groupManager)
+ * @brief 생성된 groupManager_t 구조체 객체와 해시 테이블, 매핑된 입력 파일을 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param groupManager 삭제할 groupManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void groupManagerDelete(groupManager_t **groupManager)
+{
+	if(groupManager == NULL || *groupManager == NULL)
+	{
+		printf("[DEBUG] groupManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	if((*groupManager)->data != NULL) munmap((*groupManager)->data, (*groupManager)->size);
+	groupTableFinal(&((*groupManager)->table));
+	free((*groupManager)->sortedList);
+	free(*groupManager);
+	*groupManager = NULL;
+}
+
+/**
+ * @fn int groupManagerRun(groupManager_t *groupManager)
+ * @brief 입력 파일을 레코드 경계로 나눠 작업 스레드들이 그룹별로 집계하고, 병합과 상위 단계 합계, 정렬을 수행하는 함수
+ * 스레드마다 자기 해시 테이블에만 쓰므로 집계 중에는 잠금이나 원자적 연산이 없다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param groupManager 그룹 집계 구조체(입력 및 출력, 한 번만 호출)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int groupManagerRun(groupManager_t *groupManager)
+{
+	if(groupManager == NULL)
+	{
+		printf("[DEBUG] groupManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	groupWorker_t *workerList = (groupWorker_t*)calloc((size_t)groupManager->threadNum, sizeof(groupWorker_t));
+	if(workerList == NULL)
+	{
+		printf("[DEBUG] 작업 스레드 목록 동적 생성 실패. NULL. (threadNum:%d)\n", groupManager->threadNum);
+		return FAIL;
+	}
+
+	pthread_t threadList[GROUP_MAX_THREAD_NUM];
+	int createdList[GROUP_MAX_THREAD_NUM];
+	struct timespec startTime, scanTime, endTime;
+	int result = SUCCESS;
+	int threadIndex = 0;
+	size_t begin = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	// 구간 끝을 다음 개행 문자 뒤로 옮겨서 레코드가 두 구간에 걸치지 않게 한다.
+	for( ; threadIndex < groupManager->threadNum; threadIndex++)
+	{
+		groupWorker_t *worker = &(workerList[threadIndex]);
+		size_t end = (threadIndex == groupManager->threadNum - 1) ? groupManager->size : groupManager->size / (size_t)groupManager->threadNum * (size_t)(threadIndex + 1);
+		if(end < begin) end = begin;
+		while(end > 0 && end < groupManager->size && groupManager->data[end - 1] != '\n') end++;
+
+		worker->groupManager = groupManager;
+		worker->begin = begin;
+		worker->end = end;
+		worker->result = groupTableInit(&(worker->table));
+		if(worker->result == FAIL) result = FAIL;
+		begin = end;
+	}
+
+	for(threadIndex = 0; result == SUCCESS && threadIndex < groupManager->threadNum; threadIndex++)
+	{
+		createdList[threadIndex] = (pthread_create(&(threadList[threadIndex]), NULL, groupManagerWorkerThread, &(workerList[threadIndex])) == 0) ? TRUE : FALSE;
+	}
+
+	// 스레드를 만들지 못한 구간은 현재 스레드가 처리한다.
+	for(threadIndex = 0; result == SUCCESS && threadIndex < groupManager->threadNum; threadIndex++)
+	{
+		if(createdList[threadIndex] == TRUE) pthread_join(threadList[threadIndex], NULL);
+		else groupManagerWorkerThread(&(workerList[threadIndex]));
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &scanTime);
+
+	for(threadIndex = 0; threadIndex < groupManager->threadNum; threadIndex++)
+	{
+		if(workerList[threadIndex].result == FAIL) result = FAIL;
+		groupManager->recordNum += workerList[threadIndex].recordNum;
+		groupManager->skipNum += workerList[threadIndex].skipNum;
+	}
+
+	if(result == SUCCESS && groupManagerMerge(groupManager, workerList) == FAIL) result = FAIL;
+	if(result == SUCCESS && groupManagerRollup(groupManager) == FAIL) result = FAIL;
+	if(result == SUCCESS && groupManagerSort(groupManager) == FAIL) result = FAIL;
+
+	for(threadIndex = 0; threadIndex < groupManager->threadNum; threadIndex++)
+	{
+		groupTableFinal(&(workerList[threadIndex].table));
+	}
+	free(workerList);
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	groupManager->scanSec = getElapsedSec(&startTime, &scanTime);
+	groupManager->mergeSec = getElapsedSec(&scanTime, &endTime);
+
+	return result;
+}
+
+/**
+ * @fn int groupManagerWriteFile(const groupManager_t *groupManager, const char *outputFileName)
+ * @brief 정렬된 그룹별 등급 분포를 탭으로 구분된 표 형식으로 파일에 쓰는 함수
+ * <줄 형식>
+ * (그룹 키) (단계) (전체 개수) (A) (B) (C) (D) (F) (?) (최소) (최대) (평균)
+ * 상위 그룹이 바로 앞에 오도록 키 순서로 출력하며, 전체 합계의 키는 GROUP_TOTAL_NAME 이다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param groupManager 집계를 마친 그룹 집계 구조체(입력, 읽기 전용)
+ * @param outputFileName 결과 파일 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int groupManagerWriteFile(const groupManager_t *groupManager, const char *outputFileName)
+{
+	if(groupManager == NULL || outputFileName == NULL || groupManager->sortedList == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (groupManager:%p, outputFileName:%p)\n", (const void*)groupManager, (const void*)outputFileName);
+		return FAIL;
+	}
+
+	FILE *filePtr = fopen(outputFileName, "w");
+	if(filePtr == NULL)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", outputFileName, errno);
+		return FAIL;
+	}
+
+	fprintf(filePtr, "#group\tlevel\ttotal\tA\tB\tC\tD\tF\t?\tmin\tmax\tavg\n");
+	int entryIndex = 0;
+	for( ; entryIndex < groupManager->table.entryNum; entryIndex++)
+	{
+		groupManagerWriteEntry(filePtr, groupManager, groupManager->sortedList[entryIndex]);
+	}
+
+	int result = (ferror(filePtr) == 0) ? SUCCESS : FAIL;
+	if(fclose(filePtr) != 0) result = FAIL;
+	if(result == FAIL) printf("[ERROR] 결과 파일 쓰기 실패. (fileName:%s)\n", outputFileName);
+
+	return result;
+}
+
+/**
+ * @fn void groupManagerPrintSummary(FILE *filePtr, const groupManager_t *groupManager)
+ * @brief 그룹 집계 결과의 레코드, 그룹, 단계 개수와 구간별 시간, 전체 합계를 출력하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param filePtr 출력할 파일 스트림(입력)
+ * @param groupManager 집계를 마친 그룹 집계 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void groupManagerPrintSummary(FILE *filePtr, const groupManager_t *groupManager)
+{
+	if(filePtr == NULL || groupManager == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (filePtr:%p, groupManager:%p)\n", (void*)filePtr, (const void*)groupManager);
+		return;
+	}
+
+	fprintf(filePtr, "[그룹 집계] (file:%s, records:%lld, groups:%d, leaves:%d, levels:%d, skipped:%lld, threads:%d, scan:%.3fs, merge:%.3fs)\n",
+		groupManager->fileName, groupManager->recordNum, groupManager->table.entryNum, groupManager->leafNum, groupManager->maxLevel,
+		groupManager->skipNum, groupManager->threadNum, groupManager->scanSec, groupManager->mergeSec);
+
+	// 정렬된 목록의 첫 항목이 키가 빈 문자열인 전체 합계다.
+	if(groupManager->sortedList != NULL && groupManager->table.entryNum > 0 && groupManager->sortedList[0]->level == 0)
+	{
+		fprintf(filePtr, "[전체 결과] ");
+		gradeStatsPrint(filePtr, &(groupManager->sortedList[0]->stats));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for groupTable_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int groupTableInit(groupTable_t *table)
+ * @brief 해시 테이블을 GROUP_INIT_SLOT_NUM 크기로 초기화하는 함수
+ * groupManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param table 초기화할 해시 테이블(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int groupTableInit(groupTable_t *table)
+{
+	table->entryNum = 0;
+	table->slotNum = GROUP_INIT_SLOT_NUM;
+	table->slotList = (groupEntry_t*)calloc((size_t)table->slotNum, sizeof(groupEntry_t));
+	if(table->slotList == NULL)
+	{
+		printf("[DEBUG] slotList 동적 생성 실패. NULL. (slotNum:%d)\n", table->slotNum);
+		table->slotNum = 0;
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void groupTableFinal(groupTable_t *table)
+ * @brief 해시 테이블의 항목 키들과 항목 배열을 해제하는 함수
+ * 초기화하지 않았거나 이미 해제한 테이블(slotList 가 NULL)도 받을 수 있다.
+ * 내부에서만 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param table 해제할 해시 테이블(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void groupTableFinal(groupTable_t *table)
+{
+	int slotIndex = 0;
+	for( ; table->slotList != NULL && slotIndex < table->slotNum; slotIndex++)
+	{
+		free(table->slotList[slotIndex].key);
+	}
+
+	free(table->slotList);
+	table->slotList = NULL;
+	table->slotNum = 0;
+	table->entryNum = 0;
+}
+
+/**
+ * @fn static int groupTableFindSlot(const groupTable_t *table, const char *key, int keyLength, uint64_t hash)
+ * @brief 그룹 키가 있는 자리 또는 등록할 빈 자리를 선형 탐사로 찾는 함수
+ * 해시 테이블은 항상 절반 이상 비어있으므로 탐사는 반드시 끝난다.
+ * 내부에서만 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param table 해시 테이블(입력, 읽기 전용)
+ * @param key 찾을 그룹 키(입력, 읽기 전용, NULL 종료 문자 없어도 됨)
+ * @param keyLength 그룹 키 길이(입력)
+ * @param hash 그룹 키 해시(입력)
+ * @return 같은 키가 있는 자리 또는 빈 자리의 인덱스 반환
+ */
+static int groupTableFindSlot(const groupTable_t *table, const char *key, int keyLength, uint64_t hash)
+{
+	int mask = table->slotNum - 1;
+	int slotIndex = (int)(hash & (uint64_t)mask);
+
+	while(table->slotList[slotIndex].key != NULL)
+	{
+		const groupEntry_t *entry = &(table->slotList[slotIndex]);
+		if(entry->hash == hash && entry->keyLength == keyLength && memcmp(entry->key, key, (size_t)keyLength) == 0) break;
+		slotIndex = (slotIndex + 1) & mask;
+	}
+
+	return slotIndex;
+}
+
+/**
+ * @fn static groupEntry_t* groupTableUpsert(groupTable_t *table, const char *key, int keyLength, int level, uint64_t hash)
+ * @brief 그룹 키의 항목을 찾고, 없으면 키를 복사해서 빈 통계로 등록하는 함수
+ * 등록하면서 테이블이 커질 수 있으므로 이전에 받은 항목 포인터는 다시 찾아야 한다.
+ * 내부에서만 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param table 해시 테이블(입력 및 출력)
+ * @param key 그룹 키(입력, 읽기 전용, NULL 종료 문자 없어도 됨)
+ * @param keyLength 그룹 키 길이(입력)
+ * @param level 그룹 키의 필드 개수(입력)
+ * @param hash 그룹 키 해시(입력)
+ * @return 성공 시 그룹 항목, 실패 시 NULL 반환
+ */
+static groupEntry_t* groupTableUpsert(groupTable_t *table, const char *key, int keyLength, int level, uint64_t hash)
+{
+	int slotIndex = groupTableFindSlot(table, key, keyLength, hash);
+	if(table->slotList[slotIndex].key != NULL) return &(table->slotList[slotIndex]);
+
+	if((table->entryNum + 1) * 2 > table->slotNum)
+	{
+		if(groupTableGrow(table) == FAIL) return NULL;
+		slotIndex = groupTableFindSlot(table, key, keyLength, hash);
+	}
+
+	char *keyCopy = (char*)malloc((size_t)keyLength + 1);
+	if(keyCopy == NULL)
+	{
+		printf("[DEBUG] 그룹 키 동적 생성 실패. NULL. (keyLength:%d)\n", keyLength);
+		return NULL;
+	}
+	memcpy(keyCopy, key, (size_t)keyLength);
+	keyCopy[keyLength] = '\0';
+
+	groupEntry_t *entry = &(table->slotList[slotIndex]);
+	entry->key = keyCopy;
+	entry->keyLength = keyLength;
+	entry->level = level;
+	entry->hash = hash;
+	gradeStatsInit(&(entry->stats));
+	table->entryNum++;
+
+	return entry;
+}
+
+/**
+ * @fn static int groupTableGrow(groupTable_t *table)
+ * @brief 해시 테이블 크기를 두 배로 늘리고 항목들을 다시 배치하는 함수
+ * groupTableUpsert 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param table 해시 테이블(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int groupTableGrow(groupTable_t *table)
+{
+	int oldSlotNum = table->slotNum;
+	groupEntry_t *oldSlotList = table->slotList;
+	groupEntry_t *newSlotList = (groupEntry_t*)calloc((size_t)oldSlotNum * 2, sizeof(groupEntry_t));
+	if(newSlotList == NULL)
+	{
+		printf("[DEBUG] slotList 크기 확장 실패. NULL. (slotNum:%d)\n", oldSlotNum * 2);
+		return FAIL;
+	}
+
+	table->slotList = newSlotList;
+	table->slotNum = oldSlotNum * 2;
+
+	int slotIndex = 0;
+	for( ; slotIndex < oldSlotNum; slotIndex++)
+	{
+		const groupEntry_t *entry = &(oldSlotList[slotIndex]);
+		if(entry->key != NULL) newSlotList[groupTableFindSlot(table, entry->key, entry->keyLength, entry->hash)] = *entry;
+	}
+
+	free(oldSlotList);
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for groupManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void* groupManagerWorkerThread(void *data)
+ * @brief 맡은 구간의 레코드마다 그룹 키와 점수를 읽고 등급을 판단해서 스레드별 해시 테이블에 집계하는 작업 스레드 함수
+ * 빈 줄은 건너뛰고, 점수를 읽을 수 없는 레코드는 stream 처럼 '?' 등급으로 센다.
+ * 그룹 키는 점수 앞의 필드들(keyFieldNum 이 있으면 앞쪽 그 개수만)을 공백 하나로 이은 문자열이므로 필드 사이의 공백 개수는 결과에 영향을 주지 않는다.
+ * pthread_create 로 생성되거나 groupManagerRun 에서 직접 호출되기 때문에 전달받은 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param data 작업 스레드 구조체(groupWorker_t, 입력 및 출력)
+ * @return 항상 NULL 반환
+ */
+static void* groupManagerWorkerThread(void *data)
+{
+	groupWorker_t *worker = (groupWorker_t*)data;
+	const groupManager_t *groupManager = worker->groupManager;
+	const gradeManager_t *gradeManager = groupManager->gradeManager;
+	const char *text = groupManager->data;
+	const int keyFieldNum = groupManager->keyFieldNum;
+	char key[GROUP_KEY_LEN];
+	size_t pos = worker->begin;
+
+	while(pos < worker->end)
+	{
+		const char *line = text + pos;
+		const char *newLine = (const char*)memchr(line, '\n', worker->end - pos);
+		size_t lineLength = (newLine == NULL) ? (worker->end - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		while(lineLength > 0 && isBlank(line[lineLength - 1]) == TRUE) lineLength--;
+		if(lineLength == 0) continue;
+
+		size_t scoreBegin = lineLength;
+		while(scoreBegin > 0 && isBlank(line[scoreBegin - 1]) == FALSE) scoreBegin--;
+
+		int keyLength = 0;
+		int level = 0;
+		int keyTooLong = FALSE;
+		size_t fieldPos = 0;
+		while(keyFieldNum == 0 || level < keyFieldNum)
+		{
+			while(fieldPos < scoreBegin && isBlank(line[fieldPos]) == TRUE) fieldPos++;
+			if(fieldPos >= scoreBegin) break;
+
+			size_t fieldEnd = fieldPos;
+			while(fieldEnd < scoreBegin && isBlank(line[fieldEnd]) == FALSE) fieldEnd++;
+
+			size_t fieldLength = fieldEnd - fieldPos;
+			if((size_t)keyLength + 1 + fieldLength >= GROUP_KEY_LEN)
+			{
+				keyTooLong = TRUE;
+				break;
+			}
+
+			if(level > 0) key[keyLength++] = ' ';
+			memcpy(key + keyLength, line + fieldPos, fieldLength);
+			keyLength += (int)fieldLength;
+			level++;
+			fieldPos = fieldEnd;
+		}
+
+		if(keyTooLong == TRUE)
+		{
+			worker->skipNum++;
+			continue;
+		}
+
+		int score = 0;
+		char grade = '?';
+		if(gradeManagerParseScore(gradeManager, line + scoreBegin, lineLength - scoreBegin, &score) == SUCCESS)
+		{
+			grade = gradeManagerClassifyScore(gradeManager, score);
+		}
+
+		groupEntry_t *entry = groupTableUpsert(&(worker->table), key, keyLength, level, cacheHash64(key, (size_t)keyLength, 0));
+		if(entry == NULL)
+		{
+			worker->result = FAIL;
+			break;
+		}
+		gradeStatsAdd(&(entry->stats), score, grade);
+		worker->recordNum++;
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static int groupManagerMerge(groupManager_t *groupManager, groupWorker_t *workerList)
+ * @brief 스레드별 해시 테이블들을 하나의 해시 테이블로 합치는 함수
+ * 그룹 개수만큼만 반복하므로 레코드 개수와 관계없이 빠르다.
+ * groupManagerRun 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param groupManager 그룹 집계 구조체(입력 및 출력)
+ * @param workerList 집계를 마친 작업 스레드 목록(입력, threadNum 크기)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int groupManagerMerge(groupManager_t *groupManager, groupWorker_t *workerList)
+{
+	if(groupTableInit(&(groupManager->table)) == FAIL) return FAIL;
+
+	int threadIndex = 0;
+	for( ; threadIndex < groupManager->threadNum; threadIndex++)
+	{
+		const groupTable_t *table = &(workerList[threadIndex].table);
+		int slotIndex = 0;
+		for( ; slotIndex < table->slotNum; slotIndex++)
+		{
+			const groupEntry_t *source = &(table->slotList[slotIndex]);
+			if(source->key == NULL) continue;
+
+			groupEntry_t *entry = groupTableUpsert(&(groupManager->table), source->key, source->keyLength, source->level, source->hash);
+			if(entry == NULL) return FAIL;
+			gradeStatsMerge(&(entry->stats), &(source->stats));
+		}
+	}
+
+	groupManager->leafNum = groupManager->table.entryNum;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int groupManagerRollup(groupManager_t *groupManager)
+ * @brief 레코드에서 바로 집계된 그룹마다 키의 앞쪽 필드들로 만든 상위 그룹들과 전체 합계에 통계를 더하는 함수
+ * 예를 들어 "CS 101 A" 그룹의 통계는 "CS 101", "CS", "" (전체 합계) 그룹에 더해진다.
+ * 상위 그룹을 등록하면 테이블이 커질 수 있으므로 원래 그룹들의 복사본을 먼저 만든다. (키 문자열은 테이블이 계속 가진다)
+ * groupManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param groupManager 그룹 집계 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int groupManagerRollup(groupManager_t *groupManager)
+{
+	groupTable_t *table = &(groupManager->table);
+	groupEntry_t *leafList = (groupEntry_t*)malloc(sizeof(groupEntry_t) * ((size_t)groupManager->leafNum + 1));
+	if(leafList == NULL)
+	{
+		printf("[DEBUG] 그룹 목록 동적 생성 실패. NULL. (leafNum:%d)\n", groupManager->leafNum);
+		return FAIL;
+	}
+
+	int leafNum = 0;
+	int slotIndex = 0;
+	for( ; slotIndex < table->slotNum; slotIndex++)
+	{
+		if(table->slotList[slotIndex].key != NULL) leafList[leafNum++] = table->slotList[slotIndex];
+	}
+
+	int result = SUCCESS;
+	int leafIndex = 0;
+	for( ; leafIndex < leafNum && result == SUCCESS; leafIndex++)
+	{
+		const groupEntry_t *leaf = &(leafList[leafIndex]);
+		int prefixLength = leaf->keyLength;
+		int level = leaf->level - 1;
+
+		if(leaf->level > groupManager->maxLevel) groupManager->maxLevel = leaf->level;
+		for( ; level >= 0; level--)
+		{
+			// 마지막 필드와 그 앞의 공백을 떼어 한 단계 위의 키를 만든다.
+			while(prefixLength > 0 && leaf->key[prefixLength - 1] != ' ') prefixLength--;
+			if(prefixLength > 0) prefixLength--;
+
+			groupEntry_t *entry = groupTableUpsert(table, leaf->key, prefixLength, level, cacheHash64(leaf->key, (size_t)prefixLength, 0));
+			if(entry == NULL)
+			{
+				result = FAIL;
+				break;
+			}
+			gradeStatsMerge(&(entry->stats), &(leaf->stats));
+		}
+	}
+
+	free(leafList);
+	return result;
+}
+
+/**
+ * @fn static int groupManagerSort(groupManager_t *groupManager)
+ * @brief 해시 테이블의 항목들을 그룹 키 순서로 정렬한 목록을 만드는 함수
+ * 키 안의 필드 구분자인 공백은 출력 가능한 어떤 문자보다 작으므로, 상위 그룹은 하위 그룹들 바로 앞에 온다.
+ * groupManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param groupManager 그룹 집계 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int groupManagerSort(groupManager_t *groupManager)
+{
+	const groupTable_t *table = &(groupManager->table);
+	groupManager->sortedList = (const groupEntry_t**)malloc(sizeof(groupEntry_t*) * ((size_t)table->entryNum + 1));
+	if(groupManager->sortedList == NULL)
+	{
+		printf("[DEBUG] 정렬 목록 동적 생성 실패. NULL. (entryNum:%d)\n", table->entryNum);
+		return FAIL;
+	}
+
+	int entryNum = 0;
+	int slotIndex = 0;
+	for( ; slotIndex < table->slotNum; slotIndex++)
+	{
+		if(table->slotList[slotIndex].key != NULL) groupManager->sortedList[entryNum++] = &(table->slotList[slotIndex]);
+	}
+
+	qsort(groupManager->sortedList, (size_t)entryNum, sizeof(groupEntry_t*), compareGroupEntry);
+	return SUCCESS;
+}
+
+/**
+ * @fn static void groupManagerWriteEntry(FILE *filePtr, const groupManager_t *groupManager, const groupEntry_t *entry)
+ * @brief 그룹 하나의 등급 분포를 결과 파일의 한 줄로 쓰는 함수
+ * 최소, 최대, 평균은 등급 전체 범위 안의 점수만으로 계산하고 배율에 맞춰 출력한다. (없으면 -)
+ * groupManagerWriteFile 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param filePtr 결과 파일 스트림(입력)
+ * @param groupManager 그룹 집계 구조체(입력, 읽기 전용)
+ * @param entry 출력할 그룹 항목(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void groupManagerWriteEntry(FILE *filePtr, const groupManager_t *groupManager, const groupEntry_t *entry)
+{
+	const gradeStats_t *stats = &(entry->stats);
+	long long validNum = stats->total - stats->count[gradeManagerGetGradeIndex('?')];
+	int index = 0;
+
+	fprintf(filePtr, "%s\t%d\t%lld", (entry->level == 0) ? GROUP_TOTAL_NAME : entry->key, entry->level, stats->total);
+	for( ; index < GRADE_KIND_NUM; index++)
+	{
+		fprintf(filePtr, "\t%lld", stats->count[index]);
+	}
+
+	if(validNum > 0)
+	{
+		char minText[GRADE_SCORE_TEXT_LEN];
+		char maxText[GRADE_SCORE_TEXT_LEN];
+		gradeManagerFormatScore(groupManager->gradeManager, stats->min, minText, sizeof(minText));
+		gradeManagerFormatScore(groupManager->gradeManager, stats->max, maxText, sizeof(maxText));
+		fprintf(filePtr, "\t%s\t%s\t%.2f\n", minText, maxText, (double)stats->sum / (double)validNum / (double)groupManager->gradeManager->scale);
+	}
+	else
+	{
+		fprintf(filePtr, "\t-\t-\t-\n");
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int isBlank(char c)
+ * @brief 레코드의 필드 구분 문자인지 확인하는 함수
+ * @param c 확인할 문자(입력)
+ * @return 구분 문자면 TRUE, 아니면 FALSE 반환
+ */
+static int isBlank(char c)
+{
+	return (c == ' ' || c == '\t' || c == '\r') ? TRUE : FALSE;
+}
+
+/**
+ * @fn static int compareGroupEntry(const void *entry1, const void *entry2)
+ * @brief qsort 에서 그룹 항목 포인터들을 그룹 키 순서로 비교하는 함수
+ * @param entry1 비교할 첫 번째 항목 포인터의 주소(입력, 읽기 전용)
+ * @param entry2 비교할 두 번째 항목 포인터의 주소(입력, 읽기 전용)
+ * @return 첫 번째 키가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int compareGroupEntry(const void *entry1, const void *entry2)
+{
+	const groupEntry_t *first = *(const groupEntry_t *const *)entry1;
+	const groupEntry_t *second = *(const groupEntry_t *const *)entry2;
+
+	return strcmp(first->key, second->key);
+}
+
+/**
+ * @fn static double getElapsedSec(const struct timespec *startTime, const struct timespec *endTime)
+ * @brief 두 시각 사이의 경과 시간을 초 단위로 구하는 함수
+ * @param startTime 시작 시각(입력, 읽기 전용)
+ * @param endTime 끝 시각(입력, 읽기 전용)
+ * @return 경과 시간(초) 반환
+ */
+static double getElapsedSec(const struct timespec *startTime, const struct timespec *endTime)
+{
+	return (double)(endTime->tv_sec - startTime->tv_sec) + (double)(endTime->tv_nsec - startTime->tv_nsec) / 1e9;
+}
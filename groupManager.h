@@ -0,0 +1,133 @@
+#ifndef __GROUP_MANAGER_H__
+#define __GROUP_MANAGER_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 해시 테이블 처음 크기 (2 의 거듭제곱, 항목이 절반을 넘으면 두 배로 늘린다)
+#define GROUP_INIT_SLOT_NUM		1024
+// 그룹 키 최대 길이 (필드들을 공백 하나로 이은 길이, 넘는 레코드는 건너뛴다)
+#define GROUP_KEY_LEN			256
+// 작업 스레드 최대 개수
+#define GROUP_MAX_THREAD_NUM	64
+// 결과 파일에서 전체 합계(필드가 없는 키)를 나타내는 이름
+#define GROUP_TOTAL_NAME		"*"
+
+/**
+ * @struct groupEntry_t
+ * @brief 그룹 키 하나와 그 그룹의 등급 통계를 저장하는 해시 테이블 항목 구조체
+ */
+typedef struct groupEntry_s groupEntry_t;
+struct groupEntry_s
+{
+	// 그룹 키 (필드들을 공백 하나로 이은 문자열, 전체 합계는 빈 문자열, NULL 이면 빈 자리)
+	char *key;
+	// 그룹 키 길이
+	int keyLength;
+	// 그룹 키의 필드 개수 (0 이면 전체 합계)
+	int level;
+	// 그룹 키 해시
+	uint64_t hash;
+	// 그룹의 등급 통계
+	gradeStats_t stats;
+};
+
+/**
+ * @struct groupTable_t
+ * @brief 그룹 키로 등급 통계를 찾는 선형 탐사(open addressing) 해시 테이블 구조체
+ * 항목을 배열에 직접 담아서 찾을 때 포인터를 한 번 덜 따라간다. 항목을 지우지 않으므로 삭제 처리는 없다.
+ */
+typedef struct groupTable_s groupTable_t;
+struct groupTable_s
+{
+	// 항목 배열 (key 가 NULL 이면 빈 자리)
+	groupEntry_t *slotList;
+	// 항목 배열 크기 (2 의 거듭제곱)
+	int slotNum;
+	// 사용 중인 항목 개수
+	int entryNum;
+};
+
+typedef struct groupManager_s groupManager_t;
+
+/**
+ * @struct groupWorker_t
+ * @brief 입력 파일의 한 구간을 맡아 자기 해시 테이블에만 집계하는 작업 스레드 구조체
+ */
+typedef struct groupWorker_s groupWorker_t;
+struct groupWorker_s
+{
+	// 그룹 집계 구조체 (읽기 전용으로 공유)
+	const groupManager_t *groupManager;
+	// 맡은 구간의 시작 위치 (레코드 경계)
+	size_t begin;
+	// 맡은 구간의 끝 위치 (레코드 경계)
+	size_t end;
+	// 스레드별 해시 테이블 (잠금 없이 이 스레드만 갱신)
+	groupTable_t table;
+	// 집계한 레코드 개수
+	long long recordNum;
+	// 키가 GROUP_KEY_LEN 보다 길어서 건너뛴 레코드 개수
+	long long skipNum;
+	// 처리 결과 (SUCCESS 또는 FAIL)
+	int result;
+};
+
+/**
+ * @struct groupManager_t
+ * @brief (그룹 필드 ...) (점수) 레코드들의 등급 분포를 그룹별로 한 번에 집계하고 상위 단계로 합치는 구조체
+ * <처리 흐름>
+ * 매핑된 입력 파일 -> 레코드 경계로 나눈 구간마다 작업 스레드 (스레드별 해시 테이블) -> 병합 -> 상위 단계 합계 -> 키 순서 정렬
+ * 점수 앞의 필드들이 그룹 키이며, 예를 들어 "CS 101 A 87" 은 "CS 101 A" 그룹에 집계된 뒤 "CS 101", "CS", 전체 합계에 합쳐진다.
+ * 레코드마다 가장 세부적인 그룹 하나만 갱신하고 상위 단계는 병합한 뒤 그룹 단위로 합치므로 입력은 한 번만 읽는다.
+ */
+struct groupManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 입력 파일 이름
+	char fileName[PATH_MAX];
+	// 매핑된 입력 파일 (비어있으면 NULL)
+	char *data;
+	// 입력 파일 크기
+	size_t size;
+	// 그룹 키로 쓸 앞쪽 필드 개수 (0 이면 점수 앞의 모든 필드)
+	int keyFieldNum;
+	// 작업 스레드 개수
+	int threadNum;
+	// 병합하고 상위 단계 합계를 더한 해시 테이블
+	groupTable_t table;
+	// 키 순서로 정렬한 항목 목록 (상위 그룹이 하위 그룹보다 앞)
+	const groupEntry_t **sortedList;
+	// 레코드에서 바로 집계된 그룹 개수 (상위 단계 합계 제외)
+	int leafNum;
+	// 가장 깊은 그룹 단계
+	int maxLevel;
+	// 집계한 레코드 개수
+	long long recordNum;
+	// 키가 너무 길어서 건너뛴 레코드 개수
+	long long skipNum;
+	// 스레드별 집계에 걸린 시간 (초)
+	double scanSec;
+	// 병합, 상위 단계 합계, 정렬에 걸린 시간 (초)
+	double mergeSec;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for groupManager_t
+//////////////////////////////////////////////////////////////////////////
+
+groupManager_t* groupManagerNew(const gradeManager_t *gradeManager, const char *fileName, int keyFieldNum, int threadNum);
+void groupManagerDelete(groupManager_t **groupManager);
+int groupManagerRun(groupManager_t *groupManager);
+int groupManagerWriteFile(const groupManager_t *groupManager, const char *outputFileName);
+void groupManagerPrintSummary(FILE *filePtr, const groupManager_t *groupManager);
+
+#endif // #ifndef __GROUP_MANAGER_H__
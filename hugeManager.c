@@ -0,0 +1,336 @@
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "gradeManager.h"
+#include "hugeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Global Variables
+//////////////////////////////////////////////////////////////////////////
+
+// 큰 페이지 사용 방식 (HUGE_MODE, -1 이면 아직 환경 변수를 읽지 않음)
+static int hugeMode = -1;
+// 할당할 때 페이지를 미리 채울지 여부 (TRUE 또는 FALSE)
+static int hugePrefault = FALSE;
+// MAP_HUGETLB 가 한 번 실패했는지 여부 (TRUE 면 이후에는 시도하지 않고 바로 THP 를 사용)
+static int hugeTlbFailed = FALSE;
+// 블록 종류별 집계
+static hugeStats_t hugeStats;
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for Huge Page Buffer
+//////////////////////////////////////////////////////////////////////////
+
+static hugeHeader_t* hugeMap(size_t mapSize, int mode, int *kind);
+static void hugePrefaultRange(char *data, size_t size);
+static size_t hugeGetMapSize(size_t size);
+static void hugeStatsAdd(int kind, size_t bytes);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for Huge Page Buffer
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void* hugeAlloc(size_t size)
+ * @brief 큰 점수 배열, 등급 배열, 구간 버퍼용 메모리를 할당하는 함수
+ * HUGE_MIN_SIZE 이상이면 MAP_HUGETLB 로 예약된 큰 페이지를 먼저 시도하고, 실패하면 큰 페이지 경계에 맞춘 익명 매핑에
+ * THP 를 요청한다. 작은 버퍼나 HUGE_MODE_OFF 이면 malloc 을 사용한다. 어느 경우든 hugeFree 로 해제한다.
+ * 페이지 테이블 단계와 TLB 항목 수가 줄어서 큰 배열을 순차로 지날 때의 page walk 와 TLB miss 가 줄어든다.
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 사용자 영역의 주소(64 바이트 경계), 실패 시 NULL 반환
+ */
+void* hugeAlloc(size_t size)
+{
+	if(size > SIZE_MAX - sizeof(hugeHeader_t) - HUGE_PAGE_SIZE) return NULL;
+
+	int mode = hugeGetMode();
+	int kind = HUGE_KIND_HEAP;
+	size_t mapSize = 0;
+	hugeHeader_t *header = NULL;
+
+	if(mode == HUGE_MODE_OFF || size < HUGE_MIN_SIZE)
+	{
+		header = (hugeHeader_t*)malloc(sizeof(hugeHeader_t) + size);
+	}
+	else
+	{
+		mapSize = hugeGetMapSize(size);
+		header = hugeMap(mapSize, mode, &kind);
+	}
+	if(header == NULL) return NULL;
+
+	header->info.size = size;
+	header->info.mapSize = mapSize;
+	header->info.kind = kind;
+	hugeStatsAdd(kind, (kind == HUGE_KIND_HEAP) ? sizeof(hugeHeader_t) + size : mapSize);
+	return header + 1;
+}
+
+/**
+ * @fn void* hugeRealloc(void *ptr, size_t size)
+ * @brief hugeAlloc 으로 할당한 블록의 크기를 바꾸는 함수
+ * 매핑한 블록은 같은 큰 페이지 개수 안이면 그대로 두고, THP 나 일반 매핑이면 mremap 으로 늘린다.
+ * 그 밖에(예약된 큰 페이지, malloc 과 매핑 사이를 오가는 경우) 새로 할당해서 복사한다.
+ * 실패하면 realloc 과 같이 이전 블록은 그대로 남는다.
+ * @param ptr 크기를 바꿀 사용자 영역의 주소(입력, NULL 이면 새로 할당)
+ * @param size 새 크기(입력)
+ * @return 성공 시 사용자 영역의 주소, 실패 시 NULL 반환
+ */
+void* hugeRealloc(void *ptr, size_t size)
+{
+	if(ptr == NULL) return hugeAlloc(size);
+	if(size > SIZE_MAX - sizeof(hugeHeader_t) - HUGE_PAGE_SIZE) return NULL;
+
+	hugeHeader_t *header = (hugeHeader_t*)ptr - 1;
+	int kind = header->info.kind;
+	int mapped = (hugeGetMode() != HUGE_MODE_OFF && size >= HUGE_MIN_SIZE) ? TRUE : FALSE;
+
+	if(kind == HUGE_KIND_HEAP && mapped == FALSE)
+	{
+		hugeHeader_t *newHeader = (hugeHeader_t*)realloc(header, sizeof(hugeHeader_t) + size);
+		if(newHeader == NULL) return NULL;
+
+		newHeader->info.size = size;
+		hugeStatsAdd(HUGE_KIND_HEAP, sizeof(hugeHeader_t) + size);
+		return newHeader + 1;
+	}
+
+	if(kind != HUGE_KIND_HEAP && mapped == TRUE)
+	{
+		size_t oldMapSize = header->info.mapSize;
+		size_t mapSize = hugeGetMapSize(size);
+		if(mapSize == oldMapSize)
+		{
+			header->info.size = size;
+			return ptr;
+		}
+
+		// 예약된 큰 페이지는 mremap 지원이 커널마다 달라서 새로 할당한다.
+		if(kind != HUGE_KIND_HUGETLB)
+		{
+			void *moved = mremap(header, oldMapSize, mapSize, MREMAP_MAYMOVE);
+			if(moved != MAP_FAILED)
+			{
+				header = (hugeHeader_t*)moved;
+				header->info.size = size;
+				header->info.mapSize = mapSize;
+				if(mapSize > oldMapSize && __atomic_load_n(&hugePrefault, __ATOMIC_RELAXED) == TRUE)
+				{
+					hugePrefaultRange((char*)header + oldMapSize, mapSize - oldMapSize);
+				}
+				hugeStatsAdd(kind, mapSize);
+				return header + 1;
+			}
+		}
+	}
+
+	void *newPtr = hugeAlloc(size);
+	if(newPtr == NULL) return NULL;
+
+	memcpy(newPtr, ptr, (header->info.size < size) ? header->info.size : size);
+	hugeFree(ptr);
+	return newPtr;
+}
+
+/**
+ * @fn void hugeFree(void *ptr)
+ * @brief hugeAlloc, hugeRealloc 으로 할당한 블록을 종류에 맞게(free 또는 munmap) 해제하는 함수
+ * @param ptr 해제할 사용자 영역의 주소(입력, NULL 이면 아무 것도 하지 않음)
+ * @return 반환값 없음
+ */
+void hugeFree(void *ptr)
+{
+	if(ptr == NULL) return;
+
+	hugeHeader_t *header = (hugeHeader_t*)ptr - 1;
+	if(header->info.kind == HUGE_KIND_HEAP) free(header);
+	else munmap(header, header->info.mapSize);
+}
+
+/**
+ * @fn int hugeGetMode(void)
+ * @brief 큰 페이지 사용 방식을 반환하는 함수
+ * 처음 호출할 때 HUGE_MODE_ENV, HUGE_PREFAULT_ENV 환경 변수를 한 번 읽고, 이후에는 바뀌지 않는다.
+ * @return 큰 페이지 사용 방식 반환 (HUGE_MODE)
+ */
+int hugeGetMode(void)
+{
+	int mode = __atomic_load_n(&hugeMode, __ATOMIC_ACQUIRE);
+	if(mode >= 0) return mode;
+
+	// 여러 스레드가 동시에 읽어도 같은 값을 저장하므로 잠그지 않는다.
+	const char *value = getenv(HUGE_MODE_ENV);
+	mode = HUGE_MODE_AUTO;
+	if(value != NULL && (strcmp(value, "off") == 0 || strcmp(value, "0") == 0)) mode = HUGE_MODE_OFF;
+	else if(value != NULL && strcmp(value, "thp") == 0) mode = HUGE_MODE_THP;
+	else if(value != NULL && strcmp(value, "auto") != 0)
+	{
+		printf("[ERROR] 알 수 없는 큰 페이지 사용 방식이라 auto 로 처리. (%s:%s)\n", HUGE_MODE_ENV, value);
+	}
+
+	__atomic_store_n(&hugePrefault, (getenv(HUGE_PREFAULT_ENV) != NULL) ? TRUE : FALSE, __ATOMIC_RELAXED);
+	__atomic_store_n(&hugeMode, mode, __ATOMIC_RELEASE);
+	return mode;
+}
+
+/**
+ * @fn const char* hugeGetModeName(int mode)
+ * @brief 큰 페이지 사용 방식의 이름을 반환하는 함수
+ * @param mode 큰 페이지 사용 방식(입력, HUGE_MODE)
+ * @return 방식 이름 문자열 반환
+ */
+const char* hugeGetModeName(int mode)
+{
+	switch(mode)
+	{
+		case HUGE_MODE_OFF: return "off";
+		case HUGE_MODE_THP: return "thp";
+		default: return "auto";
+	}
+}
+
+/**
+ * @fn void hugeGetStats(hugeStats_t *stats)
+ * @brief 블록 종류별 할당 집계를 복사하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param stats 집계를 저장할 구조체(출력)
+ * @return 반환값 없음
+ */
+void hugeGetStats(hugeStats_t *stats)
+{
+	if(stats == NULL)
+	{
+		printf("[DEBUG] stats 가 NULL.\n");
+		return;
+	}
+
+	int kind = 0;
+	for( ; kind < HUGE_KIND_NUM; kind++)
+	{
+		stats->allocNum[kind] = __atomic_load_n(&(hugeStats.allocNum[kind]), __ATOMIC_RELAXED);
+		stats->byteNum[kind] = __atomic_load_n(&(hugeStats.byteNum[kind]), __ATOMIC_RELAXED);
+	}
+	stats->fallbackNum = __atomic_load_n(&(hugeStats.fallbackNum), __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn void hugePrintSummary(FILE *filePtr)
+ * @brief 큰 페이지 사용 방식과 블록 종류별 할당 횟수, 할당한 크기를 한 줄로 출력하는 함수
+ * 크기 변경은 새 크기로 한 번 더 센다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터에 대한 NULL 체크를 수행한다.
+ * @param filePtr 출력할 파일(입력)
+ * @return 반환값 없음
+ */
+void hugePrintSummary(FILE *filePtr)
+{
+	if(filePtr == NULL)
+	{
+		printf("[DEBUG] filePtr 가 NULL.\n");
+		return;
+	}
+
+	hugeStats_t stats;
+	hugeGetStats(&stats);
+
+	int mode = hugeGetMode();
+	fprintf(filePtr, "[큰 페이지] (mode:%s, prefault:%s, hugetlb:%lld/%.1fMB, thp:%lld/%.1fMB, page:%lld/%.1fMB, heap:%lld/%.1fMB, fallback:%lld)\n",
+		hugeGetModeName(mode), (__atomic_load_n(&hugePrefault, __ATOMIC_RELAXED) == TRUE) ? "on" : "off",
+		stats.allocNum[HUGE_KIND_HUGETLB], (double)stats.byteNum[HUGE_KIND_HUGETLB] / (1024.0 * 1024.0),
+		stats.allocNum[HUGE_KIND_THP], (double)stats.byteNum[HUGE_KIND_THP] / (1024.0 * 1024.0),
+		stats.allocNum[HUGE_KIND_PAGE], (double)stats.byteNum[HUGE_KIND_PAGE] / (1024.0 * 1024.0),
+		stats.allocNum[HUGE_KIND_HEAP], (double)stats.byteNum[HUGE_KIND_HEAP] / (1024.0 * 1024.0),
+		stats.fallbackNum);
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for Huge Page Buffer
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static hugeHeader_t* hugeMap(size_t mapSize, int mode, int *kind)
+ * @brief 큰 페이지로 채울 익명 매핑을 만드는 함수
+ * HUGE_MODE_AUTO 면 MAP_HUGETLB 를 먼저 시도하고(예약된 큰 페이지가 없으면 바로 실패한다, 한 번 실패하면 다시 시도하지 않음), 실패하거나 HUGE_MODE_THP 면
+ * 한 페이지 더 매핑한 뒤 앞뒤를 잘라 큰 페이지 경계에 맞추고 madvise(MADV_HUGEPAGE) 를 요청한다.
+ * hugeAlloc 함수에서 호출되기 때문에 전달받은 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param mapSize 매핑할 크기(입력, 큰 페이지 크기의 배수)
+ * @param mode 큰 페이지 사용 방식(입력, HUGE_MODE)
+ * @param kind 만든 블록의 종류(출력, HUGE_KIND)
+ * @return 성공 시 매핑 시작 주소, 실패 시 NULL 반환
+ */
+static hugeHeader_t* hugeMap(size_t mapSize, int mode, int *kind)
+{
+	int prefault = __atomic_load_n(&hugePrefault, __ATOMIC_RELAXED);
+
+	if(mode == HUGE_MODE_AUTO && __atomic_load_n(&hugeTlbFailed, __ATOMIC_RELAXED) == FALSE)
+	{
+		void *mapped = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | ((prefault == TRUE) ? MAP_POPULATE : 0), -1, 0);
+		if(mapped != MAP_FAILED)
+		{
+			*kind = HUGE_KIND_HUGETLB;
+			return (hugeHeader_t*)mapped;
+		}
+		__atomic_store_n(&hugeTlbFailed, TRUE, __ATOMIC_RELAXED);
+		__atomic_add_fetch(&(hugeStats.fallbackNum), 1, __ATOMIC_RELAXED);
+	}
+
+	// THP 는 큰 페이지 경계에 맞춘 구간에만 적용되므로 경계를 맞춘다.
+	size_t reserveSize = mapSize + HUGE_PAGE_SIZE;
+	void *reserved = mmap(NULL, reserveSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(reserved == MAP_FAILED) return NULL;
+
+	size_t headSize = (HUGE_PAGE_SIZE - (size_t)((uintptr_t)reserved % HUGE_PAGE_SIZE)) % HUGE_PAGE_SIZE;
+	char *data = (char*)reserved + headSize;
+	if(headSize > 0) munmap(reserved, headSize);
+	if(reserveSize - headSize > mapSize) munmap(data + mapSize, reserveSize - headSize - mapSize);
+
+	*kind = (madvise(data, mapSize, MADV_HUGEPAGE) == 0) ? HUGE_KIND_THP : HUGE_KIND_PAGE;
+	if(prefault == TRUE) hugePrefaultRange(data, mapSize);
+	return (hugeHeader_t*)data;
+}
+
+/**
+ * @fn static void hugePrefaultRange(char *data, size_t size)
+ * @brief 매핑한 구간의 페이지마다 한 바이트씩 써서 페이지 폴트를 미리 일으키는 함수
+ * THP 구간은 큰 페이지 하나의 첫 폴트에서 전체가 채워지므로 나머지 쓰기는 폴트 없이 끝난다.
+ * @param data 구간 시작 주소(입력 및 출력)
+ * @param size 구간 크기(입력)
+ * @return 반환값 없음
+ */
+static void hugePrefaultRange(char *data, size_t size)
+{
+	long pageSize = sysconf(_SC_PAGESIZE);
+	size_t step = (pageSize > 0) ? (size_t)pageSize : 4096;
+
+	size_t offset = 0;
+	for( ; offset < size; offset += step)
+	{
+		((volatile char*)data)[offset] = 0;
+	}
+}
+
+/**
+ * @fn static size_t hugeGetMapSize(size_t size)
+ * @brief 헤더를 포함한 크기를 큰 페이지 크기의 배수로 올린 매핑 크기를 계산하는 함수
+ * @param size 사용자가 요청한 크기(입력)
+ * @return 매핑 크기 반환
+ */
+static size_t hugeGetMapSize(size_t size)
+{
+	size_t totalSize = sizeof(hugeHeader_t) + size;
+	return (totalSize + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+}
+
+/**
+ * @fn static void hugeStatsAdd(int kind, size_t bytes)
+ * @brief 블록 종류별 할당 횟수와 크기를 원자적으로 더하는 함수
+ * @param kind 블록 종류(입력, HUGE_KIND)
+ * @param bytes 할당한 크기(입력)
+ * @return 반환값 없음
+ */
+static void hugeStatsAdd(int kind, size_t bytes)
+{
+	__atomic_add_fetch(&(hugeStats.allocNum[kind]), 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&(hugeStats.byteNum[kind]), (long long)bytes, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,88 @@
+#ifndef __HUGE_MANAGER_H__
+#define __HUGE_MANAGER_H__
+
+#include <stdio.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 큰 페이지 사용 방식을 지정하는 환경 변수 (off, thp, auto, 기본 auto)
+#define HUGE_MODE_ENV		"GRADE_HUGEPAGE"
+// 이 환경 변수가 설정되어 있으면 할당할 때 모든 페이지를 미리 채운다. (첫 접근의 페이지 폴트를 측정 구간 밖으로 옮긴다)
+#define HUGE_PREFAULT_ENV	"GRADE_HUGEPAGE_PREFAULT"
+// 큰 페이지 크기 (바이트, x86-64 와 arm64 의 기본 크기)
+#define HUGE_PAGE_SIZE		(2 * 1024 * 1024)
+// 이 크기 이상인 버퍼만 페이지 단위로 매핑한다. (작은 버퍼는 malloc)
+#define HUGE_MIN_SIZE		HUGE_PAGE_SIZE
+// 블록 앞에 붙는 헤더 크기 (사용자 영역이 캐시 라인 경계에서 시작하도록 맞춘다)
+#define HUGE_HEADER_SIZE	64
+
+// 큰 페이지 사용 방식 열거형
+enum HUGE_MODE
+{
+	HUGE_MODE_OFF = 0,	// 모든 버퍼를 malloc 으로 할당 (비교 측정용)
+	HUGE_MODE_THP,		// 익명 매핑에 madvise(MADV_HUGEPAGE) 로 투명 큰 페이지(THP) 요청
+	HUGE_MODE_AUTO		// 예약된 큰 페이지(MAP_HUGETLB)를 먼저 시도하고 없으면 THP 로 대체
+};
+
+// 할당된 블록의 종류 열거형 (해제와 크기 변경 방식을 정한다)
+enum HUGE_KIND
+{
+	HUGE_KIND_HEAP = 0,	// malloc
+	HUGE_KIND_PAGE,		// 일반 페이지 익명 매핑 (THP 요청 실패)
+	HUGE_KIND_THP,		// THP 를 요청한 익명 매핑
+	HUGE_KIND_HUGETLB,	// 예약된 큰 페이지 매핑
+	HUGE_KIND_NUM
+};
+
+/**
+ * @struct hugeHeader_t
+ * @brief 큰 페이지 버퍼 앞에 붙는 헤더 구조체
+ * 해제할 때 크기를 따로 넘기지 않아도 되도록 블록 종류와 매핑 크기를 기록한다.
+ */
+typedef union hugeHeader_u hugeHeader_t;
+union hugeHeader_u
+{
+	struct
+	{
+		// 사용자가 요청한 크기
+		size_t size;
+		// 매핑한 전체 크기 (헤더 포함, 큰 페이지 크기의 배수, malloc 이면 0)
+		size_t mapSize;
+		// 블록 종류 (HUGE_KIND)
+		int kind;
+	} info;
+	// 정렬용
+	char align[HUGE_HEADER_SIZE];
+};
+
+/**
+ * @struct hugeStats_t
+ * @brief 블록 종류별 할당 집계 구조체 (여러 스레드가 원자적으로 갱신한다)
+ */
+typedef struct hugeStats_s hugeStats_t;
+struct hugeStats_s
+{
+	// 종류별 할당 횟수
+	long long allocNum[HUGE_KIND_NUM];
+	// 종류별 할당한 전체 바이트 수 (헤더 포함)
+	long long byteNum[HUGE_KIND_NUM];
+	// MAP_HUGETLB 가 실패해서 THP 로 대체한 횟수 (한 번 실패하면 다시 시도하지 않으므로 보통 스레드 수 이하)
+	long long fallbackNum;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for Huge Page Buffer
+//////////////////////////////////////////////////////////////////////////
+
+void* hugeAlloc(size_t size);
+void* hugeRealloc(void *ptr, size_t size);
+void hugeFree(void *ptr);
+int hugeGetMode(void);
+const char* hugeGetModeName(int mode);
+void hugeGetStats(hugeStats_t *stats);
+void hugePrintSummary(FILE *filePtr);
+
+#endif // #ifndef __HUGE_MANAGER_H__
@@ -7,7 +7,8 @@
 static iniKey_t* iniKeyNew(const char *fieldName, const char *keyName);
 static void iniKeyDelete(iniKey_t **key);
 static int iniKeyGetValue(const iniKey_t *key);
-static void iniKeySetValue(iniKey_t *key, int value);
+static void iniKeySetValue(iniKey_t *key, int value, const char *valueText);
+static const char* iniKeyGetValueText(const iniKey_t *key);
 static const char* iniKeyGetName(const iniKey_t *key);
 
 //////////////////////////////////////////////////////////////////////////
@@ -19,7 +20,7 @@ static void iniFieldDelete(iniField_t **field);
 static iniKey_t* iniFieldGetKeyFromListByName(const iniField_t *field, const char *keyName);
 static iniKey_t* iniFieldGetKeyFromListByIndex(const iniField_t *field, int index);
 static int iniFieldInitializeKeyList(iniField_t *field, int keyMaxNum);
-static int iniFieldStoreKeyInList(iniField_t *field, int keyIndex, const char *keyName, int value);
+static int iniFieldStoreKeyInList(iniField_t *field, int keyIndex, const char *keyName, int value, const char *valueText);
 static const char* iniFieldGetName(const iniField_t *field);
 
 //////////////////////////////////////////////////////////////////////////
@@ -27,9 +28,10 @@ static const char* iniFieldGetName(const iniField_t *field);
 //////////////////////////////////////////////////////////////////////////
 
 static int iniManagerLoadInfoFromINI(iniManager_t *iniManager, const char *fileName);
-static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, const char *fileName);
-static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, const char *fileName);
+static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, FILE *filePtr);
+static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, FILE *filePtr);
 static int iniManagerFindFieldFromList(const iniManager_t *iniManager, const char *field);
+static const iniField_t* iniManagerGetField(const iniManager_t *iniManager, const char *fieldName);
 
 //////////////////////////////////////////////////////////////////////////
 /// Public Functions for iniManager_t
@@ -46,25 +48,25 @@ iniManager_t *iniManagerNew(const char *fileName)
 {
 	if(fileName == NULL)
 	{
-		printf("[DEBUG] 주어진 fileName 이 NULL.\n");
+		LOG_DEBUG("[DEBUG] 주어진 fileName 이 NULL.\n");
 		return NULL;
 	}
 
-	iniManager_t *iniManager = (iniManager_t*)malloc(sizeof(iniManager_t));
+	iniManager_t *iniManager = (iniManager_t*)MEM_MALLOC(MEM_SUBSYSTEM_INI, sizeof(iniManager_t));
 	if(iniManager == NULL)
 	{
-		printf("[DEBUG] iniManager 객체 동적 생성 실패. NULL.\n");
+		LOG_DEBUG("[DEBUG] iniManager 객체 동적 생성 실패. NULL.\n");
 		return NULL;
 	}
 
-	printf("\n[ini 파일의 필드 로딩 중...]\n");
+	LOG_INFO("\n[ini 파일의 필드 로딩 중...]\n");
 
 	iniManager->fieldMaxNum = 0;
 	iniManager->fieldList = NULL;
 
 	if(iniManagerLoadInfoFromINI(iniManager, fileName) == FAIL)
 	{
-		printf("[로딩 실패]\n\n");
+		LOG_INFO("[로딩 실패]\n\n");
 		iniManagerDelete(&iniManager);
 		return NULL;
 	}
@@ -72,18 +74,22 @@ iniManager_t *iniManagerNew(const char *fileName)
 	int fieldIndex = 0;
 	int keyIndex = 0;
 
-	printf("\n[로딩된 데이터]\n");
+	LOG_INFO("\n[로딩된 데이터]\n");
 	for( ; fieldIndex < iniManager->fieldMaxNum; fieldIndex++)
 	{
 		int keyMaxNum = ((iniManager->fieldList)[fieldIndex])->keyMaxNum;
-		printf("Loaded field : %s\n", iniFieldGetName((iniManager->fieldList)[fieldIndex]));
+		LOG_INFO("Loaded field : %s\n", iniFieldGetName((iniManager->fieldList)[fieldIndex]));
 		for(keyIndex = 0; keyIndex < keyMaxNum; keyIndex++)
 		{
 			iniKey_t *key = iniFieldGetKeyFromListByIndex((iniManager->fieldList)[fieldIndex], keyIndex);
-			printf("\t%s = %d\n", key->name, key->value);
+			if(key == NULL) continue;
+			LOG_INFO("\t%s = %s\n", key->name, key->valueText);
 		}
 	}
-	printf("[로딩 완료]\n");
+	LOG_INFO("[로딩 완료]\n");
+
+	// 로딩 과정 메시지가 호출한 쪽의 결과 출력보다 먼저 나오도록 기다린다.
+	logFlush();
 
 	return iniManager;
 }
@@ -99,7 +105,7 @@ void iniManagerDelete(iniManager_t **iniManager)
 {
 	if(*iniManager == NULL)
 	{
-		printf("[DEBUG] iniManager 해제 실패. 객체가 NULL.\n");
+		LOG_DEBUG("[DEBUG] iniManager 해제 실패. 객체가 NULL.\n");
 		return;
 	}
 
@@ -114,11 +120,11 @@ void iniManagerDelete(iniManager_t **iniManager)
 			}
 		}
 
-		free((*iniManager)->fieldList);
+		MEM_FREE((*iniManager)->fieldList);
 		(*iniManager)->fieldList = NULL;
 	}
 
-	free(*iniManager);
+	MEM_FREE(*iniManager);
 	*iniManager = NULL;
 }
 
@@ -139,13 +145,13 @@ int iniManagerGetValueFromField(const iniManager_t *iniManager, const char *fiel
 {
 	if(iniManager == NULL || fieldName == NULL || keyName == NULL || fileName == NULL || result == NULL)
 	{
-		printf("[DEBUG] 매개변수 참조 오류. (iniManager:%p, field:%p, key:%p, fileName:%p, result:%p)\n", iniManager, fieldName, keyName, fileName, result);
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (iniManager:%p, field:%p, key:%p, fileName:%p, result:%p)\n", iniManager, fieldName, keyName, fileName, result);
 		return FAIL;
 	}
 
 	if(iniManagerFindFieldFromList(iniManager, fieldName) == FAIL)
 	{
-		printf("[ERROR] ini 필드 리스트부터 주어진 필드 검색 실패. (fileName:%s, field:%s)\n", fileName, fieldName);
+		LOG_ERROR("[ERROR] ini 필드 리스트부터 주어진 필드 검색 실패. (fileName:%s, field:%s)\n", fileName, fieldName);
 		return FAIL;
 	}
 
@@ -158,7 +164,7 @@ int iniManagerGetValueFromField(const iniManager_t *iniManager, const char *fiel
 		iniField_t *field = iniManager->fieldList[fieldIndex];
 		if(field == NULL)
 		{
-			printf("[DEBUG] iniField 객체 참조 실패. NULL. (fieldIndex:%d)\n", fieldIndex);
+			LOG_DEBUG("[DEBUG] iniField 객체 참조 실패. NULL. (fieldIndex:%d)\n", fieldIndex);
 			break;
 		}
 		if(strncmp(field->name, fieldName, MAX_FIELD_LEN) != 0) continue;
@@ -173,10 +179,189 @@ int iniManagerGetValueFromField(const iniManager_t *iniManager, const char *fiel
 		}
 	}
 
-	if(*result == FAIL) printf("[ERROR] 지정한 필드에 대한 키의 값을 찾을 수 없음. (field:%s, key:%s, fileName:%s)\n", fieldName, keyName, fileName);
+	if(*result == FAIL) LOG_ERROR("[ERROR] 지정한 필드에 대한 키의 값을 찾을 수 없음. (field:%s, key:%s, fileName:%s)\n", fieldName, keyName, fileName);
+	return returnValue;
+}
+
+/**
+ * @fn int iniManagerGetFixedValueFromField(const iniManager_t *iniManager, const char *fieldName, const char *keyName, int scale, int defaultValue, const char *fileName, int *result)
+ * @brief 지정한 필드에 대한 키의 값을 소수점까지 읽어서 scale 배 한 고정 소수점 정수로 반환하는 함수
+ * 예) scale 이 10 일 때 "87.5" -> 875, "90" -> 900
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param iniManager ini 파일 내용을 저장하는 구조체(입력, 읽기 전용)
+ * @param fieldName 키를 찾기 위한 필드 이름(입력, 읽기 전용)
+ * @param keyName 값을 찾기 위한 키 이름(입력, 읽기 전용)
+ * @param scale 고정 소수점 배율(입력, 10 의 거듭제곱)
+ * @param defaultValue 찾고자 하는 키에 대한 값이 존재하지 않을 때 반환될 값(입력, 이미 scale 배 한 값)
+ * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용)
+ * @param result 함수 실행 성공 여부(출력, 성공 시 SUCCESS, 실패 시 FAIL 저장)
+ * @return 성공 시 지정한 필드에 대한 키의 고정 소수점 값, 실패 시 FAIL 반환
+ */
+int iniManagerGetFixedValueFromField(const iniManager_t *iniManager, const char *fieldName, const char *keyName, int scale, int defaultValue, const char *fileName, int *result)
+{
+	if(iniManager == NULL || fieldName == NULL || keyName == NULL || fileName == NULL || result == NULL)
+	{
+		LOG_DEBUG("[DEBUG] 매개변수 참조 오류. (iniManager:%p, field:%p, key:%p, fileName:%p, result:%p)\n", iniManager, fieldName, keyName, fileName, result);
+		return FAIL;
+	}
+
+	if(iniManagerFindFieldFromList(iniManager, fieldName) == FAIL)
+	{
+		LOG_ERROR("[ERROR] ini 필드 리스트부터 주어진 필드 검색 실패. (fileName:%s, field:%s)\n", fileName, fieldName);
+		return FAIL;
+	}
+
+	int fieldIndex = 0;
+	int returnValue = defaultValue;
+
+	for( ; fieldIndex < iniManager->fieldMaxNum; fieldIndex++)
+	{
+		iniField_t *field = iniManager->fieldList[fieldIndex];
+		if(field == NULL)
+		{
+			LOG_DEBUG("[DEBUG] iniField 객체 참조 실패. NULL. (fieldIndex:%d)\n", fieldIndex);
+			break;
+		}
+		if(strncmp(field->name, fieldName, MAX_FIELD_LEN) != 0) continue;
+
+		iniKey_t *key = iniFieldGetKeyFromListByName(field, keyName);
+		if(key == NULL) continue;
+
+		const char *valueText = iniKeyGetValueText(key);
+		if(iniParseFixedPoint(valueText, strlen(valueText), scale, &returnValue) == FAIL)
+		{
+			LOG_ERROR("[ERROR] 값을 고정 소수점으로 변환할 수 없음. (field:%s, key:%s, value:%s, scale:%d)\n", fieldName, keyName, valueText, scale);
+			return FAIL;
+		}
+
+		*result = SUCCESS;
+		break;
+	}
+
+	if(*result == FAIL) LOG_ERROR("[ERROR] 지정한 필드에 대한 키의 값을 찾을 수 없음. (field:%s, key:%s, fileName:%s)\n", fieldName, keyName, fileName);
 	return returnValue;
 }
 
+/**
+ * @fn int iniManagerGetKeyNum(const iniManager_t *iniManager, const char *fieldName)
+ * @brief 지정한 필드가 가진 키의 개수를 반환하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param iniManager ini 파일 내용을 저장하는 구조체(입력, 읽기 전용)
+ * @param fieldName 키 개수를 구할 필드 이름(입력, 읽기 전용)
+ * @return 성공 시 키 개수, 필드가 없으면 FAIL 반환
+ */
+int iniManagerGetKeyNum(const iniManager_t *iniManager, const char *fieldName)
+{
+	const iniField_t *field = iniManagerGetField(iniManager, fieldName);
+	if(field == NULL) return FAIL;
+
+	int keyIndex = 0;
+	int keyNum = 0;
+	for( ; keyIndex < field->keyMaxNum; keyIndex++)
+	{
+		if(field->keyList[keyIndex] != NULL) keyNum++;
+	}
+
+	return keyNum;
+}
+
+/**
+ * @fn const iniKey_t* iniManagerGetKeyByIndex(const iniManager_t *iniManager, const char *fieldName, int index)
+ * @brief 지정한 필드에서 ini 파일에 적힌 순서로 index 번째 키를 반환하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param iniManager ini 파일 내용을 저장하는 구조체(입력, 읽기 전용)
+ * @param fieldName 키를 찾을 필드 이름(입력, 읽기 전용)
+ * @param index 찾을 키의 순서(입력, 0 부터 시작)
+ * @return 성공 시 iniKey_t 구조체 주소, 실패 시 NULL 반환
+ */
+const iniKey_t* iniManagerGetKeyByIndex(const iniManager_t *iniManager, const char *fieldName, int index)
+{
+	const iniField_t *field = iniManagerGetField(iniManager, fieldName);
+	if(field == NULL || index < 0 || index >= field->keyMaxNum) return NULL;
+
+	return iniFieldGetKeyFromListByIndex(field, index);
+}
+
+/**
+ * @fn int iniManagerHasField(const iniManager_t *iniManager, const char *fieldName)
+ * @brief 지정한 필드가 ini 파일에 있는지 메시지 출력 없이 검사하는 함수 (선택 필드 확인용)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param iniManager ini 파일 내용을 저장하는 구조체(입력, 읽기 전용)
+ * @param fieldName 검색할 필드 이름(입력, 읽기 전용)
+ * @return 있으면 1, 없으면 0 반환
+ */
+int iniManagerHasField(const iniManager_t *iniManager, const char *fieldName)
+{
+	if(iniManager == NULL || fieldName == NULL) return 0;
+
+	return (iniManagerFindFieldFromList(iniManager, fieldName) == SUCCESS) ? 1 : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Util Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int iniParseFixedPoint(const char *text, size_t length, int scale, int *value)
+ * @brief 소수점이 있을 수 있는 10 진수 문자열을 scale 배 한 고정 소수점 정수로 변환하는 함수
+ * 소수점 아래 자릿수가 scale 로 표현할 수 있는 자릿수보다 많으면 값이 달라지므로 실패로 처리한다.
+ * 예) scale 10 : "87.5" -> 875, "-3" -> -30, "87.55" -> 실패
+ * 점수마다 호출되는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param text 변환할 문자열(입력, 읽기 전용, NULL 종료 문자가 없어도 됨)
+ * @param length 문자열 길이(입력)
+ * @param scale 고정 소수점 배율(입력, 10 의 거듭제곱)
+ * @param value 변환된 값(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int iniParseFixedPoint(const char *text, size_t length, int scale, int *value)
+{
+	size_t pos = 0;
+	long long sign = 1;
+	long long integerPart = 0;
+	long long fractionPart = 0;
+	long long fractionScale = scale;
+	int digitNum = 0;
+
+	while(length > 0 && isspace((unsigned char)text[length - 1]) != 0) length--;
+	while(pos < length && isspace((unsigned char)text[pos]) != 0) pos++;
+
+	if(pos < length && (text[pos] == '-' || text[pos] == '+'))
+	{
+		if(text[pos] == '-') sign = -1;
+		pos++;
+	}
+
+	for( ; pos < length && text[pos] >= '0' && text[pos] <= '9'; pos++, digitNum++)
+	{
+		integerPart = integerPart * 10 + (text[pos] - '0');
+		if(integerPart > INT_MAX) return FAIL;
+	}
+
+	if(pos < length && text[pos] == '.')
+	{
+		for(pos++; pos < length && text[pos] >= '0' && text[pos] <= '9'; pos++, digitNum++)
+		{
+			fractionScale /= 10;
+			if(fractionScale == 0)
+			{
+				// scale 보다 정밀한 자릿수는 0 일 때만 허용한다. (예: scale 10 에서 "87.50")
+				if(text[pos] != '0') return FAIL;
+				fractionScale = 0;
+				continue;
+			}
+			fractionPart += (text[pos] - '0') * fractionScale;
+		}
+	}
+
+	if(pos != length || digitNum == 0) return FAIL;
+
+	long long result = sign * (integerPart * scale + fractionPart);
+	if(result > INT_MAX || result < INT_MIN) return FAIL;
+
+	*value = (int)result;
+	return SUCCESS;
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Static Functions for iniKey_t
 //////////////////////////////////////////////////////////////////////////
@@ -191,24 +376,24 @@ int iniManagerGetValueFromField(const iniManager_t *iniManager, const char *fiel
  */
 static iniKey_t* iniKeyNew(const char *fieldName, const char *keyName)
 {
-	iniKey_t *key = (iniKey_t*)malloc(sizeof(iniKey_t));
+	iniKey_t *key = (iniKey_t*)MEM_MALLOC(MEM_SUBSYSTEM_INI, sizeof(iniKey_t));
 	if(key == NULL)
 	{
-		printf("[DEBUG] iniKey 객체 동적 생성 실패. NULL.\n");
+		LOG_DEBUG("[DEBUG] iniKey 객체 동적 생성 실패. NULL.\n");
 		return NULL;
 	}
 
-	if(strncpy(key->fieldName, fieldName, MAX_FIELD_LEN) == NULL)
+	if(snprintf(key->fieldName, sizeof(key->fieldName), "%s", fieldName) >= (int)sizeof(key->fieldName))
 	{
-		printf("[DEBUG] iniKey 객체에 필드 이름 저장 실패.\n");
-		free(key);
+		LOG_DEBUG("[DEBUG] iniKey 객체에 필드 이름 저장 실패. 이름이 너무 김. (fieldName:%s)\n", fieldName);
+		MEM_FREE(key);
 		return NULL;
 	}
 
-	if(strncpy(key->name, keyName, MAX_KEY_LEN) == NULL)
+	if(snprintf(key->name, sizeof(key->name), "%s", keyName) >= (int)sizeof(key->name))
 	{
-		printf("[DEBUG] iniKey 객체에 키 이름 저장 실패.\n");
-		free(key);
+		LOG_DEBUG("[DEBUG] iniKey 객체에 키 이름 저장 실패. 이름이 너무 김. (keyName:%s)\n", keyName);
+		MEM_FREE(key);
 		return NULL;
 	}
 
@@ -224,7 +409,7 @@ static iniKey_t* iniKeyNew(const char *fieldName, const char *keyName)
  */
 static void iniKeyDelete(iniKey_t **key)
 {
-	free(*key);
+	MEM_FREE(*key);
 	*key = NULL;
 }
 
@@ -241,16 +426,30 @@ static int iniKeyGetValue(const iniKey_t *key)
 }
 
 /**
- * @fn static void iniKeySetValue(iniKey_t *key, int value)
- * @brief 지정한 키에 대해 1:1 대응하도록 전달받은 값을 저장하는 함수
+ * @fn static void iniKeySetValue(iniKey_t *key, int value, const char *valueText)
+ * @brief 지정한 키에 대해 1:1 대응하도록 전달받은 값과 값 문자열을 저장하는 함수
  * iniFieldStoreKeyInList 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
  * @param key 전달받은 값을 저장할 iniKey_t 구조체 객체(출력)
  * @param value 저장할 값(입력)
+ * @param valueText ini 파일에 적힌 값 문자열(입력, 읽기 전용)
  * @return 반환값 없음
  */
-static void iniKeySetValue(iniKey_t *key, int value)
+static void iniKeySetValue(iniKey_t *key, int value, const char *valueText)
 {
 	key->value = value;
+	snprintf(key->valueText, MAX_VALUE_LEN, "%s", valueText);
+}
+
+/**
+ * @fn static const char* iniKeyGetValueText(const iniKey_t *key)
+ * @brief 지정한 키에 대해 ini 파일에 적힌 값 문자열을 반환하는 함수
+ * iniManagerGetFixedValueFromField 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param key 값 문자열을 반환할 iniKey_t 구조체 객체(입력, 읽기 전용)
+ * @return 항상 값 문자열 반환
+ */
+static const char* iniKeyGetValueText(const iniKey_t *key)
+{
+	return key->valueText;
 }
 
 /**
@@ -278,24 +477,24 @@ static const char* iniKeyGetName(const iniKey_t *key)
  */
 static iniField_t* iniFieldNew(const char *fieldName, int keyMaxNum)
 {
-	iniField_t *field = (iniField_t*)malloc(sizeof(iniField_t));
+	iniField_t *field = (iniField_t*)MEM_MALLOC(MEM_SUBSYSTEM_INI, sizeof(iniField_t));
 	if(field == NULL)
 	{
-		printf("[DEBUG] iniKey 객체 동적 생성 실패. NULL.\n");
+		LOG_DEBUG("[DEBUG] iniKey 객체 동적 생성 실패. NULL.\n");
 		return NULL;
 	}
 
-	if(strncpy(field->name, fieldName, MAX_FIELD_LEN) == NULL)
+	if(snprintf(field->name, sizeof(field->name), "%s", fieldName) >= (int)sizeof(field->name))
 	{
-		printf("[DEBUG] iniField 객체에 필드 이름 저장 실패.\n");
-		free(field);
+		LOG_DEBUG("[DEBUG] iniField 객체에 필드 이름 저장 실패. 이름이 너무 김. (fieldName:%s)\n", fieldName);
+		MEM_FREE(field);
 		return NULL;
 	}
 
 	field->keyMaxNum = keyMaxNum;
 	if(iniFieldInitializeKeyList(field, field->keyMaxNum) == FAIL)
 	{
-		free(field);
+		MEM_FREE(field);
 		return NULL;
 	}
 
@@ -323,11 +522,11 @@ static void iniFieldDelete(iniField_t **field)
 			}
 		}
 
-		free((*field)->keyList);
+		MEM_FREE((*field)->keyList);
 		(*field)->keyList = NULL;
 	}
 
-	free(*field);
+	MEM_FREE(*field);
 	*field = NULL;
 }
 
@@ -381,10 +580,11 @@ static iniKey_t* iniFieldGetKeyFromListByIndex(const iniField_t *field, int inde
  */
 static int iniFieldInitializeKeyList(iniField_t *field, int keyMaxNum)
 {
-	field->keyList = (iniKey_t**)malloc(sizeof(iniKey_t*) * (size_t)keyMaxNum);
+	// 키가 keyMaxNum 개보다 적은 필드도 있으므로 빈 자리는 NULL 로 초기화한다.
+	field->keyList = (iniKey_t**)MEM_CALLOC(MEM_SUBSYSTEM_INI, (size_t)keyMaxNum, sizeof(iniKey_t*));
 	if(field->keyList == NULL)
 	{
-		printf("[DEBUG] keyList 객체 동적 생성 실패. NULL.\n");
+		LOG_DEBUG("[DEBUG] keyList 객체 동적 생성 실패. NULL.\n");
 		return FAIL;
 	}
 
@@ -392,24 +592,42 @@ static int iniFieldInitializeKeyList(iniField_t *field, int keyMaxNum)
 }
 
 /**
- * @fn static int iniFieldStoreKeyInList(iniField_t *field, int keyIndex, const char *keyName, int value)
- * @brief iniField_t 구조체의 멤버 변수인 키 리스트에 지정한 키 데이터를 저장하는 함수
+ * @fn static int iniFieldStoreKeyInList(iniField_t *field, int keyIndex, const char *keyName, int value, const char *valueText)
+ * @brief iniField_t 구조체의 멤버 변수인 키 리스트에 지정한 키 데이터를 저장하는 함수, 키 리스트가 모자라면 늘린다.
  * iniManagerGetFieldListfromINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 키 이름에 대한 NULL 체크를 수행하지 않는다.
  * @param field 키 데이터를 저장할 키 리스트를 가진 iniField_t 구조체 객체(출력)
  * @param keyIndex 저장할 키 리스트의 인덱스(입력)
  * @param keyName 저장할 키의 이름(입력, 읽기 전용)
  * @param value 저장할 키의 값(입력)
+ * @param valueText ini 파일에 적힌 값 문자열(입력, 읽기 전용)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-static int iniFieldStoreKeyInList(iniField_t *field, int keyIndex, const char *keyName, int value)
+static int iniFieldStoreKeyInList(iniField_t *field, int keyIndex, const char *keyName, int value, const char *valueText)
 {
+	// [Weight] 처럼 키가 NUM_OF_KEYS 개보다 많은 필드는 키 리스트를 늘린다.
+	if(keyIndex >= field->keyMaxNum)
+	{
+		iniKey_t **newKeyList = (iniKey_t**)MEM_REALLOC(MEM_SUBSYSTEM_INI, field->keyList, sizeof(iniKey_t*) * (size_t)(keyIndex + 1));
+		if(newKeyList == NULL)
+		{
+			LOG_DEBUG("[DEBUG] keyList 크기 확장 실패. NULL. (field:%s, key:%s)\n", field->name, keyName);
+			return FAIL;
+		}
+
+		for( ; field->keyMaxNum <= keyIndex; field->keyMaxNum++)
+		{
+			newKeyList[field->keyMaxNum] = NULL;
+		}
+		field->keyList = newKeyList;
+	}
+
 	field->keyList[keyIndex] = iniKeyNew(field->name, keyName);
 	if(field->keyList[keyIndex] == NULL)
 	{
 		return FAIL;
 	}
 
-	iniKeySetValue(field->keyList[keyIndex], value);
+	iniKeySetValue(field->keyList[keyIndex], value, valueText);
 	return SUCCESS;
 }
 
@@ -461,9 +679,32 @@ static int iniManagerFindFieldFromList(const iniManager_t *iniManager, const cha
 	return FAIL;
 }
 
+/**
+ * @fn static const iniField_t* iniManagerGetField(const iniManager_t *iniManager, const char *fieldName)
+ * @brief 필드 이름이 정확히 같은 필드를 필드 리스트에서 찾아 반환하는 함수
+ * iniManagerGetKeyNum, iniManagerGetKeyByIndex 함수에서 호출되며 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param iniManager ini 파일 내용을 저장하는 구조체(입력, 읽기 전용)
+ * @param fieldName 찾을 필드 이름(입력, 읽기 전용)
+ * @return 성공 시 iniField_t 구조체 주소, 실패 시 NULL 반환
+ */
+static const iniField_t* iniManagerGetField(const iniManager_t *iniManager, const char *fieldName)
+{
+	if(iniManager == NULL || fieldName == NULL || iniManager->fieldList == NULL) return NULL;
+
+	int fieldIndex = 0;
+	for( ; fieldIndex < iniManager->fieldMaxNum; fieldIndex++)
+	{
+		const iniField_t *field = iniManager->fieldList[fieldIndex];
+		if(field != NULL && strncmp(field->name, fieldName, MAX_FIELD_LEN) == 0) return field;
+	}
+
+	return NULL;
+}
+
 /**
  * @fn static int iniManagerLoadInfoFromINI(iniManager_t *iniManager, const char *fileName)
  * @brief 지정한 ini 파일 내용을 iniManager_t 구조체에 저장하는 함수
+ * 파일은 한 번만 열고, 필드 개수를 센 뒤 처음으로 되돌려 필드 내용을 읽는다.
  * iniManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 이름에 대한 NULL 체크를 수행하지 않는다.
  * @param iniManager ini 파일 내용을 저장하는 구조체(출력)
  * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용)
@@ -471,38 +712,41 @@ static int iniManagerFindFieldFromList(const iniManager_t *iniManager, const cha
  */
 static int iniManagerLoadInfoFromINI(iniManager_t *iniManager, const char *fileName)
 {
-	if(iniManagerGetFieldMaxNumfromINI(iniManager, fileName) == FAIL)
+	FILE *filePtr = fopen(fileName, "r");
+	if(filePtr == NULL)
 	{
-		printf("[ERROR] iniManager 로 필드 전체 개수 저장 실패. NULL.\n");
+		LOG_DEBUG("[DEBUG] 파일 읽기 실패. (fileName:%s)\n", fileName);
 		return FAIL;
 	}
 
-	if(iniManagerGetFieldListfromINI(iniManager, fileName) == FAIL)
+	int result = FAIL;
+	if(iniManagerGetFieldMaxNumfromINI(iniManager, filePtr) == FAIL)
 	{
-		printf("[ERROR] iniManager 로 필드 가져오기 실패. NULL.\n");
-		return FAIL;
+		LOG_ERROR("[ERROR] iniManager 로 필드 전체 개수 저장 실패. NULL.\n");
+	}
+	else if(iniManagerGetFieldListfromINI(iniManager, filePtr) == FAIL)
+	{
+		LOG_ERROR("[ERROR] iniManager 로 필드 가져오기 실패. NULL.\n");
+	}
+	else
+	{
+		result = SUCCESS;
 	}
 
-	return SUCCESS;
+	fclose(filePtr);
+	return result;
 }
 
 /**
- * @fn static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, const char *fileName)
+ * @fn static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, FILE *filePtr)
  * @brief 지정한 ini 파일로부터 필드의 전체 개수를 구해서 iniManager_t 구조체에 저장하는 함수
- * iniManagerLoadInfoFromINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 이름에 대한 NULL 체크를 수행하지 않는다.
+ * iniManagerLoadInfoFromINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 포인터에 대한 NULL 체크를 수행하지 않는다.
  * @param iniManager ini 파일 내용을 저장하는 구조체(출력)
- * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용)
+ * @param filePtr 처음 위치에 있는 ini 파일(입력)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, const char *fileName)
+static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, FILE *filePtr)
 {
-	FILE *filePtr = fopen(fileName, "r");
-	if(filePtr == NULL)
-	{
-		printf("[DEBUG] 파일 읽기 실패. (fileName:%s)\n", fileName);
-		return FAIL;
-	}
-
 	int fieldNum = 0;
 	int result = SUCCESS;
 	char fieldFindBuffer[MAX_FIELD_LEN] = { '\0' };
@@ -516,40 +760,34 @@ static int iniManagerGetFieldMaxNumfromINI(iniManager_t *iniManager, const char
 
 	if(iniManager->fieldMaxNum == 0)
 	{
-		printf("[ERROR] 파일 읽기 실패. 파일 내용 또는 필드가 존재하지 않음. (필드 형식:[field])\n");
+		LOG_ERROR("[ERROR] 파일 읽기 실패. 파일 내용 또는 필드가 존재하지 않음. (필드 형식:[field])\n");
 		result = FAIL;
 	}
 
-	fclose(filePtr);
 	return result;
 }
 
 /**
- * @fn static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, const char *fileName)
+ * @fn static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, FILE *filePtr)
  * @brief 지정한 ini 파일로부터 필드 이름들을 가져와서 iniManager_t 구조체에 저장하는 함수
- * iniManagerLoadInfoFromINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 이름에 대한 NULL 체크를 수행하지 않는다.
+ * iniManagerLoadInfoFromINI 함수에서 호출되기 때문에 전달받은 구조체 포인터와 파일 포인터에 대한 NULL 체크를 수행하지 않는다.
  * @param iniManager ini 파일 내용을 저장하는 구조체(출력)
- * @param fileName 등급 정보를 가지는 ini 파일 이름(입력, 읽기 전용)
+ * @param filePtr 필드 개수를 센 ini 파일(입력, 처음 위치로 되돌린 뒤 읽는다)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, const char *fileName)
+static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, FILE *filePtr)
 {
 	int fieldIndex = 0;
 	int fieldMaxNum = iniManager->fieldMaxNum;
 
-	iniManager->fieldList = (iniField_t**)malloc(sizeof(iniField_t*) * (size_t)fieldMaxNum);
+	iniManager->fieldList = (iniField_t**)MEM_MALLOC(MEM_SUBSYSTEM_INI, sizeof(iniField_t*) * (size_t)fieldMaxNum);
 	if(iniManager->fieldList == NULL)
 	{
-		printf("[DEBUG] 새로 생성한 fieldList 객체가 NULL.\n");
+		LOG_DEBUG("[DEBUG] 새로 생성한 fieldList 객체가 NULL.\n");
 		return FAIL;
 	}
 
-	FILE *filePtr = fopen(fileName, "r");
-	if(filePtr == NULL)
-	{
-		printf("[DEBUG] 파일 읽기 실패. (fileName:%s)\n", fileName);
-		return FAIL;
-	}
+	rewind(filePtr);
 
 	int result = FAIL;
 	char fieldFindBuffer[MAX_FIELD_LEN] = { '\0' };
@@ -574,7 +812,7 @@ static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, const char *f
 				{
 					if(fseek(filePtr, -((long int)(strlen(keyFindBuffer) + 2)), SEEK_CUR) == FAIL)
 					{
-						printf("[ERROR] fseek 실패.\n");
+						LOG_ERROR("[ERROR] fseek 실패.\n");
 					}
 					break;
 				}
@@ -582,19 +820,20 @@ static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, const char *f
 				char *key = strtok(keyFindBuffer, "=");
 				if(key == NULL)
 				{
-					printf("[ERROR] 키 저장 실패. 키가 존재하지 않음.\n");
+					LOG_ERROR("[ERROR] 키 저장 실패. 키가 존재하지 않음.\n");
 					break;
 				}
 
 				char *valuePtr = strtok(NULL, "=");
-				if(isdigit(valuePtr[0]) == 0)
+				if(valuePtr == NULL || isdigit(valuePtr[0]) == 0)
 				{
-					printf("[ERROR] 값 저장 실패. 정수가 아니거나 존재하지 않음.\n");
+					LOG_ERROR("[ERROR] 값 저장 실패. 숫자가 아니거나 존재하지 않음.\n");
 					break;
 				}
+				valuePtr[strcspn(valuePtr, "\r\n")] = '\0';
 
 				int value = atoi(valuePtr);
-				if(iniFieldStoreKeyInList(iniManager->fieldList[fieldIndex], keyIndex, key, value) == FAIL)
+				if(iniFieldStoreKeyInList(iniManager->fieldList[fieldIndex], keyIndex, key, value, valuePtr) == FAIL)
 				{
 					break;
 				}
@@ -611,7 +850,6 @@ static int iniManagerGetFieldListfromINI(iniManager_t *iniManager, const char *f
 		}
 	}
 
-	fclose(filePtr);
 	return result;
 }
 
@@ -5,6 +5,10 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <limits.h>
+
+#include "logManager.h"
+#include "memManager.h"
 
 //////////////////////////////////////////////////////////////////////////
 /// Definitions & Macros
@@ -19,7 +23,9 @@
 #define MAX_KEY_LEN		64
 // ini 파일에서의 필드 이름 최대 길이
 #define MAX_FIELD_LEN	64
-// 필드에 지정된 키의 개수
+// ini 파일에서의 값 문자열 최대 길이
+#define MAX_VALUE_LEN	32
+// 필드에 지정된 키의 기본 개수 (더 많은 키가 있으면 키 리스트를 늘린다)
 #define NUM_OF_KEYS		2
 
 /**
@@ -35,6 +41,8 @@ struct iniKey_s
 	char name[MAX_KEY_LEN];
 	// 키와 1:1 대응하는 값
 	int value;
+	// ini 파일에 적힌 값 문자열 (소수점 값을 고정 소수점으로 다시 읽을 때 사용)
+	char valueText[MAX_VALUE_LEN];
 };
 
 /**
@@ -75,5 +83,15 @@ struct iniManager_s
 iniManager_t *iniManagerNew(const char *fileName);
 void iniManagerDelete(iniManager_t **iniManager);
 int iniManagerGetValueFromField(const iniManager_t *iniManager, const char *fieldName, const char *keyName, int defaultValue, const char *fileName, int *result);
+int iniManagerGetFixedValueFromField(const iniManager_t *iniManager, const char *fieldName, const char *keyName, int scale, int defaultValue, const char *fileName, int *result);
+int iniManagerHasField(const iniManager_t *iniManager, const char *fieldName);
+int iniManagerGetKeyNum(const iniManager_t *iniManager, const char *fieldName);
+const iniKey_t* iniManagerGetKeyByIndex(const iniManager_t *iniManager, const char *fieldName, int index);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Util Function
+//////////////////////////////////////////////////////////////////////////
+
+int iniParseFixedPoint(const char *text, size_t length, int scale, int *value);
 
 #endif // #ifndef __INI_PARSER_H__
@@ -0,0 +1,868 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "inputManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for inputReader_t
+//////////////////////////////////////////////////////////////////////////
+
+static int inputReaderFill(inputReader_t *reader);
+static int inputReaderDetectFormat(inputReader_t *reader);
+static ssize_t inputReaderInflate(inputReader_t *reader, char *buffer, size_t size);
+#ifdef HAVE_ZSTD
+static ssize_t inputReaderDecompressZstd(inputReader_t *reader, char *buffer, size_t size);
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for inputManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static void* inputManagerRunThread(void *data);
+static int inputManagerFillChunk(inputManager_t *inputManager, recordBuffer_t *chunk, int *eof);
+static recordBuffer_t* inputManagerWaitFree(inputManager_t *inputManager);
+static void inputManagerPublish(inputManager_t *inputManager);
+static int inputChunkReserve(recordBuffer_t *chunk, size_t capacity);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for inputReader_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn inputReader_t* inputReaderNew(const char *path)
+ * @brief 입력 파일을 열고 앞의 식별 바이트로 압축 형식을 판단해서 읽기 준비를 하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 문자열 포인터에 대한 NULL 체크를 수행한다.
+ * @param path 입력 파일 경로(입력, 읽기 전용)
+ * @return 성공 시 새로 생성된 inputReader_t 구조체 객체, 실패 시 NULL 반환
+ */
+inputReader_t* inputReaderNew(const char *path)
+{
+	if(path == NULL)
+	{
+		printf("[DEBUG] 주어진 path 가 NULL.\n");
+		return NULL;
+	}
+
+	inputReader_t *reader = (inputReader_t*)calloc(1, sizeof(inputReader_t));
+	if(reader == NULL)
+	{
+		printf("[DEBUG] inputReader 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	reader->fd = -1;
+	if(snprintf(reader->path, sizeof(reader->path), "%s", path) >= (int)sizeof(reader->path))
+	{
+		printf("[ERROR] 입력 파일 경로가 너무 김. (path:%s)\n", path);
+		inputReaderDelete(&reader);
+		return NULL;
+	}
+
+	reader->readBuffer = (unsigned char*)malloc(INPUT_READ_SIZE);
+	if(reader->readBuffer == NULL)
+	{
+		printf("[DEBUG] 입력 읽기 버퍼 동적 생성 실패. NULL.\n");
+		inputReaderDelete(&reader);
+		return NULL;
+	}
+
+	reader->fd = open(path, O_RDONLY);
+	if(reader->fd == -1)
+	{
+		printf("[ERROR] 입력 파일 열기 실패. (fileName:%s, errno:%d)\n", path, errno);
+		inputReaderDelete(&reader);
+		return NULL;
+	}
+	posix_fadvise(reader->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+	if(inputReaderDetectFormat(reader) == FAIL)
+	{
+		inputReaderDelete(&reader);
+		return NULL;
+	}
+
+	return reader;
+}
+
+/**
+ * @fn void inputReaderDelete(inputReader_t **reader)
+ * @brief 생성된 inputReader_t 구조체 객체의 압축 해제 상태와 파일을 정리하고 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param reader 삭제할 inputReader_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void inputReaderDelete(inputReader_t **reader)
+{
+	if(reader == NULL || *reader == NULL)
+	{
+		printf("[DEBUG] inputReader 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	inputReader_t *input = *reader;
+	if(input->zStreamReady == TRUE) inflateEnd(&(input->zStream));
+#ifdef HAVE_ZSTD
+	if(input->zstdStream != NULL) ZSTD_freeDStream(input->zstdStream);
+#endif
+	if(input->fd != -1) close(input->fd);
+	free(input->readBuffer);
+	free(input);
+	*reader = NULL;
+}
+
+/**
+ * @fn ssize_t inputReaderRead(inputReader_t *reader, char *buffer, size_t size)
+ * @brief 압축을 푼 입력을 최대 size 바이트까지 읽는 함수 (read 시스템 호출과 같은 방식으로 사용)
+ * 입력이 끝났는데 마지막 gzip 멤버나 zstd 프레임이 끝나지 않았으면 잘린 파일로 보고 실패를 반환한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param reader 입력을 읽는 구조체(입력 및 출력)
+ * @param buffer 압축을 푼 데이터를 저장할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @return 성공 시 읽은 바이트 수(입력 끝이면 0), 실패 시 -1 반환
+ */
+ssize_t inputReaderRead(inputReader_t *reader, char *buffer, size_t size)
+{
+	if(reader == NULL || buffer == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (reader:%p, buffer:%p)\n", (void*)reader, (void*)buffer);
+		return -1;
+	}
+
+	if(reader->eof == TRUE || size == 0) return 0;
+
+	ssize_t readSize = 0;
+	if(reader->format == INPUT_GZIP)
+	{
+		readSize = inputReaderInflate(reader, buffer, size);
+	}
+#ifdef HAVE_ZSTD
+	else if(reader->format == INPUT_ZSTD)
+	{
+		readSize = inputReaderDecompressZstd(reader, buffer, size);
+	}
+#endif
+	else if(reader->readPos < reader->readLength)
+	{
+		// 형식 판단에 사용한 앞부분을 먼저 돌려준다.
+		size_t remainLength = reader->readLength - reader->readPos;
+		readSize = (ssize_t)((remainLength < size) ? remainLength : size);
+		memcpy(buffer, reader->readBuffer + reader->readPos, (size_t)readSize);
+		reader->readPos += (size_t)readSize;
+	}
+	else
+	{
+		do
+		{
+			readSize = read(reader->fd, buffer, size);
+		} while(readSize < 0 && errno == EINTR);
+
+		if(readSize < 0)
+		{
+			printf("[ERROR] 입력 파일 읽기 실패. (fileName:%s, errno:%d)\n", reader->path, errno);
+			return -1;
+		}
+		reader->compressedByteNum += readSize;
+	}
+
+	if(readSize == 0) reader->eof = TRUE;
+	else if(readSize > 0) reader->byteNum += readSize;
+	return readSize;
+}
+
+/**
+ * @fn int inputReaderSkip(inputReader_t *reader, long long byteNum)
+ * @brief 압축을 푼 입력의 앞부분 byteNum 바이트를 건너뛰는 함수 (체크포인트에서 이어서 읽을 때 사용)
+ * 압축되지 않은 일반 파일은 lseek 으로 바로 옮기고, 압축된 입력이나 파이프는 압축을 풀어서 버린다.
+ * 입력이 byteNum 보다 짧으면 체크포인트와 입력이 맞지 않는 것이므로 실패를 반환한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param reader 입력을 읽는 구조체(입력 및 출력)
+ * @param byteNum 건너뛸 압축을 푼 바이트 수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int inputReaderSkip(inputReader_t *reader, long long byteNum)
+{
+	if(reader == NULL || byteNum < 0)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (reader:%p, byteNum:%lld)\n", (void*)reader, byteNum);
+		return FAIL;
+	}
+
+	if(reader->format == INPUT_PLAIN)
+	{
+		// 형식 판단에 사용한 앞부분부터 소비한다.
+		size_t remainLength = reader->readLength - reader->readPos;
+		size_t usedLength = ((long long)remainLength < byteNum) ? remainLength : (size_t)byteNum;
+		reader->readPos += usedLength;
+		reader->byteNum += (long long)usedLength;
+		byteNum -= (long long)usedLength;
+
+		struct stat fileStat;
+		off_t position = 0;
+		if(byteNum > 0 && fstat(reader->fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode)
+			&& (position = lseek(reader->fd, 0, SEEK_CUR)) != -1)
+		{
+			if(position + byteNum > fileStat.st_size)
+			{
+				printf("[ERROR] 입력 파일이 건너뛸 위치보다 짧음. (fileName:%s, size:%lld)\n", reader->path, (long long)fileStat.st_size);
+				return FAIL;
+			}
+			if(lseek(reader->fd, (off_t)byteNum, SEEK_CUR) == -1)
+			{
+				printf("[ERROR] 입력 파일 위치 이동 실패. (fileName:%s, errno:%d)\n", reader->path, errno);
+				return FAIL;
+			}
+			reader->compressedByteNum += byteNum;
+			reader->byteNum += byteNum;
+			return SUCCESS;
+		}
+	}
+
+	char *scratch = (char*)malloc(INPUT_READ_SIZE);
+	if(scratch == NULL)
+	{
+		printf("[DEBUG] 건너뛰기 버퍼 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	while(byteNum > 0)
+	{
+		size_t size = (byteNum < INPUT_READ_SIZE) ? (size_t)byteNum : INPUT_READ_SIZE;
+		ssize_t readSize = inputReaderRead(reader, scratch, size);
+		if(readSize <= 0)
+		{
+			if(readSize == 0) printf("[ERROR] 입력 파일이 건너뛸 위치보다 짧음. (fileName:%s, byteNum:%lld)\n", reader->path, reader->byteNum);
+			result = FAIL;
+			break;
+		}
+		byteNum -= readSize;
+	}
+
+	free(scratch);
+	return result;
+}
+
+/**
+ * @fn const char* inputGetFormatName(int format)
+ * @brief 입력 파일 형식의 이름을 반환하는 함수
+ * @param format 입력 파일 형식(입력, INPUT_FORMAT)
+ * @return 형식 이름 문자열 반환
+ */
+const char* inputGetFormatName(int format)
+{
+	switch(format)
+	{
+		case INPUT_GZIP: return "gzip";
+		case INPUT_ZSTD: return "zstd";
+		default: return "plain";
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for inputManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn inputManager_t* inputManagerNew(const char *path, long long startOffset)
+ * @brief 입력 파일을 열고 구간 버퍼를 할당한 뒤 압축 해제 스레드를 시작하는 함수
+ * startOffset 이 0 보다 크면 압축을 푼 입력의 그 위치(레코드 경계)부터 넘겨준다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 문자열 포인터에 대한 NULL 체크를 수행한다.
+ * @param path 입력 파일 경로(입력, 읽기 전용, gzip 또는 zstd 로 압축되어 있어도 됨)
+ * @param startOffset 처리를 시작할 압축을 푼 입력 위치(입력, 처음부터면 0)
+ * @return 성공 시 새로 생성된 inputManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+inputManager_t* inputManagerNew(const char *path, long long startOffset)
+{
+	if(path == NULL)
+	{
+		printf("[DEBUG] 주어진 path 가 NULL.\n");
+		return NULL;
+	}
+
+	inputManager_t *inputManager = (inputManager_t*)calloc(1, sizeof(inputManager_t));
+	if(inputManager == NULL)
+	{
+		printf("[DEBUG] inputManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	pthread_mutex_init(&(inputManager->mutex), NULL);
+	pthread_cond_init(&(inputManager->notEmpty), NULL);
+	pthread_cond_init(&(inputManager->notFull), NULL);
+
+	inputManager->reader = inputReaderNew(path);
+	if(inputManager->reader == NULL || (startOffset > 0 && inputReaderSkip(inputManager->reader, startOffset) == FAIL))
+	{
+		inputManagerDelete(&inputManager);
+		return NULL;
+	}
+
+	int chunkIndex = 0;
+	for( ; chunkIndex < INPUT_CHUNK_NUM; chunkIndex++)
+	{
+		if(recordBufferInit(&(inputManager->chunkList[chunkIndex]), INPUT_CHUNK_SIZE) == FAIL)
+		{
+			inputManagerDelete(&inputManager);
+			return NULL;
+		}
+	}
+
+	if(pthread_create(&(inputManager->thread), NULL, inputManagerRunThread, inputManager) != 0)
+	{
+		printf("[ERROR] 압축 해제 스레드 생성 실패.\n");
+		inputManagerDelete(&inputManager);
+		return NULL;
+	}
+	inputManager->threadStarted = TRUE;
+
+	return inputManager;
+}
+
+/**
+ * @fn void inputManagerDelete(inputManager_t **inputManager)
+ * @brief 압축 해제 스레드를 멈추고 생성된 inputManager_t 구조체 객체의 메모리를 해제하는 함수
+ * 입력을 끝까지 소비하지 않았어도 호출할 수 있다.
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param inputManager 삭제할 inputManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void inputManagerDelete(inputManager_t **inputManager)
+{
+	if(inputManager == NULL || *inputManager == NULL)
+	{
+		printf("[DEBUG] inputManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	inputManager_t *manager = *inputManager;
+	if(manager->threadStarted == TRUE)
+	{
+		pthread_mutex_lock(&(manager->mutex));
+		manager->stopped = TRUE;
+		pthread_cond_broadcast(&(manager->notFull));
+		pthread_mutex_unlock(&(manager->mutex));
+		pthread_join(manager->thread, NULL);
+	}
+
+	int chunkIndex = 0;
+	for( ; chunkIndex < INPUT_CHUNK_NUM; chunkIndex++)
+	{
+		recordBufferFinal(&(manager->chunkList[chunkIndex]));
+	}
+	recordBufferFinal(&(manager->carry));
+	if(manager->reader != NULL) inputReaderDelete(&(manager->reader));
+
+	pthread_mutex_destroy(&(manager->mutex));
+	pthread_cond_destroy(&(manager->notEmpty));
+	pthread_cond_destroy(&(manager->notFull));
+	free(manager);
+	*inputManager = NULL;
+}
+
+/**
+ * @fn const recordBuffer_t* inputManagerNext(inputManager_t *inputManager)
+ * @brief 압축을 푼 다음 구간(개행 문자로 끝나는 레코드들)을 꺼내는 함수 (채워진 구간이 없으면 기다린다)
+ * 꺼낸 구간은 inputManagerRelease 를 호출할 때까지 유효하고, 그 전에 다시 호출하면 안 된다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param inputManager 파이프라인 구조체(입력 및 출력)
+ * @return 성공 시 구간 버퍼, 입력이 끝났거나 압축 해제에 실패하면 NULL 반환 (failed 로 구분)
+ */
+const recordBuffer_t* inputManagerNext(inputManager_t *inputManager)
+{
+	if(inputManager == NULL)
+	{
+		printf("[DEBUG] inputManager 가 NULL.\n");
+		return NULL;
+	}
+
+	const recordBuffer_t *chunk = NULL;
+
+	pthread_mutex_lock(&(inputManager->mutex));
+	if(inputManager->count == 0 && inputManager->done == FALSE) inputManager->starveNum++;
+	while(inputManager->count == 0 && inputManager->done == FALSE)
+	{
+		pthread_cond_wait(&(inputManager->notEmpty), &(inputManager->mutex));
+	}
+
+	if(inputManager->count > 0 && inputManager->failed == FALSE)
+	{
+		chunk = &(inputManager->chunkList[inputManager->head]);
+		inputManager->consuming = TRUE;
+	}
+	pthread_mutex_unlock(&(inputManager->mutex));
+
+	return chunk;
+}
+
+/**
+ * @fn void inputManagerRelease(inputManager_t *inputManager)
+ * @brief inputManagerNext 로 꺼낸 구간 버퍼를 압축 해제 스레드에게 돌려주는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param inputManager 파이프라인 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+void inputManagerRelease(inputManager_t *inputManager)
+{
+	if(inputManager == NULL)
+	{
+		printf("[DEBUG] inputManager 가 NULL.\n");
+		return;
+	}
+
+	pthread_mutex_lock(&(inputManager->mutex));
+	if(inputManager->consuming == TRUE)
+	{
+		inputManager->head = (inputManager->head + 1) % INPUT_CHUNK_NUM;
+		inputManager->count--;
+		inputManager->consuming = FALSE;
+		pthread_cond_signal(&(inputManager->notFull));
+	}
+	pthread_mutex_unlock(&(inputManager->mutex));
+}
+
+/**
+ * @fn int inputManagerGradeFile(inputManager_t *inputManager, const gradeManager_t *gradeManager, const char *outputFileName, checkpoint_t *checkpoint, gradeStats_t *stats)
+ * @brief 압축 해제 스레드가 넘겨주는 구간마다 등급을 판단해서 결과 파일에 기록하는 함수
+ * 결과 형식은 batch 와 같은 (입력 레코드) (등급) 이다.
+ * checkpoint 가 있으면 체크포인트의 결과 길이와 통계에서 이어서 기록하고(inputManagerNew 에 체크포인트의 입력 위치를 넘겨야 한다),
+ * 구간마다 진행 상태를 갱신해서 주기적으로 저장한다. 끝까지 처리하면 체크포인트를 지우고, 실패하면 마지막 진행 상태를 저장한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param inputManager 파이프라인 구조체(입력 및 출력)
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param outputFileName 결과 파일 경로(입력, 읽기 전용)
+ * @param checkpoint 체크포인트 구조체(입력 및 출력, 사용하지 않으면 NULL)
+ * @param stats 등급 통계(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int inputManagerGradeFile(inputManager_t *inputManager, const gradeManager_t *gradeManager, const char *outputFileName, checkpoint_t *checkpoint, gradeStats_t *stats)
+{
+	if(inputManager == NULL || gradeManager == NULL || outputFileName == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (inputManager:%p, gradeManager:%p, outputFileName:%p, stats:%p)\n",
+			(void*)inputManager, (const void*)gradeManager, (const void*)outputFileName, (void*)stats);
+		return FAIL;
+	}
+
+	gradeStatsInit(stats);
+
+	uint64_t inputOffset = 0;
+	uint64_t outputLength = 0;
+	int fd = -1;
+	if(checkpoint != NULL)
+	{
+		inputOffset = checkpoint->header.inputOffset;
+		outputLength = checkpoint->header.outputLength;
+		checkpointGetStats(&(checkpoint->header.stats), stats);
+		fd = checkpointOpenOutput(checkpoint, outputFileName);
+		if(fd == -1) return FAIL;
+	}
+	else
+	{
+		fd = open(outputFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if(fd == -1)
+		{
+			printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", outputFileName, errno);
+			return FAIL;
+		}
+	}
+
+	recordBuffer_t output;
+	if(recordBufferInit(&output, 0) == FAIL)
+	{
+		close(fd);
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	const recordBuffer_t *chunk = NULL;
+	while((chunk = inputManagerNext(inputManager)) != NULL)
+	{
+		size_t chunkLength = chunk->length;
+		output.length = 0;
+		result = recordGradeBlock(gradeManager, chunk->data, chunk->length, &output, stats);
+		inputManagerRelease(inputManager);
+
+		if(result == SUCCESS) result = recordBufferWriteAll(fd, output.data, output.length);
+		if(result == FAIL) break;
+
+		// 구간은 개행 문자 경계에서 끝나므로 다시 시작할 수 있는 위치다.
+		inputOffset += chunkLength;
+		outputLength += output.length;
+		if(checkpoint != NULL)
+		{
+			result = checkpointUpdate(checkpoint, fd, inputOffset, outputLength, stats);
+			if(result == FAIL) break;
+		}
+	}
+
+	pthread_mutex_lock(&(inputManager->mutex));
+	if(inputManager->failed == TRUE) result = FAIL;
+	pthread_mutex_unlock(&(inputManager->mutex));
+
+	recordBufferFinal(&output);
+	if(checkpoint != NULL && fdatasync(fd) == -1) result = FAIL;
+	if(close(fd) == -1)
+	{
+		printf("[ERROR] 결과 파일 닫기 실패. (fileName:%s, errno:%d)\n", outputFileName, errno);
+		result = FAIL;
+	}
+
+	if(checkpoint != NULL)
+	{
+		if(result == SUCCESS) checkpointRemove(checkpoint);
+		else checkpointSave(checkpoint);
+	}
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for inputReader_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int inputReaderFill(inputReader_t *reader)
+ * @brief 읽기 버퍼를 모두 사용한 뒤 입력 파일에서 다음 압축 데이터를 읽어오는 함수
+ * inputReaderDetectFormat, inputReaderInflate 등에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param reader 입력을 읽는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환 (파일 끝이면 readEof 를 TRUE 로 설정)
+ */
+static int inputReaderFill(inputReader_t *reader)
+{
+	ssize_t readSize = 0;
+	do
+	{
+		readSize = read(reader->fd, reader->readBuffer + reader->readLength, INPUT_READ_SIZE - reader->readLength);
+	} while(readSize < 0 && errno == EINTR);
+
+	if(readSize < 0)
+	{
+		printf("[ERROR] 입력 파일 읽기 실패. (fileName:%s, errno:%d)\n", reader->path, errno);
+		return FAIL;
+	}
+
+	if(readSize == 0) reader->readEof = TRUE;
+	reader->readLength += (size_t)readSize;
+	reader->compressedByteNum += readSize;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int inputReaderDetectFormat(inputReader_t *reader)
+ * @brief 입력 파일 앞의 식별 바이트를 읽어 형식을 판단하고 압축 해제 상태를 초기화하는 함수
+ * 읽은 앞부분은 읽기 버퍼에 남겨두고 압축 해제(또는 그대로 반환)에 사용한다.
+ * inputReaderNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param reader 입력을 읽는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int inputReaderDetectFormat(inputReader_t *reader)
+{
+	static const unsigned char gzipMagic[2] = { 0x1f, 0x8b };
+	static const unsigned char zstdMagic[4] = { 0x28, 0xb5, 0x2f, 0xfd };
+
+	// 파이프처럼 짧게 읽히는 입력도 식별 바이트를 모두 볼 수 있도록 반복해서 읽는다.
+	while(reader->readLength < sizeof(zstdMagic) && reader->readEof == FALSE)
+	{
+		if(inputReaderFill(reader) == FAIL) return FAIL;
+	}
+
+	reader->format = INPUT_PLAIN;
+	if(reader->readLength >= sizeof(gzipMagic) && memcmp(reader->readBuffer, gzipMagic, sizeof(gzipMagic)) == 0)
+	{
+		reader->format = INPUT_GZIP;
+		reader->zStream.zalloc = Z_NULL;
+		reader->zStream.zfree = Z_NULL;
+		reader->zStream.opaque = Z_NULL;
+		reader->zStream.next_in = Z_NULL;
+		reader->zStream.avail_in = 0;
+		// 15 + 32 : 최대 윈도우 크기, gzip/zlib 헤더 자동 판단
+		if(inflateInit2(&(reader->zStream), 15 + 32) != Z_OK)
+		{
+			printf("[ERROR] gzip 압축 해제 초기화 실패. (fileName:%s)\n", reader->path);
+			return FAIL;
+		}
+		reader->zStreamReady = TRUE;
+	}
+	else if(reader->readLength >= sizeof(zstdMagic) && memcmp(reader->readBuffer, zstdMagic, sizeof(zstdMagic)) == 0)
+	{
+		reader->format = INPUT_ZSTD;
+#ifdef HAVE_ZSTD
+		reader->zstdStream = ZSTD_createDStream();
+		if(reader->zstdStream == NULL || ZSTD_isError(ZSTD_initDStream(reader->zstdStream)))
+		{
+			printf("[ERROR] zstd 압축 해제 초기화 실패. (fileName:%s)\n", reader->path);
+			return FAIL;
+		}
+#else
+		printf("[ERROR] zstd 압축 파일을 읽으려면 zstd 지원을 포함해서 빌드해야 함. (make ZSTD=1) (fileName:%s)\n", reader->path);
+		return FAIL;
+#endif
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static ssize_t inputReaderInflate(inputReader_t *reader, char *buffer, size_t size)
+ * @brief gzip 입력의 압축을 풀어 버퍼를 채우는 함수
+ * 한 멤버가 끝나고 입력이 남아있으면 다음 멤버로 이어서 푼다. (gzip a b > c, pigz 등이 만든 파일)
+ * inputReaderRead 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param reader 입력을 읽는 구조체(입력 및 출력)
+ * @param buffer 압축을 푼 데이터를 저장할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @return 성공 시 채운 바이트 수(입력 끝이면 0), 실패 시 -1 반환
+ */
+static ssize_t inputReaderInflate(inputReader_t *reader, char *buffer, size_t size)
+{
+	z_stream *zStream = &(reader->zStream);
+	uInt outSize = (size > UINT_MAX) ? UINT_MAX : (uInt)size;
+	zStream->next_out = (Bytef*)buffer;
+	zStream->avail_out = outSize;
+
+	while(zStream->avail_out > 0)
+	{
+		if(reader->readPos == reader->readLength && reader->readEof == FALSE)
+		{
+			reader->readPos = 0;
+			reader->readLength = 0;
+			if(inputReaderFill(reader) == FAIL) return -1;
+		}
+
+		uInt inSize = (uInt)(reader->readLength - reader->readPos);
+		if(inSize == 0 && reader->frameEnd == TRUE) break;
+
+		uInt outRemain = zStream->avail_out;
+		zStream->next_in = reader->readBuffer + reader->readPos;
+		zStream->avail_in = inSize;
+		int ret = inflate(zStream, Z_NO_FLUSH);
+		reader->readPos = reader->readLength - zStream->avail_in;
+
+		if(ret == Z_STREAM_END)
+		{
+			reader->frameEnd = TRUE;
+			if(inflateReset(zStream) != Z_OK) return -1;
+			continue;
+		}
+		if(ret != Z_OK && ret != Z_BUF_ERROR)
+		{
+			printf("[ERROR] gzip 압축 해제 실패. (fileName:%s, offset:%lld, message:%s)\n", reader->path,
+				reader->compressedByteNum - (long long)(reader->readLength - reader->readPos), (zStream->msg != NULL) ? zStream->msg : "-");
+			return -1;
+		}
+		reader->frameEnd = FALSE;
+
+		// 입력이 끝났는데 더 풀 수 있는 데이터도 없으면 멈춘다.
+		if(inSize == 0 && zStream->avail_out == outRemain) break;
+	}
+
+	ssize_t readSize = (ssize_t)(outSize - zStream->avail_out);
+	if(readSize == 0 && reader->frameEnd == FALSE)
+	{
+		printf("[ERROR] gzip 파일이 중간에 잘림. (fileName:%s)\n", reader->path);
+		return -1;
+	}
+	return readSize;
+}
+
+#ifdef HAVE_ZSTD
+/**
+ * @fn static ssize_t inputReaderDecompressZstd(inputReader_t *reader, char *buffer, size_t size)
+ * @brief zstd 입력의 압축을 풀어 버퍼를 채우는 함수 (이어진 여러 프레임을 차례로 푼다)
+ * inputReaderRead 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param reader 입력을 읽는 구조체(입력 및 출력)
+ * @param buffer 압축을 푼 데이터를 저장할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @return 성공 시 채운 바이트 수(입력 끝이면 0), 실패 시 -1 반환
+ */
+static ssize_t inputReaderDecompressZstd(inputReader_t *reader, char *buffer, size_t size)
+{
+	ZSTD_outBuffer output = { buffer, size, 0 };
+
+	while(output.pos < output.size)
+	{
+		if(reader->readPos == reader->readLength && reader->readEof == FALSE)
+		{
+			reader->readPos = 0;
+			reader->readLength = 0;
+			if(inputReaderFill(reader) == FAIL) return -1;
+		}
+
+		ZSTD_inBuffer input = { reader->readBuffer + reader->readPos, reader->readLength - reader->readPos, 0 };
+		if(input.size == 0 && reader->frameEnd == TRUE) break;
+
+		size_t outPos = output.pos;
+		size_t ret = ZSTD_decompressStream(reader->zstdStream, &output, &input);
+		reader->readPos += input.pos;
+		if(ZSTD_isError(ret))
+		{
+			printf("[ERROR] zstd 압축 해제 실패. (fileName:%s, message:%s)\n", reader->path, ZSTD_getErrorName(ret));
+			return -1;
+		}
+		// 0 이면 프레임 하나가 끝나고 출력도 모두 내보낸 상태
+		reader->frameEnd = (ret == 0) ? TRUE : FALSE;
+
+		if(input.size == 0 && output.pos == outPos) break;
+	}
+
+	if(output.pos == 0 && reader->frameEnd == FALSE)
+	{
+		printf("[ERROR] zstd 파일이 중간에 잘림. (fileName:%s)\n", reader->path);
+		return -1;
+	}
+	return (ssize_t)output.pos;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for inputManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void* inputManagerRunThread(void *data)
+ * @brief 빈 구간 버퍼를 받아 압축을 푼 입력으로 채우고 소비하는 쪽에 넘기는 압축 해제 스레드 함수
+ * @param data 파이프라인 구조체(inputManager_t)
+ * @return 항상 NULL 반환
+ */
+static void* inputManagerRunThread(void *data)
+{
+	inputManager_t *inputManager = (inputManager_t*)data;
+	int result = SUCCESS;
+	int eof = FALSE;
+
+	while(eof == FALSE)
+	{
+		recordBuffer_t *chunk = inputManagerWaitFree(inputManager);
+		if(chunk == NULL) break;
+
+		result = inputManagerFillChunk(inputManager, chunk, &eof);
+		if(result == FAIL) break;
+
+		if(chunk->length > 0) inputManagerPublish(inputManager);
+	}
+
+	pthread_mutex_lock(&(inputManager->mutex));
+	inputManager->done = TRUE;
+	if(result == FAIL) inputManager->failed = TRUE;
+	pthread_cond_broadcast(&(inputManager->notEmpty));
+	pthread_mutex_unlock(&(inputManager->mutex));
+
+	return NULL;
+}
+
+/**
+ * @fn static int inputManagerFillChunk(inputManager_t *inputManager, recordBuffer_t *chunk, int *eof)
+ * @brief 이전 구간에서 넘어온 잘린 레코드 뒤에 압축을 푼 입력을 채우고 마지막 개행 문자 뒤를 다음 구간으로 넘기는 함수
+ * 레코드 하나가 버퍼보다 길면 버퍼를 늘린다.
+ * inputManagerRunThread 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param inputManager 파이프라인 구조체(입력 및 출력)
+ * @param chunk 채울 구간 버퍼(출력)
+ * @param eof 입력이 끝났는지 여부(출력, TRUE 또는 FALSE)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int inputManagerFillChunk(inputManager_t *inputManager, recordBuffer_t *chunk, int *eof)
+{
+	recordBuffer_t *carry = &(inputManager->carry);
+
+	chunk->length = 0;
+	if(carry->length > 0)
+	{
+		if(inputChunkReserve(chunk, carry->length * 2) == FAIL) return FAIL;
+		memcpy(chunk->data, carry->data, carry->length);
+		chunk->length = carry->length;
+		carry->length = 0;
+	}
+
+	const char *lastNewLine = NULL;
+	while(1)
+	{
+		if(chunk->length == chunk->capacity)
+		{
+			lastNewLine = (const char*)memrchr(chunk->data, '\n', chunk->length);
+			if(lastNewLine != NULL) break;
+			if(inputChunkReserve(chunk, chunk->capacity * 2) == FAIL) return FAIL;
+		}
+
+		ssize_t readSize = inputReaderRead(inputManager->reader, chunk->data + chunk->length, chunk->capacity - chunk->length);
+		if(readSize < 0) return FAIL;
+		if(readSize == 0)
+		{
+			*eof = TRUE;
+			return SUCCESS;
+		}
+		chunk->length += (size_t)readSize;
+	}
+
+	size_t usedLength = (size_t)(lastNewLine - chunk->data) + 1;
+	if(recordBufferAppend(carry, chunk->data + usedLength, chunk->length - usedLength) == FAIL) return FAIL;
+	chunk->length = usedLength;
+	return SUCCESS;
+}
+
+/**
+ * @fn static recordBuffer_t* inputManagerWaitFree(inputManager_t *inputManager)
+ * @brief 빈 구간 버퍼가 생길 때까지 기다렸다가 다음에 채울 버퍼를 반환하는 함수
+ * 버퍼는 링 순서대로 사용되므로 채워진 버퍼 개수가 INPUT_CHUNK_NUM 보다 작으면 링 끝의 버퍼는 비어있다.
+ * inputManagerRunThread 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param inputManager 파이프라인 구조체(입력 및 출력)
+ * @return 성공 시 채울 구간 버퍼, 중단 요청을 받으면 NULL 반환
+ */
+static recordBuffer_t* inputManagerWaitFree(inputManager_t *inputManager)
+{
+	recordBuffer_t *chunk = NULL;
+
+	pthread_mutex_lock(&(inputManager->mutex));
+	if(inputManager->count == INPUT_CHUNK_NUM && inputManager->stopped == FALSE) inputManager->stallNum++;
+	while(inputManager->count == INPUT_CHUNK_NUM && inputManager->stopped == FALSE)
+	{
+		pthread_cond_wait(&(inputManager->notFull), &(inputManager->mutex));
+	}
+
+	if(inputManager->stopped == FALSE)
+	{
+		chunk = &(inputManager->chunkList[(inputManager->head + inputManager->count) % INPUT_CHUNK_NUM]);
+	}
+	pthread_mutex_unlock(&(inputManager->mutex));
+
+	return chunk;
+}
+
+/**
+ * @fn static void inputManagerPublish(inputManager_t *inputManager)
+ * @brief inputManagerWaitFree 로 받아 채운 구간 버퍼를 소비하는 쪽에 넘기는 함수
+ * inputManagerRunThread 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param inputManager 파이프라인 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void inputManagerPublish(inputManager_t *inputManager)
+{
+	pthread_mutex_lock(&(inputManager->mutex));
+	inputManager->count++;
+	pthread_cond_signal(&(inputManager->notEmpty));
+	pthread_mutex_unlock(&(inputManager->mutex));
+}
+
+/**
+ * @fn static int inputChunkReserve(recordBuffer_t *chunk, size_t capacity)
+ * @brief 구간 버퍼가 지정한 크기 이상이 되도록 늘리는 함수 (이미 크면 그대로 둔다)
+ * @param chunk 늘릴 구간 버퍼(입력 및 출력)
+ * @param capacity 필요한 크기(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int inputChunkReserve(recordBuffer_t *chunk, size_t capacity)
+{
+	if(chunk->data != NULL && chunk->capacity >= capacity) return SUCCESS;
+
+	char *data = (char*)hugeRealloc(chunk->data, capacity);
+	if(data == NULL)
+	{
+		printf("[DEBUG] 구간 버퍼 크기 확장 실패. NULL. (capacity:%zu)\n", capacity);
+		return FAIL;
+	}
+
+	chunk->data = data;
+	chunk->capacity = capacity;
+	return SUCCESS;
+}
@@ -0,0 +1,139 @@
+#ifndef __INPUT_MANAGER_H__
+#define __INPUT_MANAGER_H__
+
+#include <pthread.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "recordManager.h"
+#include "checkpointManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 압축된 입력 파일을 한 번에 읽는 크기 (바이트)
+#define INPUT_READ_SIZE		(256 * 1024)
+// 압축을 푼 레코드 구간 버퍼 크기 (바이트, 구간은 개행 문자 경계에서 나뉜다)
+#define INPUT_CHUNK_SIZE	(4 * 1024 * 1024)
+// 압축 해제 스레드와 등급 판단 사이의 구간 버퍼 개수 (사용하는 메모리의 상한)
+#define INPUT_CHUNK_NUM		4
+
+// 입력 파일 형식 열거형 (파일 앞의 식별 바이트로 판단)
+enum INPUT_FORMAT
+{
+	INPUT_PLAIN = 0,	// 압축되지 않은 텍스트
+	INPUT_GZIP,			// gzip (1f 8b)
+	INPUT_ZSTD			// zstd (28 b5 2f fd)
+};
+
+/**
+ * @struct inputReader_t
+ * @brief 입력 파일 형식을 판단해서 압축을 풀며 순차적으로 읽는 구조체
+ * 여러 개의 gzip 멤버나 zstd 프레임이 이어진 파일도 하나의 입력으로 읽는다.
+ * zstd 는 HAVE_ZSTD 로 빌드한 경우에만 풀 수 있다. (make ZSTD=1)
+ */
+typedef struct inputReader_s inputReader_t;
+struct inputReader_s
+{
+	// 입력 파일 경로
+	char path[PATH_MAX];
+	// 입력 파일 디스크립터
+	int fd;
+	// 입력 파일 형식 (INPUT_FORMAT)
+	int format;
+	// 압축된 데이터 읽기 버퍼
+	unsigned char *readBuffer;
+	// 읽기 버퍼에 있는 데이터 길이
+	size_t readLength;
+	// 읽기 버퍼에서 다음에 사용할 위치
+	size_t readPos;
+	// 입력 파일 끝에 도달했는지 여부 (TRUE 또는 FALSE)
+	int readEof;
+	// 압축 해제가 끝났는지 여부 (TRUE 또는 FALSE)
+	int eof;
+	// gzip 압축 해제 상태
+	z_stream zStream;
+	// zStream 초기화 여부 (TRUE 또는 FALSE)
+	int zStreamReady;
+#ifdef HAVE_ZSTD
+	// zstd 압축 해제 상태
+	ZSTD_DStream *zstdStream;
+#endif
+	// 마지막 gzip 멤버 또는 zstd 프레임이 끝났는지 여부 (입력이 끝났을 때 FALSE 면 잘린 파일)
+	int frameEnd;
+	// 입력 파일에서 읽은 바이트 수
+	long long compressedByteNum;
+	// 압축을 푼 바이트 수
+	long long byteNum;
+};
+
+/**
+ * @struct inputManager_t
+ * @brief 압축 해제 스레드가 입력을 개행 문자 경계의 구간으로 나눠 고정 개수의 버퍼로 넘겨주는 파이프라인 구조체
+ * <처리 흐름>
+ * 입력 파일 -> 압축 해제 스레드(inputReader_t) -> 구간 버퍼 링 (INPUT_CHUNK_NUM 개) -> 호출한 스레드(레코드 분석, 등급 판단)
+ * 압축 해제와 등급 판단이 동시에 진행되고, 소비가 늦으면 압축 해제 스레드가 빈 버퍼를 기다린다.
+ */
+typedef struct inputManager_s inputManager_t;
+struct inputManager_s
+{
+	// 입력을 읽는 구조체 (압축 해제 스레드만 사용)
+	inputReader_t *reader;
+	// 구간 버퍼 목록
+	recordBuffer_t chunkList[INPUT_CHUNK_NUM];
+	// 구간 뒤에 잘린 레코드를 다음 구간으로 넘기기 위한 버퍼
+	recordBuffer_t carry;
+	// 구간 버퍼 링 접근 동기화
+	pthread_mutex_t mutex;
+	// 채워진 구간이 생겼음을 알리는 조건 변수
+	pthread_cond_t notEmpty;
+	// 빈 구간 버퍼가 생겼음을 알리는 조건 변수
+	pthread_cond_t notFull;
+	// 다음에 소비할 구간 버퍼 위치
+	int head;
+	// 채워진 구간 버퍼 개수
+	int count;
+	// 소비 중인 구간이 있는지 여부 (TRUE 또는 FALSE)
+	int consuming;
+	// 압축 해제 스레드가 입력을 모두 넘겼는지 여부 (TRUE 또는 FALSE)
+	int done;
+	// 압축 해제 중 오류 발생 여부 (TRUE 또는 FALSE)
+	int failed;
+	// 소비하는 쪽이 중단을 요청했는지 여부 (TRUE 또는 FALSE)
+	int stopped;
+	// 압축 해제 스레드
+	pthread_t thread;
+	// 압축 해제 스레드 실행 여부 (TRUE 또는 FALSE)
+	int threadStarted;
+	// 소비하는 쪽이 빈 버퍼를 기다린 횟수 (압축 해제가 병목인 정도)
+	long long starveNum;
+	// 압축 해제 스레드가 빈 버퍼를 기다린 횟수 (등급 판단이 병목인 정도)
+	long long stallNum;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for inputReader_t
+//////////////////////////////////////////////////////////////////////////
+
+inputReader_t* inputReaderNew(const char *path);
+void inputReaderDelete(inputReader_t **reader);
+ssize_t inputReaderRead(inputReader_t *reader, char *buffer, size_t size);
+int inputReaderSkip(inputReader_t *reader, long long byteNum);
+const char* inputGetFormatName(int format);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for inputManager_t
+//////////////////////////////////////////////////////////////////////////
+
+inputManager_t* inputManagerNew(const char *path, long long startOffset);
+void inputManagerDelete(inputManager_t **inputManager);
+const recordBuffer_t* inputManagerNext(inputManager_t *inputManager);
+void inputManagerRelease(inputManager_t *inputManager);
+int inputManagerGradeFile(inputManager_t *inputManager, const gradeManager_t *gradeManager, const char *outputFileName, checkpoint_t *checkpoint, gradeStats_t *stats);
+
+#endif // #ifndef __INPUT_MANAGER_H__
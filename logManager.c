@@ -0,0 +1,353 @@
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "gradeManager.h"
+#include "logManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Global Variables
+//////////////////////////////////////////////////////////////////////////
+
+// 프로그램 전체에서 하나만 사용하는 로그 관리 구조체
+static logManager_t logManager;
+// 현재 스레드가 메시지를 모으는 상태 (logCaptureBegin ~ logCaptureEnd 사이)
+static __thread logCapture_t logCapture;
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for logManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static void* logManagerRunThread(void *data);
+static int logManagerDrain(logManager_t *manager);
+static int logManagerEnqueue(logManager_t *manager, int level, const char *format, va_list args);
+static void logManagerPost(logManager_t *manager, int level, const char *format, ...) __attribute__((format(printf, 3, 4)));
+static int logSiteAllow(logSite_t *site, int *reportNum);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for logManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int logManagerStart(void)
+ * @brief 링 버퍼를 초기화하고 메시지를 출력하는 기록 스레드를 시작하는 함수
+ * 시작하기 전이나 시작에 실패한 경우 메시지는 호출한 스레드에서 바로 출력된다.
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int logManagerStart(void)
+{
+	if(__atomic_load_n(&(logManager.running), __ATOMIC_ACQUIRE) == TRUE)
+	{
+		return SUCCESS;
+	}
+
+	size_t slotIndex = 0;
+	for( ; slotIndex < LOG_RING_SIZE; slotIndex++)
+	{
+		logManager.slotList[slotIndex].sequence = slotIndex;
+	}
+	logManager.enqueuePos = 0;
+	logManager.dequeuePos = 0;
+	logManager.droppedNum = 0;
+	logManager.suppressedNum = 0;
+
+	__atomic_store_n(&(logManager.running), TRUE, __ATOMIC_RELEASE);
+	if(pthread_create(&(logManager.thread), NULL, logManagerRunThread, &logManager) != 0)
+	{
+		__atomic_store_n(&(logManager.running), FALSE, __ATOMIC_RELEASE);
+		printf("[ERROR] 로그 기록 스레드 생성 실패. 메시지를 바로 출력함.\n");
+		return FAIL;
+	}
+	return SUCCESS;
+}
+
+/**
+ * @fn void logManagerStop(void)
+ * @brief 기록 스레드를 멈추고 링 버퍼에 남은 메시지를 모두 출력하는 함수
+ * 버리거나 생략한 메시지가 있으면 개수를 함께 출력한다. atexit 에 등록해서 사용할 수 있다.
+ * @return 반환값 없음
+ */
+void logManagerStop(void)
+{
+	if(__atomic_load_n(&(logManager.running), __ATOMIC_ACQUIRE) == FALSE)
+	{
+		return;
+	}
+
+	__atomic_store_n(&(logManager.running), FALSE, __ATOMIC_RELEASE);
+	pthread_join(logManager.thread, NULL);
+	while(logManagerDrain(&logManager) > 0);
+
+	long long droppedNum = __atomic_load_n(&(logManager.droppedNum), __ATOMIC_RELAXED);
+	long long suppressedNum = __atomic_load_n(&(logManager.suppressedNum), __ATOMIC_RELAXED);
+	if(droppedNum > 0 || suppressedNum > 0)
+	{
+		printf("[로그] 버린 메시지 %lld 개, 생략한 메시지 %lld 개\n", droppedNum, suppressedNum);
+	}
+	fflush(stdout);
+}
+
+/**
+ * @fn void logFlush(void)
+ * @brief 지금까지 남긴 메시지가 모두 출력될 때까지 기다리는 함수
+ * 로그 메시지와 표준 출력으로 바로 내보내는 결과의 순서를 맞춰야 할 때 사용한다.
+ * 기다릴 메시지가 없으면 바로 반환한다.
+ * @return 반환값 없음
+ */
+void logFlush(void)
+{
+	if(logCapture.buffer != NULL || __atomic_load_n(&(logManager.running), __ATOMIC_ACQUIRE) == FALSE)
+	{
+		return;
+	}
+
+	size_t target = __atomic_load_n(&(logManager.enqueuePos), __ATOMIC_ACQUIRE);
+	while(__atomic_load_n(&(logManager.dequeuePos), __ATOMIC_ACQUIRE) < target)
+	{
+		if(__atomic_load_n(&(logManager.running), __ATOMIC_ACQUIRE) == FALSE) break;
+		usleep(LOG_IDLE_USEC / 10);
+	}
+}
+
+/**
+ * @fn void logWrite(int level, logSite_t *site, const char *format, ...)
+ * @brief 메시지를 링 버퍼에 넣는 함수 (LOG_DEBUG, LOG_INFO, LOG_ERROR 매크로에서 호출)
+ * 메시지 앞뒤의 문자열([ERROR], 개행 등)은 그대로 출력되므로 호출하는 쪽에서 지정한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 형식 문자열에 대한 NULL 체크를 수행한다.
+ * @param level 로그 수준(입력)
+ * @param site 호출 위치의 빈도 제한 상태(입력, 출력), NULL 이면 제한하지 않음
+ * @param format printf 형식 문자열(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void logWrite(int level, logSite_t *site, const char *format, ...)
+{
+	if(format == NULL || level >= LOG_LEVEL_NONE) return;
+
+	// 메시지를 모으는 스레드는 진행 상황(INFO)을 버리고 첫 DEBUG/ERROR 메시지만 개행 없이 보관한다.
+	if(logCapture.buffer != NULL)
+	{
+		if(level != LOG_LEVEL_INFO && logCapture.messageNum++ == 0)
+		{
+			va_list args;
+			va_start(args, format);
+			vsnprintf(logCapture.buffer, logCapture.size, format, args);
+			va_end(args);
+			logCapture.buffer[strcspn(logCapture.buffer, "\n")] = '\0';
+		}
+		return;
+	}
+
+	// 진행 상황(INFO)은 생략하지 않고, 반복될 수 있는 DEBUG 와 ERROR 만 호출 위치별로 제한한다.
+	int reportNum = 0;
+	if(level != LOG_LEVEL_INFO && site != NULL && logSiteAllow(site, &reportNum) == FALSE)
+	{
+		return;
+	}
+
+	va_list args;
+	va_start(args, format);
+	if(__atomic_load_n(&(logManager.running), __ATOMIC_ACQUIRE) == FALSE)
+	{
+		if(reportNum > 0) printf("[로그] 같은 위치의 메시지 %d 개 생략됨.\n", reportNum);
+		vprintf(format, args);
+	}
+	else
+	{
+		if(reportNum > 0) logManagerPost(&logManager, level, "[로그] 같은 위치의 메시지 %d 개 생략됨.\n", reportNum);
+		if(logManagerEnqueue(&logManager, level, format, args) == FAIL)
+		{
+			__atomic_add_fetch(&(logManager.droppedNum), 1, __ATOMIC_RELAXED);
+		}
+	}
+	va_end(args);
+}
+
+/**
+ * @fn void logCaptureBegin(char *buffer, size_t size)
+ * @brief 현재 스레드의 메시지를 출력하지 않고 버퍼에 모으기 시작하는 함수
+ * INFO 메시지는 버리고 처음 남긴 DEBUG/ERROR 메시지만 버퍼에 저장한다. 빈도 제한도 받지 않는다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 버퍼에 대한 NULL 체크를 수행한다.
+ * @param buffer 메시지를 저장할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @return 반환값 없음
+ */
+void logCaptureBegin(char *buffer, size_t size)
+{
+	if(buffer == NULL || size == 0)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (buffer:%p, size:%zu)\n", (void*)buffer, size);
+		return;
+	}
+
+	buffer[0] = '\0';
+	logCapture.buffer = buffer;
+	logCapture.size = size;
+	logCapture.messageNum = 0;
+}
+
+/**
+ * @fn int logCaptureEnd(void)
+ * @brief 현재 스레드의 메시지 모으기를 끝내고 다시 출력하게 하는 함수
+ * @return 모으는 동안 남긴 DEBUG/ERROR 메시지 개수 반환
+ */
+int logCaptureEnd(void)
+{
+	int messageNum = logCapture.messageNum;
+	logCapture.buffer = NULL;
+	logCapture.size = 0;
+	logCapture.messageNum = 0;
+	return messageNum;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for logManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void* logManagerRunThread(void *data)
+ * @brief 링 버퍼의 메시지를 순서대로 표준 출력에 쓰는 기록 스레드 함수
+ * 링 버퍼가 비어있으면 LOG_IDLE_USEC 만큼 쉬고, 멈추라는 요청을 받으면 남은 메시지를 비운 뒤 종료한다.
+ * @param data 로그 관리 구조체(입력)
+ * @return 항상 NULL 반환
+ */
+static void* logManagerRunThread(void *data)
+{
+	logManager_t *manager = (logManager_t*)data;
+
+	while(__atomic_load_n(&(manager->running), __ATOMIC_ACQUIRE) == TRUE)
+	{
+		if(logManagerDrain(manager) == 0) usleep(LOG_IDLE_USEC);
+	}
+	while(logManagerDrain(manager) > 0);
+
+	return NULL;
+}
+
+/**
+ * @fn static int logManagerDrain(logManager_t *manager)
+ * @brief 채워진 슬롯을 순서대로 꺼내 출력하는 함수
+ * 예약만 되고 아직 채워지지 않은 슬롯을 만나면 그 앞까지만 출력한다. 기록 스레드 또는 멈춘 뒤에만 호출된다.
+ * logManagerRunThread, logManagerStop 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param manager 로그 관리 구조체(입력, 출력)
+ * @return 출력한 메시지 개수 반환
+ */
+static int logManagerDrain(logManager_t *manager)
+{
+	int messageNum = 0;
+	size_t pos = __atomic_load_n(&(manager->dequeuePos), __ATOMIC_RELAXED);
+
+	while(1)
+	{
+		logSlot_t *slot = &(manager->slotList[pos & (LOG_RING_SIZE - 1)]);
+		if(__atomic_load_n(&(slot->sequence), __ATOMIC_ACQUIRE) != pos + 1) break;
+
+		fwrite(slot->text, 1, (size_t)slot->length, stdout);
+		__atomic_store_n(&(slot->sequence), pos + LOG_RING_SIZE, __ATOMIC_RELEASE);
+		pos++;
+		__atomic_store_n(&(manager->dequeuePos), pos, __ATOMIC_RELEASE);
+		messageNum++;
+	}
+	return messageNum;
+}
+
+/**
+ * @fn static int logManagerEnqueue(logManager_t *manager, int level, const char *format, va_list args)
+ * @brief 빈 슬롯 하나를 예약해서 메시지를 채우는 함수
+ * 슬롯별 순번을 비교해서 비어있는 슬롯만 CAS 로 예약하므로 잠금 없이 여러 스레드가 동시에 호출할 수 있다.
+ * 링 버퍼가 가득 차면 INFO 수준은 자리가 날 때까지 기다리고 나머지는 실패를 반환한다.
+ * logWrite 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param manager 로그 관리 구조체(입력, 출력)
+ * @param level 로그 수준(입력)
+ * @param format printf 형식 문자열(입력, 읽기 전용)
+ * @param args 형식 문자열의 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 링 버퍼가 가득 차서 버린 경우 FAIL 반환
+ */
+static int logManagerEnqueue(logManager_t *manager, int level, const char *format, va_list args)
+{
+	logSlot_t *slot = NULL;
+	size_t pos = __atomic_load_n(&(manager->enqueuePos), __ATOMIC_RELAXED);
+
+	while(1)
+	{
+		slot = &(manager->slotList[pos & (LOG_RING_SIZE - 1)]);
+		size_t sequence = __atomic_load_n(&(slot->sequence), __ATOMIC_ACQUIRE);
+		long diff = (long)sequence - (long)pos;
+
+		if(diff == 0)
+		{
+			if(__atomic_compare_exchange_n(&(manager->enqueuePos), &pos, pos + 1, FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+		}
+		else if(diff < 0)
+		{
+			// 가득 참 : 기록 스레드가 멈춘 뒤라면 기다려도 비워지지 않는다.
+			if(level != LOG_LEVEL_INFO || __atomic_load_n(&(manager->running), __ATOMIC_ACQUIRE) == FALSE) return FAIL;
+			usleep(LOG_IDLE_USEC / 10);
+			pos = __atomic_load_n(&(manager->enqueuePos), __ATOMIC_RELAXED);
+		}
+		else
+		{
+			pos = __atomic_load_n(&(manager->enqueuePos), __ATOMIC_RELAXED);
+		}
+	}
+
+	int length = vsnprintf(slot->text, LOG_MESSAGE_LEN, format, args);
+	if(length < 0) length = 0;
+	else if(length >= LOG_MESSAGE_LEN) length = LOG_MESSAGE_LEN - 1;
+	slot->length = length;
+	__atomic_store_n(&(slot->sequence), pos + 1, __ATOMIC_RELEASE);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void logManagerPost(logManager_t *manager, int level, const char *format, ...)
+ * @brief 가변 인자로 받은 메시지를 링 버퍼에 넣는 함수 (로그 관리 구조체가 직접 남기는 메시지용)
+ * logWrite 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param manager 로그 관리 구조체(입력, 출력)
+ * @param level 로그 수준(입력)
+ * @param format printf 형식 문자열(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void logManagerPost(logManager_t *manager, int level, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	if(logManagerEnqueue(manager, level, format, args) == FAIL)
+	{
+		__atomic_add_fetch(&(manager->droppedNum), 1, __ATOMIC_RELAXED);
+	}
+	va_end(args);
+}
+
+/**
+ * @fn static int logSiteAllow(logSite_t *site, int *reportNum)
+ * @brief 호출 위치별로 1 초 동안 LOG_RATE_BURST 개까지만 메시지를 허용하는 함수
+ * 새 1 초 구간이 시작되면 이전 구간에서 생략한 개수를 reportNum 으로 돌려주어 한 번 알리게 한다.
+ * 여러 스레드가 동시에 구간을 바꾸는 경우 개수가 조금 어긋날 수 있지만 제한 용도로는 충분하다.
+ * logWrite 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param site 호출 위치의 빈도 제한 상태(입력, 출력)
+ * @param reportNum 이전 구간에서 생략한 메시지 개수(출력)
+ * @return 허용 시 TRUE, 생략해야 하면 FALSE 반환
+ */
+static int logSiteAllow(logSite_t *site, int *reportNum)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+
+	long window = __atomic_load_n(&(site->window), __ATOMIC_RELAXED);
+	if(window != (long)now.tv_sec
+		&& __atomic_compare_exchange_n(&(site->window), &window, (long)now.tv_sec, FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+	{
+		__atomic_store_n(&(site->count), 0, __ATOMIC_RELAXED);
+		*reportNum = __atomic_exchange_n(&(site->suppressed), 0, __ATOMIC_RELAXED);
+	}
+
+	if(__atomic_add_fetch(&(site->count), 1, __ATOMIC_RELAXED) <= LOG_RATE_BURST)
+	{
+		return TRUE;
+	}
+
+	__atomic_add_fetch(&(site->suppressed), 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&(logManager.suppressedNum), 1, __ATOMIC_RELAXED);
+	return FALSE;
+}
@@ -0,0 +1,150 @@
+#ifndef __LOG_MANAGER_H__
+#define __LOG_MANAGER_H__
+
+#include <stddef.h>
+#include <pthread.h>
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 로그 수준 (값이 클수록 중요한 메시지)
+#define LOG_LEVEL_DEBUG	0
+#define LOG_LEVEL_INFO	1
+#define LOG_LEVEL_ERROR	2
+#define LOG_LEVEL_NONE	3
+
+// 이 수준보다 낮은 메시지는 컴파일 단계에서 제거된다. (make LOG_LEVEL=2 등으로 지정)
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL	LOG_LEVEL_DEBUG
+#endif
+
+// 링 버퍼 슬롯 개수 (2 의 거듭제곱)
+#define LOG_RING_SIZE		1024
+// 메시지 하나의 최대 길이 (넘는 부분은 잘린다)
+#define LOG_MESSAGE_LEN		256
+// 호출 위치 하나가 1 초 동안 남길 수 있는 메시지 개수 (INFO 수준은 제한하지 않는다)
+#define LOG_RATE_BURST		100
+// 링 버퍼가 비어있을 때 기록 스레드가 쉬는 시간 (마이크로초)
+#define LOG_IDLE_USEC		1000
+
+// 수준별 로그 매크로
+// 호출 위치마다 정적 logSite_t 를 두어 같은 메시지가 반복될 때 위치별로 개수를 제한한다.
+#define LOG_WRITE(level, ...) \
+	do \
+	{ \
+		static logSite_t logSite__; \
+		logWrite((level), &logSite__, __VA_ARGS__); \
+	} while(0)
+
+// 제거된 수준의 매크로도 인자의 형식 검사는 받도록 if(0) 안에 남겨둔다.
+#define LOG_DISCARD(...) \
+	do \
+	{ \
+		if(0) logWrite(LOG_LEVEL_NONE, NULL, __VA_ARGS__); \
+	} while(0)
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...)	LOG_WRITE(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...)	LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(...)	LOG_WRITE(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...)	LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(...)	LOG_WRITE(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...)	LOG_DISCARD(__VA_ARGS__)
+#endif
+
+/**
+ * @struct logSite_t
+ * @brief 로그 호출 위치 하나의 빈도 제한 상태를 저장하는 구조체
+ * 매크로가 호출 위치마다 정적 변수로 만들기 때문에 0 으로 초기화된 상태에서 시작한다.
+ */
+typedef struct logSite_s logSite_t;
+struct logSite_s
+{
+	// 현재 제한 구간의 시작 시각 (초)
+	long window;
+	// 현재 구간에서 남긴 메시지 개수
+	int count;
+	// 현재 구간에서 생략한 메시지 개수
+	int suppressed;
+};
+
+/**
+ * @struct logSlot_t
+ * @brief 링 버퍼의 메시지 슬롯 구조체
+ * sequence 는 슬롯 위치(pos)에 대해 pos 이면 비어있음, pos + 1 이면 채워짐을 뜻한다.
+ */
+typedef struct logSlot_s logSlot_t;
+struct logSlot_s
+{
+	// 슬롯 순번
+	size_t sequence;
+	// 메시지 길이
+	int length;
+	// 메시지 내용
+	char text[LOG_MESSAGE_LEN];
+};
+
+/**
+ * @struct logManager_t
+ * @brief 여러 스레드가 남긴 메시지를 잠금 없는 링 버퍼에 넣고 기록 스레드 하나가 표준 출력으로 내보내는 구조체
+ * 메시지를 남기는 스레드는 슬롯 하나를 CAS 로 예약해서 채우기만 하므로 출력 때문에 기다리지 않는다.
+ * 링 버퍼가 가득 차면 INFO 수준은 자리가 날 때까지 기다리고, 나머지 수준은 버리고 개수만 센다.
+ * 기록 스레드를 시작하지 않은 프로그램(gradeGen, gradeDecode 등)에서는 바로 출력한다.
+ */
+typedef struct logManager_s logManager_t;
+struct logManager_s
+{
+	// 메시지 슬롯 배열
+	logSlot_t slotList[LOG_RING_SIZE];
+	// 다음에 예약할 위치 (여러 스레드가 CAS 로 증가)
+	size_t enqueuePos;
+	// 다음에 꺼낼 위치 (기록 스레드만 증가)
+	size_t dequeuePos;
+	// 기록 스레드
+	pthread_t thread;
+	// 기록 스레드 실행 여부 (TRUE 또는 FALSE)
+	int running;
+	// 링 버퍼가 가득 차서 버린 메시지 개수
+	long long droppedNum;
+	// 빈도 제한으로 생략한 메시지 개수
+	long long suppressedNum;
+};
+
+/**
+ * @struct logCapture_t
+ * @brief 한 스레드가 남기는 메시지를 출력하지 않고 모으는 상태 구조체
+ * 여러 파일을 동시에 읽는 작업 스레드가 파일별 오류를 따로 보관할 때 사용한다.
+ */
+typedef struct logCapture_s logCapture_t;
+struct logCapture_s
+{
+	// 첫 DEBUG/ERROR 메시지를 저장할 버퍼 (NULL 이면 모으지 않음)
+	char *buffer;
+	// 버퍼 크기
+	size_t size;
+	// 모은 DEBUG/ERROR 메시지 개수
+	int messageNum;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for logManager_t
+//////////////////////////////////////////////////////////////////////////
+
+int logManagerStart(void);
+void logManagerStop(void);
+void logFlush(void);
+void logWrite(int level, logSite_t *site, const char *format, ...) __attribute__((format(printf, 3, 4)));
+void logCaptureBegin(char *buffer, size_t size);
+int logCaptureEnd(void);
+
+#endif // #ifndef __LOG_MANAGER_H__
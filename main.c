@@ -1,4 +1,20 @@
+#include <signal.h>
+#include <time.h>
+
 #include "gradeManager.h"
+#include "batchManager.h"
+#include "perfManager.h"
+#include "compositeManager.h"
+#include "packManager.h"
+#include "partitionManager.h"
+#include "cacheManager.h"
+#include "deltaManager.h"
+#include "inputManager.h"
+#include "sampleManager.h"
+#include "courseManager.h"
+#include "watchManager.h"
+#include "whatifManager.h"
+#include "groupManager.h"
 
 //////////////////////////////////////////////////////////////////////////
 /// Macro
@@ -6,16 +22,87 @@
 
 // 등급이 판단될 점수 배열의 전체 길이
 #define MAX_INPUT_NUM 14
+// 등급 정보를 가지는 ini 파일 이름
+#define GRADE_INI_FILE "./grade.ini"
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Variables
+//////////////////////////////////////////////////////////////////////////
+
+// SIGINT, SIGTERM 을 받으면 종료를 요청할 감시 객체
+static watchManager_t *watchTarget = NULL;
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static int runDemo(void);
+static int runBatch(int argc, char **argv);
+static int runProfile(int argc, char **argv);
+static int runProfilePhases(perfReport_t *report, const char *scoreFileName, int repeatNum, const char *outputFileName, int width);
+static int runComposite(int argc, char **argv);
+static int runPack(int argc, char **argv);
+static int runPartition(int argc, char **argv);
+static int runCached(int argc, char **argv);
+static int runDelta(int argc, char **argv);
+static int runStream(int argc, char **argv);
+static int runSample(int argc, char **argv);
+static int runCourses(int argc, char **argv);
+static void printCourse(const char *courseName, const gradeManager_t *gradeManager);
+static int runWatch(int argc, char **argv);
+static void onWatchSignal(int signalNumber);
+static int runWhatif(int argc, char **argv);
+static int runGroupby(int argc, char **argv);
+static void printUsage(const char *programName);
 
 //////////////////////////////////////////////////////////////////////////
 /// Main Function
 //////////////////////////////////////////////////////////////////////////
 
-int main()
+int main(int argc, char **argv)
+{
+	// 진단 메시지는 기록 스레드가 출력하고, 종료할 때 남은 메시지와 버린 개수를 출력한다.
+	if(logManagerStart() == SUCCESS) atexit(logManagerStop);
+
+	if(argc < 2)
+	{
+		return runDemo();
+	}
+
+	// 하위 명령은 셸 스크립트에서 사용할 수 있도록 표준 종료 코드를 반환한다.
+	int result = FAIL;
+	if(strcmp(argv[1], "batch") == 0) result = runBatch(argc, argv);
+	else if(strcmp(argv[1], "profile") == 0) result = runProfile(argc, argv);
+	else if(strcmp(argv[1], "composite") == 0) result = runComposite(argc, argv);
+	else if(strcmp(argv[1], "pack") == 0) result = runPack(argc, argv);
+	else if(strcmp(argv[1], "partition") == 0) result = runPartition(argc, argv);
+	else if(strcmp(argv[1], "cached") == 0) result = runCached(argc, argv);
+	else if(strcmp(argv[1], "delta") == 0) result = runDelta(argc, argv);
+	else if(strcmp(argv[1], "stream") == 0) result = runStream(argc, argv);
+	else if(strcmp(argv[1], "sample") == 0) result = runSample(argc, argv);
+	else if(strcmp(argv[1], "courses") == 0) result = runCourses(argc, argv);
+	else if(strcmp(argv[1], "watch") == 0) result = runWatch(argc, argv);
+	else if(strcmp(argv[1], "whatif") == 0) result = runWhatif(argc, argv);
+	else if(strcmp(argv[1], "groupby") == 0) result = runGroupby(argc, argv);
+	else printUsage(argv[0]);
+
+	return (result == SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int runDemo(void)
+ * @brief 미리 정해둔 점수 배열에 대한 등급을 판단해서 출력하는 함수 (인자 없이 실행한 경우)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runDemo(void)
 {
 	int inputNumbers[MAX_INPUT_NUM] = { 100, 99, 50, 80, 22, 33, 79, 56, 44, 69, 0, -1, 101, 999 };
 
-	gradeManager_t *gradeManager = gradeManagerNew("./grade.ini");
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
 	if(gradeManager == NULL)
 	{
 		return FAIL;
@@ -30,3 +117,787 @@ int main()
 	return SUCCESS;
 }
 
+/**
+ * @fn static int runBatch(int argc, char **argv)
+ * @brief 디렉토리 또는 목록 파일에 있는 점수 파일들을 여러 스레드로 일괄 처리하는 함수
+ * 사용법 : batch (입력 디렉토리 또는 목록 파일) (출력 디렉토리) [스레드 개수]
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runBatch(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int threadNum = (argc > 4) ? atoi(argv[4]) : 0;
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	batchManager_t *batchManager = batchManagerNew(gradeManager, argv[2], argv[3], threadNum);
+	if(batchManager != NULL)
+	{
+		result = batchManagerRun(batchManager);
+		hugePrintSummary(stdout);
+		batchManagerDelete(&batchManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runProfile(int argc, char **argv)
+ * @brief ini 로딩, 점수 읽기, 등급 판단, 결과 출력 구간을 하드웨어 카운터로 측정하는 함수
+ * 사용법 : profile (점수 파일) [반복 횟수] [출력 파일] [auto|8|16|32]
+ * 점수 배열 원소 크기를 지정하지 않으면 auto (등급 전체 범위에 맞는 가장 작은 크기)를 사용한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runProfile(int argc, char **argv)
+{
+	if(argc < 3)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int repeatNum = (argc > 3) ? atoi(argv[3]) : 1;
+	const char *outputFileName = (argc > 4) ? argv[4] : "/dev/null";
+	if(repeatNum <= 0) repeatNum = 1;
+
+	int width = SCORE_WIDTH_AUTO;
+	if(argc > 5)
+	{
+		if(strcmp(argv[5], "8") == 0) width = SCORE_WIDTH_8;
+		else if(strcmp(argv[5], "16") == 0) width = SCORE_WIDTH_16;
+		else if(strcmp(argv[5], "32") == 0) width = SCORE_WIDTH_32;
+		else if(strcmp(argv[5], "auto") != 0)
+		{
+			printUsage(argv[0]);
+			return FAIL;
+		}
+	}
+
+	perfReport_t *report = perfReportNew();
+	if(report == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = runProfilePhases(report, argv[2], repeatNum, outputFileName, width);
+	if(result == SUCCESS)
+	{
+		perfReportPrint(report, stdout);
+		hugePrintSummary(stdout);
+	}
+
+	perfReportDelete(&report);
+	return result;
+}
+
+/**
+ * @fn static int runProfilePhases(perfReport_t *report, const char *scoreFileName, int repeatNum, const char *outputFileName, int width)
+ * @brief runProfile 의 측정 구간들을 순서대로 실행하는 함수
+ * @param report 측정 결과를 관리하는 구조체(입력 및 출력)
+ * @param scoreFileName 점수 파일 이름(입력, 읽기 전용)
+ * @param repeatNum 등급 판단 구간 반복 횟수(입력)
+ * @param outputFileName 결과를 출력할 파일 이름(입력, 읽기 전용)
+ * @param width 점수 배열 원소 크기(입력, SCORE_WIDTH)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runProfilePhases(perfReport_t *report, const char *scoreFileName, int repeatNum, const char *outputFileName, int width)
+{
+	scoreArray_t scores;
+	int repeatIndex = 0;
+	int result = FAIL;
+	recordBuffer_t output;
+
+	perfReportBegin(report, "ini");
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	perfReportEnd(report, 0);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	perfReportBegin(report, "load");
+	int loadResult = recordLoadScoreArray(gradeManager, scoreFileName, width, &scores);
+	perfReportEnd(report, (loadResult == SUCCESS) ? scores.num : 0);
+	if(loadResult == FAIL)
+	{
+		gradeManagerDelete(&gradeManager);
+		return FAIL;
+	}
+
+	int scoreNum = scores.num;
+	printf("[점수 배열] (width:%dbit, scores:%d, out of range:%d, bytes:%zu)\n", scores.width * 8, scoreNum, scores.exceptionNum, (size_t)scoreNum * (size_t)scores.width);
+
+	char *gradeList = (char*)hugeAlloc((size_t)scoreNum + 1);
+	if(gradeList == NULL || recordBufferInit(&output, (size_t)scoreNum * 8 + 1) == FAIL)
+	{
+		printf("[DEBUG] 결과 배열 동적 생성 실패. NULL.\n");
+		hugeFree(gradeList);
+		recordScoreArrayFinal(&scores);
+		gradeManagerDelete(&gradeManager);
+		return FAIL;
+	}
+
+	perfReportBegin(report, "classify");
+	for( ; repeatIndex < repeatNum; repeatIndex++)
+	{
+		recordScoreArrayClassify(gradeManager, &scores, 0, scoreNum, gradeList);
+	}
+	perfReportEnd(report, (long long)scoreNum * repeatNum);
+
+	perfReportBegin(report, "output");
+	FILE *filePtr = fopen(outputFileName, "w");
+	if(filePtr != NULL)
+	{
+		int scorePos = 0;
+		char lineBuffer[GRADE_SCORE_TEXT_LEN + 3];
+		result = SUCCESS;
+		for( ; scorePos < scoreNum && result == SUCCESS; scorePos++)
+		{
+			int score = recordScoreArrayGet(&scores, scorePos);
+			int lineLength = 1;
+			// 점수를 읽을 수 없던 줄은 점수 자리에 '?' 를 쓴다.
+			if(score == RECORD_INVALID_SCORE) lineBuffer[0] = '?';
+			else lineLength = gradeManagerFormatScore(gradeManager, score, lineBuffer, GRADE_SCORE_TEXT_LEN);
+			lineBuffer[lineLength++] = ' ';
+			lineBuffer[lineLength++] = gradeList[scorePos];
+			lineBuffer[lineLength++] = '\n';
+			result = recordBufferAppend(&output, lineBuffer, (size_t)lineLength);
+		}
+		if(result == SUCCESS && fwrite(output.data, 1, output.length, filePtr) != output.length) result = FAIL;
+		fclose(filePtr);
+	}
+	perfReportEnd(report, scoreNum);
+	if(filePtr == NULL || result == FAIL) printf("[ERROR] 결과 파일 쓰기 실패. (fileName:%s)\n", outputFileName);
+
+	recordBufferFinal(&output);
+	hugeFree(gradeList);
+	recordScoreArrayFinal(&scores);
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runComposite(int argc, char **argv)
+ * @brief 여러 평가 항목 점수를 가진 레코드 파일의 가중 합산 점수와 등급을 판단하는 함수
+ * 사용법 : composite (입력 파일) (출력 파일) [ini 파일]
+ * 가중치는 ini 파일의 [Weight] 필드에서 읽으며, ini 파일을 지정하지 않으면 GRADE_INI_FILE 을 사용한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runComposite(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	const char *iniFileName = (argc > 4) ? argv[4] : GRADE_INI_FILE;
+
+	gradeManager_t *gradeManager = gradeManagerNew(iniFileName);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	compositeManager_t *compositeManager = compositeManagerNew(gradeManager, iniFileName);
+	if(compositeManager != NULL)
+	{
+		gradeStats_t stats;
+		result = compositeManagerGradeFile(compositeManager, argv[2], argv[3], &stats);
+		if(result == SUCCESS) gradeStatsPrint(stdout, &stats);
+		compositeManagerDelete(&compositeManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runPack(int argc, char **argv)
+ * @brief 점수 파일의 등급을 판단해서 등급 사전과 3 비트 코드로 구성된 이진 결과 파일로 저장하는 함수
+ * 사용법 : pack (점수 파일) (결과 파일) [bitpack|rle|auto]
+ * 저장 방식을 지정하지 않으면 auto (정렬된 입력처럼 같은 등급이 이어지면 RLE) 를 사용한다. 결과 파일은 gradeDecode 로 읽는다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runPack(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int encoding = PACK_AUTO;
+	if(argc > 4)
+	{
+		if(strcmp(argv[4], "bitpack") == 0) encoding = PACK_BITPACK;
+		else if(strcmp(argv[4], "rle") == 0) encoding = PACK_RLE;
+		else if(strcmp(argv[4], "auto") != 0)
+		{
+			printUsage(argv[0]);
+			return FAIL;
+		}
+	}
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	scoreArray_t scores;
+	int result = recordLoadScoreArray(gradeManager, argv[2], SCORE_WIDTH_AUTO, &scores);
+	if(result == SUCCESS)
+	{
+		gradeStats_t stats;
+		result = packWriteFile(gradeManager, &scores, encoding, argv[3], &stats);
+		if(result == SUCCESS) gradeStatsPrint(stdout, &stats);
+		recordScoreArrayFinal(&scores);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runPartition(int argc, char **argv)
+ * @brief 메모리보다 큰 레코드 파일을 등급별 파일로 나누는 함수
+ * 사용법 : partition (입력 파일) (출력 디렉토리) [스레드 개수] [sort]
+ * sort 를 지정하면 등급 파일 안의 레코드를 점수 순으로 정렬한다. (정렬된 런 파일을 내보낸 뒤 병합)
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runPartition(int argc, char **argv)
+{
+	if(argc < 4 || (argc > 5 && strcmp(argv[5], "sort") != 0))
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int threadNum = (argc > 4) ? atoi(argv[4]) : 0;
+	int sorted = (argc > 5) ? TRUE : FALSE;
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	partitionManager_t *partitionManager = partitionManagerNew(gradeManager, argv[2], argv[3], threadNum, sorted);
+	if(partitionManager != NULL)
+	{
+		result = partitionManagerRun(partitionManager);
+		partitionManagerDelete(&partitionManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runCached(int argc, char **argv)
+ * @brief 입력 파일 내용과 등급 테이블이 같으면 이전 결과를 캐시에서 재사용해서 점수 파일의 등급을 판단하는 함수
+ * 사용법 : cached (점수 파일) (결과 파일) (캐시 디렉토리) [캐시 최대 크기(MB)]
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runCached(int argc, char **argv)
+{
+	if(argc < 5)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	long long maxSize = (argc > 5) ? atoll(argv[5]) * 1024 * 1024 : 0;
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	cacheManager_t *cacheManager = cacheManagerNew(gradeManager, argv[4], maxSize);
+	if(cacheManager != NULL)
+	{
+		gradeStats_t stats;
+		result = cacheManagerGradeFile(cacheManager, argv[2], argv[3], &stats);
+		if(result == SUCCESS) gradeStatsPrint(stdout, &stats);
+		cacheManagerDelete(&cacheManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runDelta(int argc, char **argv)
+ * @brief 이전 결과와 새 점수 파일을 학번으로 조인해서 바뀐 레코드만 다시 판단하고 변경 목록과 전체 결과를 출력하는 함수
+ * 사용법 : delta (이전 결과 파일) (새 점수 파일) (전체 결과 파일) (변경 목록 파일)
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runDelta(int argc, char **argv)
+{
+	if(argc < 6)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	deltaManager_t *deltaManager = deltaManagerNew(gradeManager, argv[2]);
+	if(deltaManager != NULL)
+	{
+		gradeStats_t stats;
+		result = deltaManagerRun(deltaManager, argv[3], argv[4], argv[5], &stats);
+		if(result == SUCCESS) gradeStatsPrint(stdout, &stats);
+		deltaManagerDelete(&deltaManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runStream(int argc, char **argv)
+ * @brief gzip, zstd 로 압축된 점수 파일을 디스크에 풀지 않고 압축 해제 스레드와 동시에 등급을 판단하는 함수
+ * 압축되지 않은 파일도 같은 방식으로 처리한다.
+ * 진행 상태를 (결과 파일).checkpoint 에 주기적으로 저장하고, 중단된 뒤 같은 입력과 등급 정보로 다시 실행하면 이어서 처리한다.
+ * 사용법 : stream (점수 파일) (결과 파일)
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runStream(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	char checkpointPath[PATH_MAX];
+	if(snprintf(checkpointPath, sizeof(checkpointPath), "%s%s", argv[3], CHECKPOINT_SUFFIX) >= (int)sizeof(checkpointPath))
+	{
+		printf("[ERROR] 체크포인트 파일 경로가 너무 김. (fileName:%s)\n", argv[3]);
+		gradeManagerDelete(&gradeManager);
+		return FAIL;
+	}
+
+	uint64_t configHash = checkpointHashFile(argv[2], checkpointHashConfig(gradeManager, argv[3]));
+	checkpoint_t *checkpoint = checkpointNew(checkpointPath, configHash, 0, argv[3]);
+	if(checkpoint == NULL)
+	{
+		gradeManagerDelete(&gradeManager);
+		return FAIL;
+	}
+
+	int result = FAIL;
+	inputManager_t *inputManager = inputManagerNew(argv[2], (long long)checkpoint->header.inputOffset);
+	if(inputManager != NULL)
+	{
+		gradeStats_t stats;
+		result = inputManagerGradeFile(inputManager, gradeManager, argv[3], checkpoint, &stats);
+		if(result == SUCCESS)
+		{
+			const inputReader_t *reader = inputManager->reader;
+			printf("[스트림] (format:%s, input:%lldB, decompressed:%lldB, starve:%lld, stall:%lld)\n", inputGetFormatName(reader->format),
+				reader->compressedByteNum, reader->byteNum, inputManager->starveNum, inputManager->stallNum);
+			gradeStatsPrint(stdout, &stats);
+			hugePrintSummary(stdout);
+		}
+		inputManagerDelete(&inputManager);
+	}
+
+	checkpointDelete(&checkpoint);
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runSample(int argc, char **argv)
+ * @brief 점수 파일의 임의 위치 표본으로 등급 분포를 근사하고, 오차 목표를 만족할 때까지 표본을 늘리는 함수
+ * 사용법 : sample (점수 파일) [오차 목표(%p, 기본 1)] [난수 시드]
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runSample(int argc, char **argv)
+{
+	if(argc < 3)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	double errorTarget = (argc > 3) ? atof(argv[3]) : SAMPLE_DEFAULT_ERROR;
+	uint64_t seed = (argc > 4) ? strtoull(argv[4], NULL, 10) : (uint64_t)time(NULL);
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	sampleManager_t *sampleManager = sampleManagerNew(gradeManager, argv[2], seed);
+	if(sampleManager != NULL)
+	{
+		printf("[근사 시작] (target:%.3f%%p, seed:%llu)\n", errorTarget, (unsigned long long)seed);
+
+		sampleEstimate_t estimate;
+		result = sampleManagerRun(sampleManager, errorTarget / 100.0, &estimate);
+		if(result == SUCCESS) sampleEstimatePrint(stdout, &estimate);
+		sampleManagerDelete(&sampleManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static int runCourses(int argc, char **argv)
+ * @brief 디렉토리의 과목별 ini 파일들을 병렬로 로딩하고, 지정한 과목들의 등급 범위를 찾아 출력하는 함수
+ * 사용법 : courses (ini 디렉토리) [스레드 개수] [과목 이름 ...]
+ * 로딩에 실패한 파일이 있거나 지정한 과목을 찾지 못하면 나머지를 모두 처리한 뒤 FAIL 을 반환한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runCourses(int argc, char **argv)
+{
+	if(argc < 3)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int threadNum = (argc > 3) ? atoi(argv[3]) : 0;
+
+	courseManager_t *courseManager = courseManagerNew(argv[2], threadNum);
+	if(courseManager == NULL)
+	{
+		return FAIL;
+	}
+
+	courseManagerPrintSummary(stdout, courseManager);
+	int result = (courseManager->errorNum == 0) ? SUCCESS : FAIL;
+
+	int argIndex = 4;
+	for( ; argIndex < argc; argIndex++)
+	{
+		const gradeManager_t *gradeManager = courseManagerFind(courseManager, argv[argIndex]);
+		if(gradeManager == NULL)
+		{
+			printf("[ERROR] 과목을 찾을 수 없음. (course:%s)\n", argv[argIndex]);
+			result = FAIL;
+			continue;
+		}
+		printCourse(argv[argIndex], gradeManager);
+	}
+
+	courseManagerDelete(&courseManager);
+	return result;
+}
+
+/**
+ * @fn static void printCourse(const char *courseName, const gradeManager_t *gradeManager)
+ * @brief 과목의 전체 범위와 등급별 범위를 한 줄로 출력하는 함수
+ * runCourses 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param courseName 과목 이름(입력, 읽기 전용)
+ * @param gradeManager 과목의 등급 정보(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void printCourse(const char *courseName, const gradeManager_t *gradeManager)
+{
+	const gradeInfo_t *infoList[4] = { &(gradeManager->gradeA), &(gradeManager->gradeB), &(gradeManager->gradeC), &(gradeManager->gradeD) };
+	char minText[GRADE_SCORE_TEXT_LEN];
+	char maxText[GRADE_SCORE_TEXT_LEN];
+
+	gradeManagerFormatScore(gradeManager, gradeManager->totalMin, minText, sizeof(minText));
+	gradeManagerFormatScore(gradeManager, gradeManager->totalMax, maxText, sizeof(maxText));
+	printf("%s : scale=%d Total=[%s,%s]", courseName, gradeManager->scale, minText, maxText);
+
+	int infoIndex = 0;
+	for( ; infoIndex < 4; infoIndex++)
+	{
+		gradeManagerFormatScore(gradeManager, infoList[infoIndex]->min, minText, sizeof(minText));
+		gradeManagerFormatScore(gradeManager, infoList[infoIndex]->max, maxText, sizeof(maxText));
+		printf(" %c=[%s,%s]", infoList[infoIndex]->grade, minText, maxText);
+	}
+	printf("\n");
+}
+
+/**
+ * @fn static int runWatch(int argc, char **argv)
+ * @brief 점수 파일이 들어오는 디렉토리를 감시하다가 다 쓰인 파일의 등급을 바로 판단하는 함수
+ * SIGINT, SIGTERM 을 받으면 대기 중인 파일까지 처리한 뒤 처리량과 지연 시간 요약을 출력하고 끝낸다.
+ * 사용법 : watch (감시 디렉토리) (출력 디렉토리) [처리할 파일 개수(0 이면 제한 없음)] [inotify|poll]
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runWatch(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	long long maxFileNum = (argc > 4) ? atoll(argv[4]) : 0;
+	int mode = WATCH_INOTIFY;
+	if(argc > 5)
+	{
+		if(strcmp(argv[5], "poll") == 0) mode = WATCH_POLL;
+		else if(strcmp(argv[5], "inotify") != 0)
+		{
+			printUsage(argv[0]);
+			return FAIL;
+		}
+	}
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	int result = FAIL;
+	watchManager_t *watchManager = watchManagerNew(gradeManager, argv[2], argv[3], mode);
+	if(watchManager != NULL)
+	{
+		// SA_RESTART 없이 등록해서 대기 중인 poll 이 바로 깨어나게 한다.
+		struct sigaction action;
+		memset(&action, 0, sizeof(action));
+		action.sa_handler = onWatchSignal;
+		sigemptyset(&(action.sa_mask));
+		watchTarget = watchManager;
+		sigaction(SIGINT, &action, NULL);
+		sigaction(SIGTERM, &action, NULL);
+
+		result = watchManagerRun(watchManager, maxFileNum);
+
+		signal(SIGINT, SIG_DFL);
+		signal(SIGTERM, SIG_DFL);
+		watchTarget = NULL;
+
+		watchManagerPrintSummary(stdout, watchManager);
+		watchManagerDelete(&watchManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static void onWatchSignal(int signalNumber)
+ * @brief 감시 중에 받은 SIGINT, SIGTERM 처리기, 감시 객체에 종료만 요청한다.
+ * @param signalNumber 받은 시그널 번호(입력)
+ * @return 반환값 없음
+ */
+static void onWatchSignal(int signalNumber)
+{
+	(void)signalNumber;
+	watchManagerRequestStop(watchTarget);
+}
+
+/**
+ * @fn static int runWhatif(int argc, char **argv)
+ * @brief 디렉토리의 후보 ini 파일들로 등급을 판단했을 때의 등급 분포를 점수 파일을 한 번만 읽어 계산하는 함수
+ * 사용법 : whatif (점수 파일) (후보 ini 디렉토리) [스레드 개수]
+ * 후보는 courses 와 같이 병렬로 로딩하고, 점수 히스토그램의 누적 합으로 후보마다 O(등급 개수) 에 분포를 구한다.
+ * 첫 번째 후보와 배율이 다른 후보나 로딩에 실패한 파일이 있으면 나머지를 모두 처리한 뒤 FAIL 을 반환한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runWhatif(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int threadNum = (argc > 4) ? atoi(argv[4]) : 0;
+
+	courseManager_t *courseManager = courseManagerNew(argv[3], threadNum);
+	if(courseManager == NULL)
+	{
+		return FAIL;
+	}
+
+	courseManagerPrintSummary(stdout, courseManager);
+	int result = (courseManager->errorNum == 0 && courseManager->courseNum > 0) ? SUCCESS : FAIL;
+
+	const course_t **candidateList = (const course_t**)calloc((size_t)courseManager->courseNum + 1, sizeof(const course_t*));
+	const gradeManager_t **gradeManagerList = (const gradeManager_t**)calloc((size_t)courseManager->courseNum + 1, sizeof(const gradeManager_t*));
+	if(candidateList == NULL || gradeManagerList == NULL)
+	{
+		printf("[DEBUG] 후보 목록 동적 생성 실패. NULL.\n");
+		free(candidateList);
+		free(gradeManagerList);
+		courseManagerDelete(&courseManager);
+		return FAIL;
+	}
+
+	int candidateNum = 0;
+	int courseIndex = 0;
+	for( ; courseIndex < courseManager->courseNum; courseIndex++)
+	{
+		const course_t *course = &(courseManager->courseList[courseIndex]);
+		if(candidateNum > 0 && course->gradeManager->scale != gradeManagerList[0]->scale)
+		{
+			printf("[ERROR] 첫 번째 후보와 배율이 달라 제외함. (candidate:%s, scale:%d, expected scale:%d)\n", course->name, course->gradeManager->scale, gradeManagerList[0]->scale);
+			result = FAIL;
+			continue;
+		}
+		candidateList[candidateNum] = course;
+		gradeManagerList[candidateNum++] = course->gradeManager;
+	}
+
+	whatifManager_t *whatifManager = (candidateNum > 0) ? whatifManagerNew(gradeManagerList, candidateNum) : NULL;
+	if(whatifManager == NULL || whatifManagerLoadFile(whatifManager, argv[2]) == FAIL)
+	{
+		result = FAIL;
+	}
+	else
+	{
+		struct timespec startTime, endTime;
+		clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+		gradeStats_t *statsList = (gradeStats_t*)calloc((size_t)candidateNum, sizeof(gradeStats_t));
+		int candidateIndex = 0;
+		for( ; statsList != NULL && candidateIndex < candidateNum; candidateIndex++)
+		{
+			if(whatifManagerEvaluate(whatifManager, gradeManagerList[candidateIndex], &(statsList[candidateIndex])) == FAIL) result = FAIL;
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &endTime);
+		double evaluateSec = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+		whatifManagerPrintSummary(stdout, whatifManager);
+		if(statsList == NULL)
+		{
+			printf("[DEBUG] 후보 통계 배열 동적 생성 실패. NULL.\n");
+			result = FAIL;
+		}
+		else
+		{
+			printf("[후보 평가] (candidates:%d, elapsed:%.6fs)\n", candidateNum, evaluateSec);
+			whatifPrintHeader(stdout);
+			for(candidateIndex = 0; candidateIndex < candidateNum; candidateIndex++)
+			{
+				whatifPrintRow(stdout, gradeManagerList[candidateIndex], candidateList[candidateIndex]->name, &(statsList[candidateIndex]));
+			}
+		}
+		free(statsList);
+	}
+
+	if(whatifManager != NULL) whatifManagerDelete(&whatifManager);
+	free(candidateList);
+	free(gradeManagerList);
+	courseManagerDelete(&courseManager);
+	return result;
+}
+
+/**
+ * @fn static int runGroupby(int argc, char **argv)
+ * @brief (그룹 필드 ...) (점수) 레코드 파일을 한 번 읽어 그룹별 등급 분포와 상위 단계 합계를 결과 파일로 출력하는 함수
+ * 사용법 : groupby (점수 파일) (결과 파일) [스레드 개수] [키 필드 개수]
+ * 작업 스레드마다 자기 해시 테이블에 집계한 뒤 병합하므로 입력 파일은 압축되지 않은 파일이어야 한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int runGroupby(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printUsage(argv[0]);
+		return FAIL;
+	}
+
+	int threadNum = (argc > 4) ? atoi(argv[4]) : 0;
+	int keyFieldNum = (argc > 5) ? atoi(argv[5]) : 0;
+
+	gradeManager_t *gradeManager = gradeManagerNew(GRADE_INI_FILE);
+	if(gradeManager == NULL)
+	{
+		return FAIL;
+	}
+
+	groupManager_t *groupManager = groupManagerNew(gradeManager, argv[2], keyFieldNum, threadNum);
+	int result = (groupManager != NULL) ? groupManagerRun(groupManager) : FAIL;
+	if(result == SUCCESS) result = groupManagerWriteFile(groupManager, argv[3]);
+	if(result == SUCCESS) groupManagerPrintSummary(stdout, groupManager);
+
+	if(groupManager != NULL) groupManagerDelete(&groupManager);
+	gradeManagerDelete(&gradeManager);
+	return result;
+}
+
+/**
+ * @fn static void printUsage(const char *programName)
+ * @brief 실행 방법을 출력하는 함수
+ * @param programName 실행 파일 이름(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void printUsage(const char *programName)
+{
+	printf("Usage:\n");
+	printf("  %s                                   : 예제 점수 등급 판단\n", programName);
+	printf("  %s batch <dir|manifest> <outDir> [threads] : 점수 파일 일괄 처리\n", programName);
+	printf("  %s profile <scoreFile> [repeat] [outFile] [auto|8|16|32] : 하드웨어 카운터로 구간별 성능 측정\n", programName);
+	printf("  %s composite <input> <output> [ini] : [Weight] 가중 합산 점수 등급 판단\n", programName);
+	printf("  %s pack <scoreFile> <outFile> [bitpack|rle|auto] : 등급을 3 비트 코드 이진 파일로 저장 (gradeDecode 로 복원)\n", programName);
+	printf("  %s partition <input> <outDir> [threads] [sort] : 큰 레코드 파일을 등급별 파일로 분할\n", programName);
+	printf("  %s cached <scoreFile> <outFile> <cacheDir> [maxMB] : 같은 입력과 등급 테이블의 결과를 캐시에서 재사용\n", programName);
+	printf("  %s delta <prevOutput> <newScores> <outFile> <changeFile> : 바뀐 레코드만 다시 판단\n", programName);
+	printf("  %s stream <scoreFile> <outFile> : gzip/zstd 압축 파일을 풀면서 등급 판단\n", programName);
+	printf("  %s sample <scoreFile> [error%%p] [seed] : 표본으로 등급 분포와 신뢰 구간 근사\n", programName);
+	printf("  %s courses <iniDir> [threads] [course ...] : 과목별 ini 파일을 병렬로 로딩하고 과목 등급 범위 조회\n", programName);
+	printf("  %s watch <dropDir> <outDir> [maxFiles] [inotify|poll] : 디렉토리에 들어오는 점수 파일을 감시하면서 바로 등급 판단\n", programName);
+	printf("  %s whatif <scoreFile> <iniDir> [threads] : 후보 ini 파일들의 등급 분포를 점수 히스토그램 한 번으로 계산\n", programName);
+	printf("  %s groupby <scoreFile> <outFile> [threads] [keyFields] : 그룹 필드별 등급 분포와 상위 단계 합계를 한 번에 집계\n", programName);
+}
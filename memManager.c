@@ -0,0 +1,310 @@
+#include "gradeManager.h"
+#include "memManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Global Variables
+//////////////////////////////////////////////////////////////////////////
+
+// 하위 시스템별 집계
+static memStats_t memSubsystemStats[MEM_SUBSYSTEM_NUM];
+// 한 번 이상 할당한 호출 위치 목록 (CAS 로 앞에 추가)
+static memSite_t *memSiteList = NULL;
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for memSite_t
+//////////////////////////////////////////////////////////////////////////
+
+static void* memSiteTrack(memSite_t *site, memHeader_t *header, size_t size);
+static void memSiteUntrack(const memHeader_t *header);
+static void memSiteRegister(memSite_t *site);
+static void memStatsAdd(memStats_t *stats, long long bytes);
+static void memStatsRemove(memStats_t *stats, long long bytes);
+static void memStatsLoad(const memStats_t *stats, memStats_t *result);
+static void memStatsPrint(FILE *filePtr, const memStats_t *stats);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for memSite_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void* memAlloc(memSite_t *site, size_t size)
+ * @brief 헤더를 붙여 메모리를 할당하고 호출 위치와 하위 시스템의 집계에 더하는 함수
+ * MEM_MALLOC 매크로에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param site 호출 위치 집계 구조체(입력 및 출력)
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 사용자 영역의 주소, 실패 시 NULL 반환
+ */
+void* memAlloc(memSite_t *site, size_t size)
+{
+	if(size > SIZE_MAX - sizeof(memHeader_t)) return NULL;
+
+	memHeader_t *header = (memHeader_t*)malloc(sizeof(memHeader_t) + size);
+	if(header == NULL) return NULL;
+
+	return memSiteTrack(site, header, size);
+}
+
+/**
+ * @fn void* memCalloc(memSite_t *site, size_t num, size_t size)
+ * @brief 헤더를 붙여 0 으로 초기화된 메모리를 할당하고 집계에 더하는 함수
+ * MEM_CALLOC 매크로에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param site 호출 위치 집계 구조체(입력 및 출력)
+ * @param num 원소 개수(입력)
+ * @param size 원소 크기(입력)
+ * @return 성공 시 사용자 영역의 주소, 실패 시 NULL 반환
+ */
+void* memCalloc(memSite_t *site, size_t num, size_t size)
+{
+	if(size != 0 && num > (SIZE_MAX - sizeof(memHeader_t)) / size) return NULL;
+
+	memHeader_t *header = (memHeader_t*)calloc(1, sizeof(memHeader_t) + num * size);
+	if(header == NULL) return NULL;
+
+	return memSiteTrack(site, header, num * size);
+}
+
+/**
+ * @fn void* memRealloc(memSite_t *site, void *ptr, size_t size)
+ * @brief 추적 중인 블록의 크기를 바꾸는 함수
+ * 이전 블록은 처음 할당한 위치에서 해제한 것으로, 새 블록은 이 위치에서 할당한 것으로 집계한다.
+ * 실패하면 realloc 과 같이 이전 블록은 그대로 남는다.
+ * MEM_REALLOC 매크로에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param site 호출 위치 집계 구조체(입력 및 출력)
+ * @param ptr 크기를 바꿀 사용자 영역의 주소(입력, NULL 이면 새로 할당)
+ * @param size 새 크기(입력)
+ * @return 성공 시 사용자 영역의 주소, 실패 시 NULL 반환
+ */
+void* memRealloc(memSite_t *site, void *ptr, size_t size)
+{
+	if(ptr == NULL) return memAlloc(site, size);
+	if(size > SIZE_MAX - sizeof(memHeader_t)) return NULL;
+
+	memHeader_t *header = (memHeader_t*)ptr - 1;
+	memHeader_t oldHeader = *header;
+	memHeader_t *newHeader = (memHeader_t*)realloc(header, sizeof(memHeader_t) + size);
+	if(newHeader == NULL) return NULL;
+
+	memSiteUntrack(&oldHeader);
+	return memSiteTrack(site, newHeader, size);
+}
+
+/**
+ * @fn void memFree(void *ptr)
+ * @brief 추적 중인 블록을 해제하고 할당한 위치와 하위 시스템의 집계에서 빼는 함수
+ * @param ptr 해제할 사용자 영역의 주소(입력, NULL 이면 아무 것도 하지 않음)
+ * @return 반환값 없음
+ */
+void memFree(void *ptr)
+{
+	if(ptr == NULL) return;
+
+	memHeader_t *header = (memHeader_t*)ptr - 1;
+	memSiteUntrack(header);
+	free(header);
+}
+
+/**
+ * @fn void memGetStats(int subsystem, memStats_t *stats)
+ * @brief 하위 시스템의 현재 집계를 복사하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param subsystem 하위 시스템(입력, MEM_SUBSYSTEM)
+ * @param stats 집계를 저장할 구조체(출력)
+ * @return 반환값 없음
+ */
+void memGetStats(int subsystem, memStats_t *stats)
+{
+	if(stats == NULL || subsystem < 0 || subsystem >= MEM_SUBSYSTEM_NUM)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (subsystem:%d, stats:%p)\n", subsystem, (void*)stats);
+		return;
+	}
+
+	memStatsLoad(&(memSubsystemStats[subsystem]), stats);
+}
+
+/**
+ * @fn const char* memGetSubsystemName(int subsystem)
+ * @brief 하위 시스템의 이름을 반환하는 함수
+ * @param subsystem 하위 시스템(입력, MEM_SUBSYSTEM)
+ * @return 하위 시스템 이름 문자열 반환
+ */
+const char* memGetSubsystemName(int subsystem)
+{
+	switch(subsystem)
+	{
+		case MEM_SUBSYSTEM_INI: return "ini";
+		case MEM_SUBSYSTEM_GRADE: return "grade";
+		default: return "unknown";
+	}
+}
+
+/**
+ * @fn int memReportIsEnabled(void)
+ * @brief 프로세스가 종료할 때 할당 보고서를 출력할지 확인하는 함수 (gradeManagerNew 가 처음 호출될 때 확인)
+ * MEM_REPORT_ENV 환경 변수가 설정되어 있고 추적하도록 빌드한 경우에만 출력한다.
+ * @return 출력해야 하면 TRUE, 아니면 FALSE 반환
+ */
+int memReportIsEnabled(void)
+{
+	return (MEM_TRACK && getenv(MEM_REPORT_ENV) != NULL) ? TRUE : FALSE;
+}
+
+/**
+ * @fn void memReportPrint(FILE *filePtr)
+ * @brief 하위 시스템별, 호출 위치별 할당 집계를 출력하는 함수
+ * 출력 시점에 사용 중인 바이트가 남아있는 항목은 해제하지 않은 블록이 있다는 뜻이다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터에 대한 NULL 체크를 수행한다.
+ * @param filePtr 출력할 파일(입력)
+ * @return 반환값 없음
+ */
+void memReportPrint(FILE *filePtr)
+{
+	if(filePtr == NULL)
+	{
+		printf("[DEBUG] filePtr 가 NULL.\n");
+		return;
+	}
+
+	memStats_t stats;
+	int subsystem = 0;
+
+	fprintf(filePtr, "[메모리] 하위 시스템별 할당\n");
+	for( ; subsystem < MEM_SUBSYSTEM_NUM; subsystem++)
+	{
+		memStatsLoad(&(memSubsystemStats[subsystem]), &stats);
+		fprintf(filePtr, "\t%-5s : ", memGetSubsystemName(subsystem));
+		memStatsPrint(filePtr, &stats);
+	}
+
+	fprintf(filePtr, "[메모리] 호출 위치별 할당\n");
+	const memSite_t *site = __atomic_load_n(&memSiteList, __ATOMIC_ACQUIRE);
+	for( ; site != NULL; site = site->next)
+	{
+		memStatsLoad(&(site->stats), &stats);
+		fprintf(filePtr, "\t%s:%d (%s) : ", site->file, site->line, memGetSubsystemName(site->subsystem));
+		memStatsPrint(filePtr, &stats);
+	}
+	fflush(filePtr);
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for memSite_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void* memSiteTrack(memSite_t *site, memHeader_t *header, size_t size)
+ * @brief 할당한 블록의 헤더를 채우고 호출 위치와 하위 시스템의 집계에 더하는 함수
+ * memAlloc, memCalloc, memRealloc 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param site 호출 위치 집계 구조체(입력 및 출력)
+ * @param header 할당한 블록의 헤더(출력)
+ * @param size 사용자가 요청한 크기(입력)
+ * @return 사용자 영역의 주소 반환
+ */
+static void* memSiteTrack(memSite_t *site, memHeader_t *header, size_t size)
+{
+	if(__atomic_load_n(&(site->registered), __ATOMIC_ACQUIRE) == FALSE) memSiteRegister(site);
+
+	header->info.site = site;
+	header->info.size = size;
+	memStatsAdd(&(site->stats), (long long)size);
+	memStatsAdd(&(memSubsystemStats[site->subsystem]), (long long)size);
+
+	return header + 1;
+}
+
+/**
+ * @fn static void memSiteUntrack(const memHeader_t *header)
+ * @brief 해제하는 블록을 할당한 위치와 하위 시스템의 집계에서 빼는 함수
+ * memFree, memRealloc 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param header 해제하는 블록의 헤더(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void memSiteUntrack(const memHeader_t *header)
+{
+	memSite_t *site = header->info.site;
+	memStatsRemove(&(site->stats), (long long)header->info.size);
+	memStatsRemove(&(memSubsystemStats[site->subsystem]), (long long)header->info.size);
+}
+
+/**
+ * @fn static void memSiteRegister(memSite_t *site)
+ * @brief 처음 할당한 호출 위치를 전체 목록에 등록하는 함수
+ * 여러 스레드가 동시에 처음 할당하더라도 한 스레드만 등록한다.
+ * memSiteTrack 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param site 등록할 호출 위치 집계 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void memSiteRegister(memSite_t *site)
+{
+	if(__atomic_exchange_n(&(site->registered), TRUE, __ATOMIC_ACQ_REL) == TRUE) return;
+
+	memSite_t *head = __atomic_load_n(&memSiteList, __ATOMIC_RELAXED);
+	do
+	{
+		site->next = head;
+	} while(__atomic_compare_exchange_n(&memSiteList, &head, site, TRUE, __ATOMIC_RELEASE, __ATOMIC_RELAXED) == FALSE);
+}
+
+/**
+ * @fn static void memStatsAdd(memStats_t *stats, long long bytes)
+ * @brief 할당 하나를 집계에 더하고 최대 사용량을 갱신하는 함수
+ * memSiteTrack 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param stats 집계 구조체(입력 및 출력)
+ * @param bytes 할당한 바이트 수(입력)
+ * @return 반환값 없음
+ */
+static void memStatsAdd(memStats_t *stats, long long bytes)
+{
+	__atomic_fetch_add(&(stats->allocNum), 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&(stats->totalBytes), bytes, __ATOMIC_RELAXED);
+	long long liveBytes = __atomic_add_fetch(&(stats->liveBytes), bytes, __ATOMIC_RELAXED);
+
+	long long peakBytes = __atomic_load_n(&(stats->peakBytes), __ATOMIC_RELAXED);
+	while(liveBytes > peakBytes)
+	{
+		if(__atomic_compare_exchange_n(&(stats->peakBytes), &peakBytes, liveBytes, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == TRUE) break;
+	}
+}
+
+/**
+ * @fn static void memStatsRemove(memStats_t *stats, long long bytes)
+ * @brief 해제 하나를 집계에 반영하는 함수
+ * memSiteUntrack 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param stats 집계 구조체(입력 및 출력)
+ * @param bytes 해제한 바이트 수(입력)
+ * @return 반환값 없음
+ */
+static void memStatsRemove(memStats_t *stats, long long bytes)
+{
+	__atomic_fetch_add(&(stats->freeNum), 1, __ATOMIC_RELAXED);
+	__atomic_fetch_sub(&(stats->liveBytes), bytes, __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn static void memStatsLoad(const memStats_t *stats, memStats_t *result)
+ * @brief 여러 스레드가 갱신 중인 집계를 원자적으로 읽어 복사하는 함수
+ * @param stats 읽을 집계 구조체(입력, 읽기 전용)
+ * @param result 복사할 구조체(출력)
+ * @return 반환값 없음
+ */
+static void memStatsLoad(const memStats_t *stats, memStats_t *result)
+{
+	result->allocNum = __atomic_load_n(&(stats->allocNum), __ATOMIC_RELAXED);
+	result->freeNum = __atomic_load_n(&(stats->freeNum), __ATOMIC_RELAXED);
+	result->totalBytes = __atomic_load_n(&(stats->totalBytes), __ATOMIC_RELAXED);
+	result->liveBytes = __atomic_load_n(&(stats->liveBytes), __ATOMIC_RELAXED);
+	result->peakBytes = __atomic_load_n(&(stats->peakBytes), __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn static void memStatsPrint(FILE *filePtr, const memStats_t *stats)
+ * @brief 집계 한 줄을 출력하는 함수
+ * @param filePtr 출력할 파일(입력)
+ * @param stats 출력할 집계(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void memStatsPrint(FILE *filePtr, const memStats_t *stats)
+{
+	fprintf(filePtr, "live=%lldB peak=%lldB alloc=%lld free=%lld total=%lldB%s\n", stats->liveBytes, stats->peakBytes,
+		stats->allocNum, stats->freeNum, stats->totalBytes, (stats->liveBytes != 0) ? " (해제되지 않음)" : "");
+}
@@ -0,0 +1,130 @@
+#ifndef __MEM_MANAGER_H__
+#define __MEM_MANAGER_H__
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 할당 추적 여부 (make MEM_TRACK=0 으로 빌드하면 매크로가 malloc/free 를 그대로 호출한다)
+#ifndef MEM_TRACK
+#define MEM_TRACK	1
+#endif
+
+// 이 환경 변수가 설정되어 있으면 프로세스가 종료할 때 할당 보고서를 한 번 출력한다.
+#define MEM_REPORT_ENV	"GRADE_MEM_REPORT"
+
+// 할당을 집계하는 하위 시스템 열거형
+enum MEM_SUBSYSTEM
+{
+	MEM_SUBSYSTEM_INI = 0,	// iniManager
+	MEM_SUBSYSTEM_GRADE,	// gradeManager
+	MEM_SUBSYSTEM_NUM
+};
+
+#if MEM_TRACK
+// 호출 위치마다 정적 memSite_t 를 두어 위치별 개수를 센다. (LOG_WRITE 와 같은 방식, 식으로 쓰기 위해 gcc 문장 식 사용)
+#define MEM_SITE_INIT(memSubsystem)	{ .file = __FILE__, .line = __LINE__, .subsystem = (memSubsystem) }
+#define MEM_MALLOC(memSubsystem, size) \
+	({ \
+		static memSite_t memSite__ = MEM_SITE_INIT(memSubsystem); \
+		memAlloc(&memSite__, (size)); \
+	})
+#define MEM_CALLOC(memSubsystem, num, size) \
+	({ \
+		static memSite_t memSite__ = MEM_SITE_INIT(memSubsystem); \
+		memCalloc(&memSite__, (num), (size)); \
+	})
+#define MEM_REALLOC(memSubsystem, ptr, size) \
+	({ \
+		static memSite_t memSite__ = MEM_SITE_INIT(memSubsystem); \
+		memRealloc(&memSite__, (ptr), (size)); \
+	})
+#define MEM_FREE(ptr)	memFree(ptr)
+#else
+#define MEM_MALLOC(memSubsystem, size)		((void)(memSubsystem), malloc(size))
+#define MEM_CALLOC(memSubsystem, num, size)	((void)(memSubsystem), calloc((num), (size)))
+#define MEM_REALLOC(memSubsystem, ptr, size)	((void)(memSubsystem), realloc((ptr), (size)))
+#define MEM_FREE(ptr)	free(ptr)
+#endif
+
+/**
+ * @struct memStats_t
+ * @brief 할당 개수와 바이트 수를 집계하는 구조체
+ * 여러 스레드가 원자적으로 갱신한다.
+ */
+typedef struct memStats_s memStats_t;
+struct memStats_s
+{
+	// 할당 횟수
+	long long allocNum;
+	// 해제 횟수
+	long long freeNum;
+	// 할당한 전체 바이트 수
+	long long totalBytes;
+	// 현재 사용 중인 바이트 수
+	long long liveBytes;
+	// 사용 중인 바이트 수의 최대값
+	long long peakBytes;
+};
+
+/**
+ * @struct memSite_t
+ * @brief 할당 호출 위치 하나의 집계 구조체
+ * 매크로가 호출 위치마다 정적 변수로 만들고, 처음 할당할 때 전체 목록에 등록한다.
+ * 해제는 할당한 위치로 집계한다.
+ */
+typedef struct memSite_s memSite_t;
+struct memSite_s
+{
+	// 소스 파일 이름
+	const char *file;
+	// 소스 줄 번호
+	int line;
+	// 하위 시스템 (MEM_SUBSYSTEM)
+	int subsystem;
+	// 전체 목록 등록 여부 (TRUE 또는 FALSE)
+	int registered;
+	// 다음 호출 위치 (전체 목록)
+	memSite_t *next;
+	// 위치별 집계
+	memStats_t stats;
+};
+
+/**
+ * @struct memHeader_t
+ * @brief 추적하는 할당 블록 앞에 붙는 헤더 구조체
+ * 사용자 영역의 정렬을 malloc 과 같게 유지하기 위해 max_align_t 크기로 맞춘다.
+ */
+typedef union memHeader_u memHeader_t;
+union memHeader_u
+{
+	struct
+	{
+		// 할당한 호출 위치
+		memSite_t *site;
+		// 사용자가 요청한 크기
+		size_t size;
+	} info;
+	// 정렬용
+	max_align_t align;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for memSite_t
+//////////////////////////////////////////////////////////////////////////
+
+void* memAlloc(memSite_t *site, size_t size);
+void* memCalloc(memSite_t *site, size_t num, size_t size);
+void* memRealloc(memSite_t *site, void *ptr, size_t size);
+void memFree(void *ptr);
+void memGetStats(int subsystem, memStats_t *stats);
+const char* memGetSubsystemName(int subsystem);
+int memReportIsEnabled(void);
+void memReportPrint(FILE *filePtr);
+
+#endif // #ifndef __MEM_MANAGER_H__
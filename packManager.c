@@ -0,0 +1,527 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "packManager.h"
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 등급 판단을 나눠서 수행할 점수 개수
+#define PACK_CLASSIFY_BLOCK_SIZE	4096
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static unsigned char* packClassifyScores(const gradeManager_t *gradeManager, const scoreArray_t *scores, gradeStats_t *stats);
+static uint64_t packCountRuns(const unsigned char *codeList, int codeNum);
+static void packEncodeBitpack(const unsigned char *codeList, int codeNum, uint64_t *wordList);
+static void packEncodeRle(const unsigned char *codeList, int codeNum, uint32_t *runList);
+static int packReaderValidate(const packReader_t *reader);
+static void packReaderGetDict(const packReader_t *reader, char *dictList);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for Pack File
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int packWriteFile(const gradeManager_t *gradeManager, const scoreArray_t *scores, int encoding, const char *fileName, gradeStats_t *stats)
+ * @brief 점수 배열의 등급을 판단해서 등급 사전, 3 비트 코드 payload, 분포 통계 꼬리로 구성된 이진 파일로 저장하는 함수
+ * 텍스트로 한 줄씩 출력하는 것보다 점수당 약 3 비트(정렬된 입력을 RLE 로 저장하면 그보다 훨씬 적게)만 사용한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param scores 등급을 판단할 점수 배열(입력, 읽기 전용, 원소 크기에 맞는 판단 함수를 사용)
+ * @param encoding 등급 코드 저장 방식(입력, PACK_BITPACK, PACK_RLE, PACK_AUTO 중 하나)
+ * @param fileName 저장할 파일 이름(입력, 읽기 전용)
+ * @param stats 등급 통계(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int packWriteFile(const gradeManager_t *gradeManager, const scoreArray_t *scores, int encoding, const char *fileName, gradeStats_t *stats)
+{
+	if(gradeManager == NULL || scores == NULL || (scores->data == NULL && scores->num > 0) || fileName == NULL || stats == NULL || scores->num < 0)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, scores:%p, fileName:%p, stats:%p)\n", (const void*)gradeManager, (const void*)scores, (const void*)fileName, (void*)stats);
+		return FAIL;
+	}
+
+	int scoreNum = scores->num;
+
+	if(encoding != PACK_BITPACK && encoding != PACK_RLE && encoding != PACK_AUTO)
+	{
+		printf("[ERROR] 알 수 없는 저장 방식. (encoding:%d)\n", encoding);
+		return FAIL;
+	}
+
+	unsigned char *codeList = packClassifyScores(gradeManager, scores, stats);
+	if(codeList == NULL)
+	{
+		return FAIL;
+	}
+
+	// 두 방식의 payload 크기를 비교해서 저장 방식을 정한다. (payload 는 8 바이트 단위로 맞춘다.)
+	uint64_t bitpackSize = ((uint64_t)scoreNum + PACK_CODE_PER_WORD - 1) / PACK_CODE_PER_WORD * sizeof(uint64_t);
+	uint64_t runNum = packCountRuns(codeList, scoreNum);
+	uint64_t rleSize = (runNum * sizeof(uint32_t) + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+	if(encoding == PACK_AUTO) encoding = (rleSize < bitpackSize) ? PACK_RLE : PACK_BITPACK;
+
+	packHeader_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, PACK_MAGIC, sizeof(header.magic));
+	header.version = PACK_VERSION;
+	header.encoding = (uint32_t)encoding;
+	header.bitWidth = PACK_BIT_WIDTH;
+	header.recordNum = (uint64_t)scoreNum;
+	header.payloadSize = (encoding == PACK_RLE) ? rleSize : bitpackSize;
+	header.dictNum = GRADE_KIND_NUM;
+
+	packFooter_t footer;
+	memset(&footer, 0, sizeof(footer));
+	memcpy(footer.magic, PACK_FOOTER_MAGIC, sizeof(footer.magic));
+	footer.scoreSum = stats->sum;
+	footer.scoreMin = stats->min;
+	footer.scoreMax = stats->max;
+	footer.scale = gradeManager->scale;
+
+	int code = 0;
+	for( ; code < GRADE_KIND_NUM; code++)
+	{
+		header.dictList[code] = gradeManagerGetGradeFromIndex(code);
+		footer.countList[code] = (uint64_t)stats->count[code];
+	}
+
+	// 8 바이트 단위로 할당해서 RLE payload 끝의 패딩(길이 0 런)도 0 으로 채운다.
+	char *payload = (char*)calloc((size_t)header.payloadSize / sizeof(uint64_t) + 1, sizeof(uint64_t));
+	if(payload == NULL)
+	{
+		printf("[DEBUG] payload 동적 생성 실패. NULL. (size:%llu)\n", (unsigned long long)header.payloadSize);
+		hugeFree(codeList);
+		return FAIL;
+	}
+
+	if(encoding == PACK_RLE) packEncodeRle(codeList, scoreNum, (uint32_t*)payload);
+	else packEncodeBitpack(codeList, scoreNum, (uint64_t*)payload);
+	hugeFree(codeList);
+
+	int result = FAIL;
+	int fd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(fd == -1)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+	}
+	else
+	{
+		result = recordBufferWriteAll(fd, (const char*)&header, sizeof(header));
+		if(result == SUCCESS) result = recordBufferWriteAll(fd, payload, (size_t)header.payloadSize);
+		if(result == SUCCESS) result = recordBufferWriteAll(fd, (const char*)&footer, sizeof(footer));
+		if(close(fd) == -1) result = FAIL;
+		if(result == FAIL) printf("[ERROR] 결과 파일 쓰기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+	}
+
+	free(payload);
+	return result;
+}
+
+/**
+ * @fn const char* packGetEncodingName(uint32_t encoding)
+ * @brief 등급 코드 저장 방식의 이름을 반환하는 함수
+ * @param encoding 등급 코드 저장 방식(입력)
+ * @return 항상 저장 방식 이름 문자열 반환 (알 수 없는 방식은 "unknown")
+ */
+const char* packGetEncodingName(uint32_t encoding)
+{
+	switch(encoding)
+	{
+		case PACK_BITPACK: return "bitpack";
+		case PACK_RLE: return "rle";
+		case PACK_AUTO: return "auto";
+		default: return "unknown";
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for packReader_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn packReader_t* packReaderNew(const char *fileName)
+ * @brief 등급 결과 파일을 mmap 으로 열고 헤더와 꼬리를 검증하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 파일 이름에 대한 NULL 체크를 수행한다.
+ * @param fileName 읽을 등급 결과 파일 이름(입력, 읽기 전용, 객체가 삭제될 때까지 유지되어야 함)
+ * @return 성공 시 새로 생성된 packReader_t 구조체 객체, 실패 시 NULL 반환
+ */
+packReader_t* packReaderNew(const char *fileName)
+{
+	if(fileName == NULL)
+	{
+		printf("[DEBUG] 파일 이름이 NULL.\n");
+		return NULL;
+	}
+
+	int fd = open(fileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 결과 파일 열기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		return NULL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1 || (size_t)fileStat.st_size < sizeof(packHeader_t) + sizeof(packFooter_t))
+	{
+		printf("[ERROR] 등급 결과 파일이 아님. 크기가 너무 작음. (fileName:%s)\n", fileName);
+		close(fd);
+		return NULL;
+	}
+
+	packReader_t *reader = (packReader_t*)malloc(sizeof(packReader_t));
+	if(reader == NULL)
+	{
+		printf("[DEBUG] packReader 객체 동적 생성 실패. NULL.\n");
+		close(fd);
+		return NULL;
+	}
+
+	reader->fileName = fileName;
+	reader->size = (size_t)fileStat.st_size;
+	void *mapped = mmap(NULL, reader->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(mapped == MAP_FAILED)
+	{
+		printf("[ERROR] 결과 파일 매핑 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		free(reader);
+		return NULL;
+	}
+	madvise(mapped, reader->size, MADV_SEQUENTIAL);
+
+	reader->data = (char*)mapped;
+	reader->header = (const packHeader_t*)reader->data;
+	reader->payload = reader->data + sizeof(packHeader_t);
+	reader->footer = (const packFooter_t*)(reader->data + reader->size - sizeof(packFooter_t));
+
+	if(packReaderValidate(reader) == FAIL)
+	{
+		packReaderDelete(&reader);
+		return NULL;
+	}
+
+	return reader;
+}
+
+/**
+ * @fn void packReaderDelete(packReader_t **reader)
+ * @brief 생성된 packReader_t 구조체 객체의 매핑과 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param reader 삭제할 packReader_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void packReaderDelete(packReader_t **reader)
+{
+	if(reader == NULL || *reader == NULL)
+	{
+		printf("[DEBUG] packReader 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	munmap((*reader)->data, (*reader)->size);
+	free(*reader);
+	*reader = NULL;
+}
+
+/**
+ * @fn void packCursorInit(packCursor_t *cursor)
+ * @brief 복원 위치를 파일의 처음으로 초기화하는 함수
+ * @param cursor 초기화할 packCursor_t 구조체(출력)
+ * @return 반환값 없음
+ */
+void packCursorInit(packCursor_t *cursor)
+{
+	if(cursor == NULL) return;
+
+	cursor->recordIndex = 0;
+	cursor->runIndex = 0;
+	cursor->runRemain = 0;
+}
+
+/**
+ * @fn int packReaderDecode(const packReader_t *reader, packCursor_t *cursor, char *gradeList, int maxNum)
+ * @brief 현재 복원 위치부터 최대 maxNum 개의 등급 코드를 등급 문자로 복원하는 함수
+ * bitpack 은 워드 하나를 읽어 코드 21 개를 꺼내고, RLE 는 런 하나를 memset 으로 채운다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param reader 등급 결과 파일을 가진 구조체(입력, 읽기 전용)
+ * @param cursor 복원 위치(입력 및 출력)
+ * @param gradeList 복원한 등급 문자를 저장할 배열(출력, maxNum 개 이상)
+ * @param maxNum 한 번에 복원할 최대 개수(입력)
+ * @return 성공 시 복원한 개수(파일 끝이면 0), 실패 시 FAIL 반환
+ */
+int packReaderDecode(const packReader_t *reader, packCursor_t *cursor, char *gradeList, int maxNum)
+{
+	if(reader == NULL || cursor == NULL || gradeList == NULL || maxNum < 0)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (reader:%p, cursor:%p, gradeList:%p, maxNum:%d)\n", (const void*)reader, (void*)cursor, (void*)gradeList, maxNum);
+		return FAIL;
+	}
+
+	char dictList[PACK_MAX_DICT_NUM];
+	packReaderGetDict(reader, dictList);
+
+	uint64_t recordNum = reader->header->recordNum;
+	uint64_t index = cursor->recordIndex;
+	uint64_t end = (recordNum - index < (uint64_t)maxNum) ? recordNum : index + (uint64_t)maxNum;
+	int num = 0;
+
+	if(reader->header->encoding == PACK_BITPACK)
+	{
+		const uint64_t *wordList = (const uint64_t*)reader->payload;
+		while(index < end)
+		{
+			uint64_t offset = index % PACK_CODE_PER_WORD;
+			uint64_t word = wordList[index / PACK_CODE_PER_WORD] >> (offset * PACK_BIT_WIDTH);
+			uint64_t count = PACK_CODE_PER_WORD - offset;
+			if(count > end - index) count = end - index;
+
+			uint64_t codePos = 0;
+			for( ; codePos < count; codePos++)
+			{
+				gradeList[num++] = dictList[word & PACK_CODE_MASK];
+				word >>= PACK_BIT_WIDTH;
+			}
+			index += count;
+		}
+	}
+	else
+	{
+		const uint32_t *runList = (const uint32_t*)reader->payload;
+		while(index < end)
+		{
+			if(cursor->runRemain == 0)
+			{
+				cursor->runRemain = runList[cursor->runIndex++] >> PACK_BIT_WIDTH;
+				continue;
+			}
+
+			uint32_t count = cursor->runRemain;
+			if(count > end - index) count = (uint32_t)(end - index);
+			memset(gradeList + num, dictList[runList[cursor->runIndex - 1] & PACK_CODE_MASK], count);
+			cursor->runRemain -= count;
+			num += (int)count;
+			index += count;
+		}
+	}
+
+	cursor->recordIndex = index;
+	return num;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static unsigned char* packClassifyScores(const gradeManager_t *gradeManager, const scoreArray_t *scores, gradeStats_t *stats)
+ * @brief 점수 배열을 블록 단위로 등급 판단해서 등급 코드(통계 배열 인덱스) 배열을 만드는 함수
+ * packWriteFile 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param scores 등급을 판단할 점수 배열(입력, 읽기 전용)
+ * @param stats 등급 통계(출력)
+ * @return 성공 시 새로 생성된 등급 코드 배열(호출한 쪽에서 hugeFree), 실패 시 NULL 반환
+ */
+static unsigned char* packClassifyScores(const gradeManager_t *gradeManager, const scoreArray_t *scores, gradeStats_t *stats)
+{
+	int scoreNum = scores->num;
+	unsigned char *codeList = (unsigned char*)hugeAlloc((size_t)scoreNum + 1);
+	if(codeList == NULL)
+	{
+		printf("[DEBUG] 등급 코드 배열 동적 생성 실패. NULL. (scoreNum:%d)\n", scoreNum);
+		return NULL;
+	}
+
+	// 등급 문자 -> 등급 코드 변환 테이블
+	unsigned char codeTable[UCHAR_MAX + 1];
+	int character = 0;
+	for( ; character <= UCHAR_MAX; character++)
+	{
+		codeTable[character] = (unsigned char)gradeManagerGetGradeIndex((char)character);
+	}
+
+	char gradeList[PACK_CLASSIFY_BLOCK_SIZE];
+	int blockPos = 0;
+	gradeStatsInit(stats);
+	for( ; blockPos < scoreNum; blockPos += PACK_CLASSIFY_BLOCK_SIZE)
+	{
+		int blockNum = (scoreNum - blockPos < PACK_CLASSIFY_BLOCK_SIZE) ? scoreNum - blockPos : PACK_CLASSIFY_BLOCK_SIZE;
+		recordScoreArrayClassify(gradeManager, scores, blockPos, blockNum, gradeList);
+
+		int scorePos = 0;
+		for( ; scorePos < blockNum; scorePos++)
+		{
+			codeList[blockPos + scorePos] = codeTable[(unsigned char)gradeList[scorePos]];
+			gradeStatsAdd(stats, recordScoreArrayGet(scores, blockPos + scorePos), gradeList[scorePos]);
+		}
+	}
+
+	return codeList;
+}
+
+/**
+ * @fn static uint64_t packCountRuns(const unsigned char *codeList, int codeNum)
+ * @brief 등급 코드 배열을 RLE 로 저장할 때 필요한 런 개수를 세는 함수
+ * @param codeList 등급 코드 배열(입력, 읽기 전용)
+ * @param codeNum 등급 코드 개수(입력)
+ * @return 항상 런 개수 반환
+ */
+static uint64_t packCountRuns(const unsigned char *codeList, int codeNum)
+{
+	uint64_t runNum = 0;
+	uint32_t runLength = 0;
+	int codePos = 0;
+
+	for( ; codePos < codeNum; codePos++)
+	{
+		if(runLength == 0 || codeList[codePos] != codeList[codePos - 1] || runLength == PACK_MAX_RUN_LENGTH)
+		{
+			runNum++;
+			runLength = 0;
+		}
+		runLength++;
+	}
+
+	return runNum;
+}
+
+/**
+ * @fn static void packEncodeBitpack(const unsigned char *codeList, int codeNum, uint64_t *wordList)
+ * @brief 등급 코드를 64 비트 워드마다 PACK_CODE_PER_WORD 개씩 낮은 비트부터 채워 넣는 함수
+ * @param codeList 등급 코드 배열(입력, 읽기 전용)
+ * @param codeNum 등급 코드 개수(입력)
+ * @param wordList 코드를 저장할 워드 배열(출력, 0 으로 초기화되어 있어야 함)
+ * @return 반환값 없음
+ */
+static void packEncodeBitpack(const unsigned char *codeList, int codeNum, uint64_t *wordList)
+{
+	int codePos = 0;
+	int wordPos = 0;
+
+	for( ; codePos < codeNum; codePos += PACK_CODE_PER_WORD, wordPos++)
+	{
+		int count = (codeNum - codePos < PACK_CODE_PER_WORD) ? codeNum - codePos : PACK_CODE_PER_WORD;
+		uint64_t word = 0;
+		int shift = count - 1;
+		for( ; shift >= 0; shift--)
+		{
+			word = (word << PACK_BIT_WIDTH) | (uint64_t)(codeList[codePos + shift] & PACK_CODE_MASK);
+		}
+		wordList[wordPos] = word;
+	}
+}
+
+/**
+ * @fn static void packEncodeRle(const unsigned char *codeList, int codeNum, uint32_t *runList)
+ * @brief 등급 코드 배열을 (길이 << PACK_BIT_WIDTH | 코드) 형식의 런 목록으로 저장하는 함수
+ * @param codeList 등급 코드 배열(입력, 읽기 전용)
+ * @param codeNum 등급 코드 개수(입력)
+ * @param runList 런을 저장할 배열(출력, packCountRuns 개 이상)
+ * @return 반환값 없음
+ */
+static void packEncodeRle(const unsigned char *codeList, int codeNum, uint32_t *runList)
+{
+	uint32_t runLength = 0;
+	int runPos = -1;
+	int codePos = 0;
+
+	for( ; codePos < codeNum; codePos++)
+	{
+		if(runLength == 0 || codeList[codePos] != codeList[codePos - 1] || runLength == PACK_MAX_RUN_LENGTH)
+		{
+			if(runPos >= 0) runList[runPos] = (runLength << PACK_BIT_WIDTH) | codeList[codePos - 1];
+			runPos++;
+			runLength = 0;
+		}
+		runLength++;
+	}
+
+	if(runPos >= 0) runList[runPos] = (runLength << PACK_BIT_WIDTH) | codeList[codeNum - 1];
+}
+
+/**
+ * @fn static int packReaderValidate(const packReader_t *reader)
+ * @brief 매핑된 파일의 헤더, 꼬리, payload 크기가 형식에 맞는지 검사하는 함수
+ * RLE 는 런 길이의 합이 레코드 개수와 같은지도 검사하므로, 이후 복원할 때는 범위 검사를 하지 않는다.
+ * packReaderNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param reader 검사할 packReader_t 구조체(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int packReaderValidate(const packReader_t *reader)
+{
+	const packHeader_t *header = reader->header;
+	const packFooter_t *footer = reader->footer;
+	uint64_t bodySize = reader->size - sizeof(packHeader_t) - sizeof(packFooter_t);
+
+	if(memcmp(header->magic, PACK_MAGIC, sizeof(header->magic)) != 0 || memcmp(footer->magic, PACK_FOOTER_MAGIC, sizeof(footer->magic)) != 0)
+	{
+		printf("[ERROR] 등급 결과 파일이 아님. 식별 문자열 불일치. (fileName:%s)\n", reader->fileName);
+		return FAIL;
+	}
+
+	if(header->version != PACK_VERSION || header->bitWidth != PACK_BIT_WIDTH || header->dictNum == 0 || header->dictNum > PACK_MAX_DICT_NUM
+		|| (header->encoding != PACK_BITPACK && header->encoding != PACK_RLE))
+	{
+		printf("[ERROR] 지원하지 않는 등급 결과 파일 형식. (fileName:%s, version:%u, bitWidth:%u, dictNum:%u, encoding:%u)\n", reader->fileName, header->version, header->bitWidth, header->dictNum, header->encoding);
+		return FAIL;
+	}
+
+	if(header->payloadSize != bodySize || header->payloadSize % sizeof(uint64_t) != 0)
+	{
+		printf("[ERROR] payload 크기 불일치. (fileName:%s, payloadSize:%llu, fileBody:%llu)\n", reader->fileName, (unsigned long long)header->payloadSize, (unsigned long long)bodySize);
+		return FAIL;
+	}
+
+	if(header->encoding == PACK_BITPACK)
+	{
+		uint64_t wordNum = (header->recordNum + PACK_CODE_PER_WORD - 1) / PACK_CODE_PER_WORD;
+		if(wordNum * sizeof(uint64_t) != header->payloadSize)
+		{
+			printf("[ERROR] bitpack payload 크기가 레코드 개수와 맞지 않음. (fileName:%s, records:%llu)\n", reader->fileName, (unsigned long long)header->recordNum);
+			return FAIL;
+		}
+	}
+	else
+	{
+		const uint32_t *runList = (const uint32_t*)reader->payload;
+		uint64_t runNum = header->payloadSize / sizeof(uint32_t);
+		uint64_t runPos = 0;
+		uint64_t total = 0;
+		for( ; runPos < runNum; runPos++)
+		{
+			total += runList[runPos] >> PACK_BIT_WIDTH;
+		}
+
+		if(total != header->recordNum)
+		{
+			printf("[ERROR] RLE 런 길이의 합이 레코드 개수와 맞지 않음. (fileName:%s, records:%llu, runTotal:%llu)\n", reader->fileName, (unsigned long long)header->recordNum, (unsigned long long)total);
+			return FAIL;
+		}
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void packReaderGetDict(const packReader_t *reader, char *dictList)
+ * @brief 파일의 등급 사전을 코드 비트로 표현할 수 있는 모든 값에 대한 조회 배열로 만드는 함수
+ * 사전에 없는 코드는 '?' 로 복원한다.
+ * @param reader 등급 결과 파일을 가진 구조체(입력, 읽기 전용)
+ * @param dictList 코드별 등급 문자 배열(출력, PACK_MAX_DICT_NUM 개)
+ * @return 반환값 없음
+ */
+static void packReaderGetDict(const packReader_t *reader, char *dictList)
+{
+	uint32_t code = 0;
+	for( ; code < PACK_MAX_DICT_NUM; code++)
+	{
+		dictList[code] = (code < reader->header->dictNum) ? reader->header->dictList[code] : '?';
+	}
+}
@@ -0,0 +1,139 @@
+#ifndef __PACK_MANAGER_H__
+#define __PACK_MANAGER_H__
+
+#include <stdint.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 등급 결과 파일 헤더 식별 문자열
+#define PACK_MAGIC	"GRPK"
+// 등급 결과 파일 꼬리(footer) 식별 문자열
+#define PACK_FOOTER_MAGIC	"GRPF"
+// 등급 결과 파일 형식 버전
+#define PACK_VERSION	1
+// 등급 코드 하나의 비트 수 (GRADE_KIND_NUM 개 등급을 표현)
+#define PACK_BIT_WIDTH	3
+// 64 비트 워드 하나에 담는 등급 코드 개수 (워드 경계를 넘는 코드는 없다)
+#define PACK_CODE_PER_WORD	(64 / PACK_BIT_WIDTH)
+// 등급 코드 마스크
+#define PACK_CODE_MASK	((1U << PACK_BIT_WIDTH) - 1)
+// 사전(dictionary)에 담을 수 있는 최대 등급 이름 개수
+#define PACK_MAX_DICT_NUM	(1 << PACK_BIT_WIDTH)
+// RLE 런 하나가 표현할 수 있는 최대 길이 (32 비트 중 코드 비트를 뺀 나머지)
+#define PACK_MAX_RUN_LENGTH	((1U << (32 - PACK_BIT_WIDTH)) - 1)
+
+// 등급 코드 저장 방식 열거형
+enum PACK_ENCODING
+{
+	PACK_BITPACK = 0,	// 64 비트 워드마다 21 개 코드를 3 비트씩 저장
+	PACK_RLE,			// (길이 << 3 | 코드) 32 비트 런 목록, 정렬된 입력에 유리
+	PACK_AUTO			// 두 방식 중 작은 쪽을 선택 (쓰기 전용)
+};
+
+/**
+ * @struct packHeader_t
+ * @brief 등급 결과 파일 앞에 놓이는 고정 크기 헤더 구조체
+ * <파일 구성>
+ * (packHeader_t) (payload, payloadSize 바이트, 8 바이트 정렬) (packFooter_t)
+ * 모든 정수는 기록한 시스템의 바이트 순서를 따르며, 필드는 패딩 없이 자연 정렬된다.
+ */
+typedef struct packHeader_s packHeader_t;
+struct packHeader_s
+{
+	// 식별 문자열 (PACK_MAGIC)
+	char magic[4];
+	// 형식 버전 (PACK_VERSION)
+	uint32_t version;
+	// 등급 코드 저장 방식 (PACK_BITPACK 또는 PACK_RLE)
+	uint32_t encoding;
+	// 등급 코드 하나의 비트 수 (PACK_BIT_WIDTH)
+	uint32_t bitWidth;
+	// 레코드(점수) 개수
+	uint64_t recordNum;
+	// payload 크기 (바이트)
+	uint64_t payloadSize;
+	// 사전에 있는 등급 이름 개수
+	uint32_t dictNum;
+	// 등급 코드별 등급 이름 사전 (코드 -> 등급 문자)
+	char dictList[12];
+};
+
+/**
+ * @struct packFooter_t
+ * @brief 등급 결과 파일 끝에 놓이는 등급 분포 통계 구조체
+ * 파일 끝에서 고정 크기만큼 읽으면 되므로 payload 를 읽지 않고 분포를 알 수 있다.
+ */
+typedef struct packFooter_s packFooter_t;
+struct packFooter_s
+{
+	// 등급 코드별 레코드 개수
+	uint64_t countList[PACK_MAX_DICT_NUM];
+	// 범위 안 점수의 합
+	int64_t scoreSum;
+	// 범위 안 점수의 최소값
+	int32_t scoreMin;
+	// 범위 안 점수의 최대값
+	int32_t scoreMax;
+	// 점수의 고정 소수점 배율
+	int32_t scale;
+	// 식별 문자열 (PACK_FOOTER_MAGIC)
+	char magic[4];
+};
+
+/**
+ * @struct packReader_t
+ * @brief mmap 으로 연 등급 결과 파일을 읽는 구조체
+ */
+typedef struct packReader_s packReader_t;
+struct packReader_s
+{
+	// 파일 이름
+	const char *fileName;
+	// 매핑된 파일 데이터
+	char *data;
+	// 파일 크기
+	size_t size;
+	// 파일 헤더 (매핑된 영역을 가리킴)
+	const packHeader_t *header;
+	// 파일 꼬리 (매핑된 영역을 가리킴)
+	const packFooter_t *footer;
+	// payload 시작 위치 (매핑된 영역을 가리킴)
+	const char *payload;
+};
+
+/**
+ * @struct packCursor_t
+ * @brief 등급 결과 파일을 앞에서부터 순서대로 복원할 때 현재 위치를 저장하는 구조체
+ */
+typedef struct packCursor_s packCursor_t;
+struct packCursor_s
+{
+	// 다음에 복원할 레코드 번호
+	uint64_t recordIndex;
+	// 다음에 읽을 RLE 런 번호
+	uint64_t runIndex;
+	// 현재 RLE 런에서 남은 길이
+	uint32_t runRemain;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for Pack File
+//////////////////////////////////////////////////////////////////////////
+
+int packWriteFile(const gradeManager_t *gradeManager, const scoreArray_t *scores, int encoding, const char *fileName, gradeStats_t *stats);
+const char* packGetEncodingName(uint32_t encoding);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for packReader_t
+//////////////////////////////////////////////////////////////////////////
+
+packReader_t* packReaderNew(const char *fileName);
+void packReaderDelete(packReader_t **reader);
+void packCursorInit(packCursor_t *cursor);
+int packReaderDecode(const packReader_t *reader, packCursor_t *cursor, char *gradeList, int maxNum);
+
+#endif // #ifndef __PACK_MANAGER_H__
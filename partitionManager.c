@@ -0,0 +1,1009 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "partitionManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for chunkQueue_t
+//////////////////////////////////////////////////////////////////////////
+
+static int chunkQueueInit(chunkQueue_t *queue, int capacity);
+static void chunkQueueFinal(chunkQueue_t *queue);
+static void chunkQueuePush(chunkQueue_t *queue, partitionChunk_t *chunk);
+static partitionChunk_t* chunkQueuePop(chunkQueue_t *queue);
+static void chunkQueueClose(chunkQueue_t *queue);
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for partitionManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static int partitionManagerOpenOutputs(partitionManager_t *partitionManager);
+static int partitionManagerGetRunPath(const partitionManager_t *partitionManager, int gradeIndex, int runId, char *path, size_t size);
+static int partitionManagerReadInput(partitionManager_t *partitionManager);
+static int partitionChunkReserve(partitionChunk_t *chunk, size_t capacity);
+static void* partitionManagerWorkerThread(void *data);
+static void partitionWorkerProcessChunk(partitionWorker_t *worker, const partitionChunk_t *chunk);
+static int partitionWorkerFlush(partitionWorker_t *worker, int gradeIndex);
+static int partitionWorkerSpillRun(partitionWorker_t *worker, int gradeIndex);
+static int partitionEntryCompare(const void *left, const void *right);
+static int partitionManagerMergeGrade(partitionManager_t *partitionManager, int gradeIndex);
+static int partitionManagerMergeRuns(partitionManager_t *partitionManager, int gradeIndex, int firstRunId, int runNum, int outputFd, long long *byteNum);
+static int partitionRunNext(const gradeManager_t *gradeManager, partitionRun_t *run);
+static int partitionRunLess(const partitionRun_t *left, const partitionRun_t *right);
+static void partitionHeapSiftDown(partitionRun_t **heap, int heapNum, int index);
+static void partitionManagerSetFailed(partitionManager_t *partitionManager);
+static int partitionManagerIsFailed(partitionManager_t *partitionManager);
+
+/**
+ * @struct partitionEntry_t
+ * @brief 런 파일로 내보낼 레코드 하나의 정렬 기준과 버퍼 안 위치를 저장하는 구조체
+ */
+typedef struct partitionEntry_s partitionEntry_t;
+struct partitionEntry_s
+{
+	// 레코드 점수 (읽을 수 없으면 INT_MIN)
+	int score;
+	// 레코드 길이 (개행 문자 포함)
+	unsigned int length;
+	// 등급 버퍼 안에서의 레코드 시작 위치
+	size_t offset;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for partitionManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn partitionManager_t* partitionManagerNew(const gradeManager_t *gradeManager, const char *inputPath, const char *outputDir, int threadNum, int sorted)
+ * @brief 레코드 파일을 등급별 파일로 나누는 partitionManager_t 객체를 생성하고 등급별 출력 파일을 여는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param inputPath 입력 레코드 파일 경로(입력, 읽기 전용)
+ * @param outputDir 등급별 파일을 저장할 디렉토리 경로(입력, 읽기 전용, 없으면 생성)
+ * @param threadNum 작업 스레드 개수(입력, 0 이하면 온라인 CPU 개수 사용)
+ * @param sorted 등급 파일 안을 점수 순으로 정렬할지 여부(입력, TRUE 또는 FALSE)
+ * @return 성공 시 새로 생성된 partitionManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+partitionManager_t* partitionManagerNew(const gradeManager_t *gradeManager, const char *inputPath, const char *outputDir, int threadNum, int sorted)
+{
+	if(gradeManager == NULL || inputPath == NULL || outputDir == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, inputPath:%p, outputDir:%p)\n", (const void*)gradeManager, (const void*)inputPath, (const void*)outputDir);
+		return NULL;
+	}
+
+	partitionManager_t *partitionManager = (partitionManager_t*)calloc(1, sizeof(partitionManager_t));
+	if(partitionManager == NULL)
+	{
+		printf("[DEBUG] partitionManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	if(threadNum <= 0) threadNum = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(threadNum <= 0) threadNum = 1;
+	if(threadNum > PARTITION_MAX_THREAD_NUM) threadNum = PARTITION_MAX_THREAD_NUM;
+
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		partitionManager->gradeList[gradeIndex].fd = -1;
+		pthread_mutex_init(&(partitionManager->gradeList[gradeIndex].mutex), NULL);
+	}
+
+	partitionManager->gradeManager = gradeManager;
+	partitionManager->threadNum = threadNum;
+	partitionManager->sorted = (sorted == TRUE) ? TRUE : FALSE;
+	partitionManager->bufferSize = (sorted == TRUE) ? PARTITION_RUN_SIZE : PARTITION_BUFFER_SIZE;
+	partitionManager->failed = FALSE;
+	gradeStatsInit(&(partitionManager->stats));
+	snprintf(partitionManager->inputPath, sizeof(partitionManager->inputPath), "%s", inputPath);
+	snprintf(partitionManager->outputDir, sizeof(partitionManager->outputDir), "%s", outputDir);
+
+	// 읽기 스레드가 하나를 채우는 동안 작업 스레드마다 하나씩 처리하고, 하나는 다음 구간의 앞부분을 받는다.
+	partitionManager->chunkNum = threadNum + 2;
+	partitionManager->chunkList = (partitionChunk_t*)calloc((size_t)partitionManager->chunkNum, sizeof(partitionChunk_t));
+	if(partitionManager->chunkList == NULL
+		|| chunkQueueInit(&(partitionManager->freeQueue), partitionManager->chunkNum) == FAIL
+		|| chunkQueueInit(&(partitionManager->fullQueue), partitionManager->chunkNum) == FAIL)
+	{
+		printf("[DEBUG] 구간 버퍼 목록 동적 생성 실패. NULL.\n");
+		partitionManagerDelete(&partitionManager);
+		return NULL;
+	}
+
+	int chunkIndex = 0;
+	for( ; chunkIndex < partitionManager->chunkNum; chunkIndex++)
+	{
+		partitionChunk_t *chunk = &(partitionManager->chunkList[chunkIndex]);
+		if(partitionChunkReserve(chunk, PARTITION_CHUNK_SIZE) == FAIL)
+		{
+			partitionManagerDelete(&partitionManager);
+			return NULL;
+		}
+		chunkQueuePush(&(partitionManager->freeQueue), chunk);
+	}
+
+	if(mkdir(outputDir, 0755) == -1 && errno != EEXIST)
+	{
+		printf("[ERROR] 출력 디렉토리 생성 실패. (outputDir:%s, errno:%d)\n", outputDir, errno);
+		partitionManagerDelete(&partitionManager);
+		return NULL;
+	}
+
+	if(partitionManagerOpenOutputs(partitionManager) == FAIL)
+	{
+		partitionManagerDelete(&partitionManager);
+		return NULL;
+	}
+
+	return partitionManager;
+}
+
+/**
+ * @fn void partitionManagerDelete(partitionManager_t **partitionManager)
+ * @brief 생성된 partitionManager_t 구조체 객체의 출력 파일과 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param partitionManager 삭제할 partitionManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void partitionManagerDelete(partitionManager_t **partitionManager)
+{
+	if(partitionManager == NULL || *partitionManager == NULL)
+	{
+		printf("[DEBUG] partitionManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	partitionManager_t *manager = *partitionManager;
+	int index = 0;
+	for( ; index < GRADE_KIND_NUM; index++)
+	{
+		if(manager->gradeList[index].fd != -1) close(manager->gradeList[index].fd);
+		pthread_mutex_destroy(&(manager->gradeList[index].mutex));
+	}
+
+	if(manager->chunkList != NULL)
+	{
+		for(index = 0; index < manager->chunkNum; index++)
+		{
+			hugeFree(manager->chunkList[index].data);
+		}
+		free(manager->chunkList);
+	}
+	chunkQueueFinal(&(manager->freeQueue));
+	chunkQueueFinal(&(manager->fullQueue));
+
+	free(manager);
+	*partitionManager = NULL;
+}
+
+/**
+ * @fn int partitionManagerRun(partitionManager_t *partitionManager)
+ * @brief 입력 파일을 구간 단위로 읽어 작업 스레드들에게 나눠주고, 등급별 파일 기록(정렬 모드는 런 병합)까지 수행하는 함수
+ * 정렬하지 않는 모드에서는 등급 파일 안의 레코드 순서가 입력 순서와 다를 수 있다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param partitionManager 작업을 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int partitionManagerRun(partitionManager_t *partitionManager)
+{
+	if(partitionManager == NULL)
+	{
+		printf("[DEBUG] partitionManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	pthread_t threadList[PARTITION_MAX_THREAD_NUM];
+	partitionWorker_t *workerList = (partitionWorker_t*)calloc((size_t)partitionManager->threadNum, sizeof(partitionWorker_t));
+	if(workerList == NULL)
+	{
+		printf("[DEBUG] 작업 스레드 정보 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	size_t memoryBound = (size_t)partitionManager->chunkNum * PARTITION_CHUNK_SIZE
+		+ (size_t)partitionManager->threadNum * GRADE_KIND_NUM * partitionManager->bufferSize * ((partitionManager->sorted == TRUE) ? 2 : 1);
+	printf("[분할 시작] (input:%s, threads:%d, sorted:%s, memory:~%zuMB)\n", partitionManager->inputPath, partitionManager->threadNum,
+		(partitionManager->sorted == TRUE) ? "yes" : "no", memoryBound >> 20);
+
+	struct timespec startTime, endTime;
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	int threadIndex = 0;
+	int createdNum = 0;
+	for( ; threadIndex < partitionManager->threadNum; threadIndex++)
+	{
+		workerList[threadIndex].partitionManager = partitionManager;
+		if(pthread_create(&(threadList[threadIndex]), NULL, partitionManagerWorkerThread, &(workerList[threadIndex])) != 0)
+		{
+			printf("[ERROR] 작업 스레드 생성 실패. (threadIndex:%d)\n", threadIndex);
+			break;
+		}
+		createdNum++;
+	}
+
+	int result = FAIL;
+	if(createdNum > 0)
+	{
+		result = partitionManagerReadInput(partitionManager);
+	}
+	chunkQueueClose(&(partitionManager->fullQueue));
+
+	for(threadIndex = 0; threadIndex < createdNum; threadIndex++)
+	{
+		pthread_join(threadList[threadIndex], NULL);
+		gradeStatsMerge(&(partitionManager->stats), &(workerList[threadIndex].stats));
+	}
+	free(workerList);
+
+	if(partitionManagerIsFailed(partitionManager) == TRUE) result = FAIL;
+
+	int gradeIndex = 0;
+	if(partitionManager->sorted == TRUE)
+	{
+		for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+		{
+			if(result == SUCCESS) result = partitionManagerMergeGrade(partitionManager, gradeIndex);
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	double elapsedSec = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+	printf("[등급별 결과]");
+	for(gradeIndex = 0; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		const partitionGrade_t *grade = &(partitionManager->gradeList[gradeIndex]);
+		printf(" %c=%lldB", gradeManagerGetGradeFromIndex(gradeIndex), grade->byteNum);
+		if(partitionManager->sorted == TRUE) printf("(runs:%d)", grade->runNum);
+	}
+	printf("\n[전체 결과] ");
+	gradeStatsPrint(stdout, &(partitionManager->stats));
+	printf("[분할 종료] (elapsed:%.3fs, input:%lldB, %.1fMB/s)\n\n", elapsedSec, partitionManager->inputByteNum,
+		(elapsedSec > 0) ? (double)partitionManager->inputByteNum / elapsedSec / (1024.0 * 1024.0) : 0.0);
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for chunkQueue_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int chunkQueueInit(chunkQueue_t *queue, int capacity)
+ * @brief 구간 버퍼 큐를 초기화하는 함수
+ * partitionManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param queue 초기화할 chunkQueue_t 구조체(출력)
+ * @param capacity 큐에 넣을 수 있는 최대 버퍼 개수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int chunkQueueInit(chunkQueue_t *queue, int capacity)
+{
+	queue->slotList = (partitionChunk_t**)malloc(sizeof(partitionChunk_t*) * (size_t)capacity);
+	if(queue->slotList == NULL)
+	{
+		return FAIL;
+	}
+
+	pthread_mutex_init(&(queue->mutex), NULL);
+	pthread_cond_init(&(queue->notEmpty), NULL);
+	queue->capacity = capacity;
+	queue->head = 0;
+	queue->count = 0;
+	queue->closed = FALSE;
+	return SUCCESS;
+}
+
+/**
+ * @fn static void chunkQueueFinal(chunkQueue_t *queue)
+ * @brief 구간 버퍼 큐의 메모리와 동기화 객체를 해제하는 함수 (초기화되지 않은 큐는 무시)
+ * @param queue 해제할 chunkQueue_t 구조체(입력)
+ * @return 반환값 없음
+ */
+static void chunkQueueFinal(chunkQueue_t *queue)
+{
+	if(queue->slotList == NULL) return;
+
+	pthread_mutex_destroy(&(queue->mutex));
+	pthread_cond_destroy(&(queue->notEmpty));
+	free(queue->slotList);
+	queue->slotList = NULL;
+}
+
+/**
+ * @fn static void chunkQueuePush(chunkQueue_t *queue, partitionChunk_t *chunk)
+ * @brief 큐 끝에 구간 버퍼를 넣는 함수
+ * 전체 버퍼 개수가 큐 크기와 같으므로 큐가 가득 차서 기다리는 경우는 없다.
+ * @param queue 버퍼를 넣을 chunkQueue_t 구조체(입력 및 출력)
+ * @param chunk 넣을 구간 버퍼(입력)
+ * @return 반환값 없음
+ */
+static void chunkQueuePush(chunkQueue_t *queue, partitionChunk_t *chunk)
+{
+	pthread_mutex_lock(&(queue->mutex));
+	queue->slotList[(queue->head + queue->count) % queue->capacity] = chunk;
+	queue->count++;
+	pthread_cond_signal(&(queue->notEmpty));
+	pthread_mutex_unlock(&(queue->mutex));
+}
+
+/**
+ * @fn static partitionChunk_t* chunkQueuePop(chunkQueue_t *queue)
+ * @brief 큐 앞에서 구간 버퍼를 꺼내는 함수 (비어있으면 버퍼가 들어오거나 큐가 닫힐 때까지 기다린다)
+ * @param queue 버퍼를 꺼낼 chunkQueue_t 구조체(입력 및 출력)
+ * @return 성공 시 꺼낸 구간 버퍼, 큐가 닫히고 비어있으면 NULL 반환
+ */
+static partitionChunk_t* chunkQueuePop(chunkQueue_t *queue)
+{
+	partitionChunk_t *chunk = NULL;
+
+	pthread_mutex_lock(&(queue->mutex));
+	while(queue->count == 0 && queue->closed == FALSE)
+	{
+		pthread_cond_wait(&(queue->notEmpty), &(queue->mutex));
+	}
+
+	if(queue->count > 0)
+	{
+		chunk = queue->slotList[queue->head];
+		queue->head = (queue->head + 1) % queue->capacity;
+		queue->count--;
+	}
+	pthread_mutex_unlock(&(queue->mutex));
+
+	return chunk;
+}
+
+/**
+ * @fn static void chunkQueueClose(chunkQueue_t *queue)
+ * @brief 더 넣을 버퍼가 없음을 표시하고 기다리는 스레드들을 모두 깨우는 함수
+ * @param queue 닫을 chunkQueue_t 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void chunkQueueClose(chunkQueue_t *queue)
+{
+	pthread_mutex_lock(&(queue->mutex));
+	queue->closed = TRUE;
+	pthread_cond_broadcast(&(queue->notEmpty));
+	pthread_mutex_unlock(&(queue->mutex));
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for partitionManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int partitionManagerOpenOutputs(partitionManager_t *partitionManager)
+ * @brief 등급별 출력 파일 경로를 만들고 파일을 새로 여는 함수
+ * partitionManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param partitionManager 작업을 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionManagerOpenOutputs(partitionManager_t *partitionManager)
+{
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		partitionGrade_t *grade = &(partitionManager->gradeList[gradeIndex]);
+		char gradeName[2] = { gradeManagerGetGradeFromIndex(gradeIndex), '\0' };
+		const char *baseName = (gradeName[0] == '?') ? PARTITION_INVALID_NAME : gradeName;
+
+		if(snprintf(grade->path, sizeof(grade->path), "%s/%s%s", partitionManager->outputDir, baseName, PARTITION_OUTPUT_SUFFIX) >= (int)sizeof(grade->path))
+		{
+			printf("[ERROR] 출력 파일 경로가 너무 김. (outputDir:%s)\n", partitionManager->outputDir);
+			return FAIL;
+		}
+
+		grade->fd = open(grade->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if(grade->fd == -1)
+		{
+			printf("[ERROR] 출력 파일 열기 실패. (fileName:%s, errno:%d)\n", grade->path, errno);
+			return FAIL;
+		}
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int partitionManagerGetRunPath(const partitionManager_t *partitionManager, int gradeIndex, int runId, char *path, size_t size)
+ * @brief 등급과 런 번호로 런 파일 경로를 만드는 함수 (출력 디렉토리 안의 숨김 파일)
+ * @param partitionManager 작업을 관리하는 구조체(입력, 읽기 전용)
+ * @param gradeIndex 등급 인덱스(입력)
+ * @param runId 런 번호(입력)
+ * @param path 런 파일 경로(출력)
+ * @param size path 버퍼 크기(입력)
+ * @return 성공 시 SUCCESS, 경로가 너무 길면 FAIL 반환
+ */
+static int partitionManagerGetRunPath(const partitionManager_t *partitionManager, int gradeIndex, int runId, char *path, size_t size)
+{
+	if(snprintf(path, size, "%s/.run_%d_%d", partitionManager->outputDir, gradeIndex, runId) >= (int)size)
+	{
+		printf("[ERROR] 런 파일 경로가 너무 김. (outputDir:%s)\n", partitionManager->outputDir);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int partitionManagerReadInput(partitionManager_t *partitionManager)
+ * @brief 입력 파일을 구간 버퍼 크기만큼 순차적으로 읽어 개행 문자 경계에서 잘라 작업 스레드 큐에 넣는 함수
+ * gzip, zstd 로 압축된 입력은 압축을 풀면서 읽는다.
+ * 마지막 개행 문자 뒤의 잘린 레코드는 다음 구간 버퍼의 앞으로 옮긴다.
+ * 이미 읽은 범위는 페이지 캐시에서 내리도록 알려서 입력이 메모리보다 커도 캐시를 차지하지 않게 한다.
+ * partitionManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param partitionManager 작업을 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionManagerReadInput(partitionManager_t *partitionManager)
+{
+	// gzip, zstd 로 압축된 입력은 이 스레드에서 압축을 풀면서 작업 스레드들의 등급 판단과 동시에 진행한다.
+	inputReader_t *reader = inputReaderNew(partitionManager->inputPath);
+	if(reader == NULL)
+	{
+		partitionManagerSetFailed(partitionManager);
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	off_t droppedOffset = 0;
+	partitionChunk_t *chunk = chunkQueuePop(&(partitionManager->freeQueue));
+	chunk->length = 0;
+
+	while(chunk != NULL)
+	{
+		if(partitionManagerIsFailed(partitionManager) == TRUE)
+		{
+			result = FAIL;
+			break;
+		}
+
+		// 레코드 하나가 버퍼보다 길면 버퍼를 늘린다.
+		if(chunk->length == chunk->capacity && partitionChunkReserve(chunk, chunk->capacity * 2) == FAIL)
+		{
+			result = FAIL;
+			break;
+		}
+
+		ssize_t readSize = inputReaderRead(reader, chunk->data + chunk->length, chunk->capacity - chunk->length);
+		if(readSize < 0)
+		{
+			result = FAIL;
+			break;
+		}
+
+		if(readSize == 0)
+		{
+			if(chunk->length > 0) chunkQueuePush(&(partitionManager->fullQueue), chunk);
+			else chunkQueuePush(&(partitionManager->freeQueue), chunk);
+			chunk = NULL;
+			break;
+		}
+
+		chunk->length += (size_t)readSize;
+		partitionManager->inputByteNum += readSize;
+		if(chunk->length < chunk->capacity) continue;
+
+		const char *lastNewLine = (const char*)memrchr(chunk->data, '\n', chunk->length);
+		if(lastNewLine == NULL) continue;
+
+		size_t usedLength = (size_t)(lastNewLine - chunk->data) + 1;
+		size_t remainLength = chunk->length - usedLength;
+		partitionChunk_t *nextChunk = chunkQueuePop(&(partitionManager->freeQueue));
+		if(partitionChunkReserve(nextChunk, remainLength) == FAIL)
+		{
+			chunkQueuePush(&(partitionManager->freeQueue), nextChunk);
+			result = FAIL;
+			break;
+		}
+		memcpy(nextChunk->data, chunk->data + usedLength, remainLength);
+		nextChunk->length = remainLength;
+
+		chunk->length = usedLength;
+		chunkQueuePush(&(partitionManager->fullQueue), chunk);
+		chunk = nextChunk;
+
+		off_t readOffset = (off_t)reader->compressedByteNum;
+		posix_fadvise(reader->fd, droppedOffset, readOffset - droppedOffset, POSIX_FADV_DONTNEED);
+		droppedOffset = readOffset;
+	}
+
+	if(chunk != NULL) chunkQueuePush(&(partitionManager->freeQueue), chunk);
+	if(result == FAIL) partitionManagerSetFailed(partitionManager);
+	inputReaderDelete(&reader);
+	return result;
+}
+
+/**
+ * @fn static int partitionChunkReserve(partitionChunk_t *chunk, size_t capacity)
+ * @brief 구간 버퍼가 지정한 크기 이상이 되도록 늘리는 함수 (이미 크면 그대로 둔다)
+ * @param chunk 늘릴 구간 버퍼(입력 및 출력)
+ * @param capacity 필요한 크기(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionChunkReserve(partitionChunk_t *chunk, size_t capacity)
+{
+	if(chunk->data != NULL && chunk->capacity >= capacity) return SUCCESS;
+
+	char *data = (char*)hugeRealloc(chunk->data, capacity);
+	if(data == NULL)
+	{
+		printf("[DEBUG] 구간 버퍼 동적 생성 실패. NULL. (capacity:%zu)\n", capacity);
+		return FAIL;
+	}
+
+	chunk->data = data;
+	chunk->capacity = capacity;
+	return SUCCESS;
+}
+
+/**
+ * @fn static void* partitionManagerWorkerThread(void *data)
+ * @brief 채워진 구간 버퍼를 꺼내 레코드별 등급을 판단하고 등급별 버퍼에 모으는 작업 스레드 함수
+ * 오류가 발생한 뒤에도 읽기 스레드가 멈추지 않도록 버퍼는 계속 꺼내서 돌려준다.
+ * @param data 작업 스레드 정보(partitionWorker_t)
+ * @return 항상 NULL 반환
+ */
+static void* partitionManagerWorkerThread(void *data)
+{
+	partitionWorker_t *worker = (partitionWorker_t*)data;
+	partitionManager_t *partitionManager = worker->partitionManager;
+	int gradeIndex = 0;
+	int result = SUCCESS;
+
+	gradeStatsInit(&(worker->stats));
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		if(recordBufferInit(&(worker->bufferList[gradeIndex]), partitionManager->bufferSize) == FAIL) result = FAIL;
+	}
+	if(partitionManager->sorted == TRUE && recordBufferInit(&(worker->sortBuffer), partitionManager->bufferSize) == FAIL) result = FAIL;
+	if(result == FAIL) partitionManagerSetFailed(partitionManager);
+
+	partitionChunk_t *chunk = NULL;
+	while((chunk = chunkQueuePop(&(partitionManager->fullQueue))) != NULL)
+	{
+		if(partitionManagerIsFailed(partitionManager) == FALSE) partitionWorkerProcessChunk(worker, chunk);
+		chunkQueuePush(&(partitionManager->freeQueue), chunk);
+	}
+
+	for(gradeIndex = 0; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		if(partitionManagerIsFailed(partitionManager) == FALSE && partitionWorkerFlush(worker, gradeIndex) == FAIL)
+		{
+			partitionManagerSetFailed(partitionManager);
+		}
+		recordBufferFinal(&(worker->bufferList[gradeIndex]));
+	}
+	if(partitionManager->sorted == TRUE) recordBufferFinal(&(worker->sortBuffer));
+
+	return NULL;
+}
+
+/**
+ * @fn static void partitionWorkerProcessChunk(partitionWorker_t *worker, const partitionChunk_t *chunk)
+ * @brief 구간 버퍼의 레코드마다 등급을 판단해서 해당 등급 버퍼에 붙이고, 가득 찬 버퍼는 내보내는 함수
+ * 레코드 형식과 빈 줄 처리는 recordGradeBlock 과 같고, 등급 파일에는 입력 레코드만 기록한다.
+ * @param worker 작업 스레드 정보(입력 및 출력)
+ * @param chunk 처리할 구간 버퍼(입력, 읽기 전용)
+ * @return 반환값 없음 (실패하면 partitionManager 의 실패 표시를 설정)
+ */
+static void partitionWorkerProcessChunk(partitionWorker_t *worker, const partitionChunk_t *chunk)
+{
+	partitionManager_t *partitionManager = worker->partitionManager;
+	const gradeManager_t *gradeManager = partitionManager->gradeManager;
+	const char *data = chunk->data;
+	size_t length = chunk->length;
+	size_t pos = 0;
+
+	while(pos < length)
+	{
+		const char *line = data + pos;
+		const char *newLine = (const char*)memchr(line, '\n', length - pos);
+		size_t lineLength = (newLine == NULL) ? (length - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		size_t textLength = lineLength;
+		while(textLength > 0 && (line[textLength - 1] == ' ' || line[textLength - 1] == '\t' || line[textLength - 1] == '\r')) textLength--;
+		if(textLength == 0) continue;
+
+		int score = 0;
+		char grade = '?';
+		if(recordParseScore(gradeManager, line, textLength, &score) == SUCCESS)
+		{
+			grade = gradeManagerClassifyScore(gradeManager, score);
+		}
+		gradeStatsAdd(&(worker->stats), score, grade);
+
+		int gradeIndex = gradeManagerGetGradeIndex(grade);
+		recordBuffer_t *buffer = &(worker->bufferList[gradeIndex]);
+		if(buffer->length > 0 && buffer->length + textLength + 1 > partitionManager->bufferSize && partitionWorkerFlush(worker, gradeIndex) == FAIL)
+		{
+			partitionManagerSetFailed(partitionManager);
+			return;
+		}
+
+		if(recordBufferAppend(buffer, line, textLength) == FAIL || recordBufferAppend(buffer, "\n", 1) == FAIL)
+		{
+			partitionManagerSetFailed(partitionManager);
+			return;
+		}
+	}
+}
+
+/**
+ * @fn static int partitionWorkerFlush(partitionWorker_t *worker, int gradeIndex)
+ * @brief 등급 버퍼의 내용을 등급 파일에 한 번에 쓰거나(정렬 모드는 런 파일로 내보내고) 버퍼를 비우는 함수
+ * @param worker 작업 스레드 정보(입력 및 출력)
+ * @param gradeIndex 내보낼 등급 인덱스(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionWorkerFlush(partitionWorker_t *worker, int gradeIndex)
+{
+	partitionManager_t *partitionManager = worker->partitionManager;
+	recordBuffer_t *buffer = &(worker->bufferList[gradeIndex]);
+	if(buffer->length == 0) return SUCCESS;
+
+	if(partitionManager->sorted == TRUE)
+	{
+		int result = partitionWorkerSpillRun(worker, gradeIndex);
+		buffer->length = 0;
+		return result;
+	}
+
+	partitionGrade_t *grade = &(partitionManager->gradeList[gradeIndex]);
+	pthread_mutex_lock(&(grade->mutex));
+	int result = recordBufferWriteAll(grade->fd, buffer->data, buffer->length);
+	grade->byteNum += (long long)buffer->length;
+	pthread_mutex_unlock(&(grade->mutex));
+
+	buffer->length = 0;
+	return result;
+}
+
+/**
+ * @fn static int partitionWorkerSpillRun(partitionWorker_t *worker, int gradeIndex)
+ * @brief 등급 버퍼의 레코드들을 점수 순으로 정렬해서 새 런 파일로 내보내는 함수
+ * @param worker 작업 스레드 정보(입력 및 출력)
+ * @param gradeIndex 내보낼 등급 인덱스(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionWorkerSpillRun(partitionWorker_t *worker, int gradeIndex)
+{
+	partitionManager_t *partitionManager = worker->partitionManager;
+	const recordBuffer_t *buffer = &(worker->bufferList[gradeIndex]);
+	size_t entryNum = 0;
+	size_t entryCapacity = 1024;
+	size_t pos = 0;
+
+	partitionEntry_t *entryList = (partitionEntry_t*)malloc(sizeof(partitionEntry_t) * entryCapacity);
+	if(entryList == NULL)
+	{
+		printf("[DEBUG] 정렬 목록 동적 생성 실패. NULL.\n");
+		return FAIL;
+	}
+
+	// 버퍼의 레코드는 모두 개행 문자로 끝난다.
+	while(pos < buffer->length)
+	{
+		const char *line = buffer->data + pos;
+		size_t lineLength = (size_t)((const char*)memchr(line, '\n', buffer->length - pos) - line) + 1;
+
+		if(entryNum == entryCapacity)
+		{
+			partitionEntry_t *newList = (partitionEntry_t*)realloc(entryList, sizeof(partitionEntry_t) * entryCapacity * 2);
+			if(newList == NULL)
+			{
+				printf("[DEBUG] 정렬 목록 동적 생성 실패. NULL.\n");
+				free(entryList);
+				return FAIL;
+			}
+			entryList = newList;
+			entryCapacity *= 2;
+		}
+
+		partitionEntry_t *entry = &(entryList[entryNum++]);
+		if(recordParseScore(partitionManager->gradeManager, line, lineLength - 1, &(entry->score)) == FAIL) entry->score = INT_MIN;
+		entry->length = (unsigned int)lineLength;
+		entry->offset = pos;
+		pos += lineLength;
+	}
+
+	qsort(entryList, entryNum, sizeof(partitionEntry_t), partitionEntryCompare);
+
+	recordBuffer_t *sortBuffer = &(worker->sortBuffer);
+	size_t entryIndex = 0;
+	int result = SUCCESS;
+	sortBuffer->length = 0;
+	for( ; entryIndex < entryNum && result == SUCCESS; entryIndex++)
+	{
+		result = recordBufferAppend(sortBuffer, buffer->data + entryList[entryIndex].offset, entryList[entryIndex].length);
+	}
+	free(entryList);
+
+	char path[PATH_MAX];
+	int runId = __atomic_fetch_add(&(partitionManager->gradeList[gradeIndex].runNum), 1, __ATOMIC_RELAXED);
+	if(result == FAIL || partitionManagerGetRunPath(partitionManager, gradeIndex, runId, path, sizeof(path)) == FAIL)
+	{
+		return FAIL;
+	}
+
+	int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	if(fd == -1)
+	{
+		printf("[ERROR] 런 파일 열기 실패. (fileName:%s, errno:%d)\n", path, errno);
+		return FAIL;
+	}
+
+	result = recordBufferWriteAll(fd, sortBuffer->data, sortBuffer->length);
+	if(close(fd) == -1) result = FAIL;
+	return result;
+}
+
+/**
+ * @fn static int partitionEntryCompare(const void *left, const void *right)
+ * @brief qsort 에서 사용하는 정렬 기준 함수 (점수 오름차순, 같으면 버퍼 안 순서)
+ * @param left 비교할 partitionEntry_t(입력, 읽기 전용)
+ * @param right 비교할 partitionEntry_t(입력, 읽기 전용)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int partitionEntryCompare(const void *left, const void *right)
+{
+	const partitionEntry_t *leftEntry = (const partitionEntry_t*)left;
+	const partitionEntry_t *rightEntry = (const partitionEntry_t*)right;
+
+	if(leftEntry->score != rightEntry->score) return (leftEntry->score < rightEntry->score) ? -1 : 1;
+	return (leftEntry->offset < rightEntry->offset) ? -1 : 1;
+}
+
+/**
+ * @fn static int partitionManagerMergeGrade(partitionManager_t *partitionManager, int gradeIndex)
+ * @brief 한 등급의 런 파일들을 병합해서 점수 순으로 정렬된 등급 파일을 만드는 함수
+ * 런 파일이 PARTITION_MERGE_FAN_IN 개보다 많으면 앞에서부터 묶어 중간 런 파일로 병합하기를 반복한다.
+ * partitionManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param partitionManager 작업을 관리하는 구조체(입력 및 출력)
+ * @param gradeIndex 병합할 등급 인덱스(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionManagerMergeGrade(partitionManager_t *partitionManager, int gradeIndex)
+{
+	partitionGrade_t *grade = &(partitionManager->gradeList[gradeIndex]);
+	int firstRunId = 0;
+	long long byteNum = 0;
+
+	while(grade->runNum - firstRunId > PARTITION_MERGE_FAN_IN)
+	{
+		char path[PATH_MAX];
+		int runId = grade->runNum;
+		if(partitionManagerGetRunPath(partitionManager, gradeIndex, runId, path, sizeof(path)) == FAIL)
+		{
+			return FAIL;
+		}
+
+		int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		if(fd == -1)
+		{
+			printf("[ERROR] 런 파일 열기 실패. (fileName:%s, errno:%d)\n", path, errno);
+			return FAIL;
+		}
+
+		int result = partitionManagerMergeRuns(partitionManager, gradeIndex, firstRunId, PARTITION_MERGE_FAN_IN, fd, &byteNum);
+		if(close(fd) == -1) result = FAIL;
+		if(result == FAIL) return FAIL;
+
+		grade->runNum++;
+		firstRunId += PARTITION_MERGE_FAN_IN;
+	}
+
+	byteNum = 0;
+	int result = partitionManagerMergeRuns(partitionManager, gradeIndex, firstRunId, grade->runNum - firstRunId, grade->fd, &byteNum);
+	grade->byteNum = byteNum;
+	return result;
+}
+
+/**
+ * @fn static int partitionManagerMergeRuns(partitionManager_t *partitionManager, int gradeIndex, int firstRunId, int runNum, int outputFd, long long *byteNum)
+ * @brief 연속된 번호의 런 파일들을 최소 힙으로 병합해서 출력 파일에 쓰고, 병합한 런 파일은 삭제하는 함수
+ * @param partitionManager 작업을 관리하는 구조체(입력, 읽기 전용)
+ * @param gradeIndex 등급 인덱스(입력)
+ * @param firstRunId 병합할 첫 런 번호(입력)
+ * @param runNum 병합할 런 개수(입력, PARTITION_MERGE_FAN_IN 이하)
+ * @param outputFd 병합 결과를 쓸 파일 디스크립터(입력)
+ * @param byteNum 기록한 바이트 수(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int partitionManagerMergeRuns(partitionManager_t *partitionManager, int gradeIndex, int firstRunId, int runNum, int outputFd, long long *byteNum)
+{
+	partitionRun_t runList[PARTITION_MERGE_FAN_IN];
+	partitionRun_t *heap[PARTITION_MERGE_FAN_IN];
+	recordBuffer_t output;
+	char path[PATH_MAX];
+	int heapNum = 0;
+	int runIndex = 0;
+	int result = recordBufferInit(&output, PARTITION_BUFFER_SIZE);
+
+	for( ; runIndex < runNum; runIndex++)
+	{
+		partitionRun_t *run = &(runList[runIndex]);
+		memset(run, 0, sizeof(partitionRun_t));
+		run->fd = -1;
+		run->order = runIndex;
+		if(result == FAIL || partitionManagerGetRunPath(partitionManager, gradeIndex, firstRunId + runIndex, path, sizeof(path)) == FAIL)
+		{
+			result = FAIL;
+			continue;
+		}
+
+		run->fd = open(path, O_RDONLY);
+		run->capacity = PARTITION_MERGE_BUFFER_SIZE;
+		run->buffer = (char*)malloc(run->capacity);
+		if(run->fd == -1 || run->buffer == NULL)
+		{
+			printf("[ERROR] 런 파일 열기 실패. (fileName:%s, errno:%d)\n", path, errno);
+			result = FAIL;
+			continue;
+		}
+		posix_fadvise(run->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+		unlink(path);
+
+		int nextResult = partitionRunNext(partitionManager->gradeManager, run);
+		if(nextResult == FAIL) result = FAIL;
+		else if(nextResult == SUCCESS) heap[heapNum++] = run;
+	}
+
+	int heapIndex = heapNum / 2 - 1;
+	for( ; heapIndex >= 0; heapIndex--)
+	{
+		partitionHeapSiftDown(heap, heapNum, heapIndex);
+	}
+
+	while(heapNum > 0 && result == SUCCESS)
+	{
+		partitionRun_t *run = heap[0];
+		if(output.length + run->lineLength > output.capacity)
+		{
+			result = recordBufferWriteAll(outputFd, output.data, output.length);
+			*byteNum += (long long)output.length;
+			output.length = 0;
+		}
+		if(result == SUCCESS) result = recordBufferAppend(&output, run->line, run->lineLength);
+
+		int nextResult = partitionRunNext(partitionManager->gradeManager, run);
+		if(nextResult == FAIL) result = FAIL;
+		else if(nextResult != SUCCESS) heap[0] = heap[--heapNum];
+		partitionHeapSiftDown(heap, heapNum, 0);
+	}
+
+	if(result == SUCCESS && output.length > 0)
+	{
+		result = recordBufferWriteAll(outputFd, output.data, output.length);
+		*byteNum += (long long)output.length;
+	}
+
+	for(runIndex = 0; runIndex < runNum; runIndex++)
+	{
+		if(runList[runIndex].fd != -1) close(runList[runIndex].fd);
+		free(runList[runIndex].buffer);
+	}
+	recordBufferFinal(&output);
+
+	return result;
+}
+
+/**
+ * @fn static int partitionRunNext(const gradeManager_t *gradeManager, partitionRun_t *run)
+ * @brief 런 파일에서 다음 줄을 찾고 점수를 읽는 함수 (버퍼에 한 줄이 없으면 남은 부분을 앞으로 옮기고 더 읽는다)
+ * @param gradeManager 고정 소수점 배율을 가진 등급 정보 구조체(입력, 읽기 전용)
+ * @param run 읽을 런 파일 정보(입력 및 출력)
+ * @return 다음 줄이 있으면 SUCCESS, 파일 끝이면 0, 실패 시 FAIL 반환
+ */
+static int partitionRunNext(const gradeManager_t *gradeManager, partitionRun_t *run)
+{
+	for(;;)
+	{
+		const char *newLine = (const char*)memchr(run->buffer + run->pos, '\n', run->length - run->pos);
+		if(newLine != NULL)
+		{
+			run->line = run->buffer + run->pos;
+			run->lineLength = (size_t)(newLine - run->line) + 1;
+			run->pos += run->lineLength;
+			if(recordParseScore(gradeManager, run->line, run->lineLength - 1, &(run->score)) == FAIL) run->score = INT_MIN;
+			return SUCCESS;
+		}
+
+		if(run->eof == TRUE) return 0;
+
+		memmove(run->buffer, run->buffer + run->pos, run->length - run->pos);
+		run->length -= run->pos;
+		run->pos = 0;
+
+		if(run->length == run->capacity)
+		{
+			char *buffer = (char*)realloc(run->buffer, run->capacity * 2);
+			if(buffer == NULL)
+			{
+				printf("[DEBUG] 런 읽기 버퍼 동적 생성 실패. NULL.\n");
+				return FAIL;
+			}
+			run->buffer = buffer;
+			run->capacity *= 2;
+		}
+
+		ssize_t readSize = read(run->fd, run->buffer + run->length, run->capacity - run->length);
+		if(readSize < 0)
+		{
+			if(errno == EINTR) continue;
+			printf("[ERROR] 런 파일 읽기 실패. (fd:%d, errno:%d)\n", run->fd, errno);
+			return FAIL;
+		}
+
+		if(readSize == 0) run->eof = TRUE;
+		run->length += (size_t)readSize;
+	}
+}
+
+/**
+ * @fn static int partitionRunLess(const partitionRun_t *left, const partitionRun_t *right)
+ * @brief 두 런의 현재 줄 중 어느 쪽이 먼저 출력되어야 하는지 판단하는 함수 (점수, 런 순서)
+ * @param left 비교할 런(입력, 읽기 전용)
+ * @param right 비교할 런(입력, 읽기 전용)
+ * @return left 가 앞이면 TRUE, 아니면 FALSE 반환
+ */
+static int partitionRunLess(const partitionRun_t *left, const partitionRun_t *right)
+{
+	if(left->score != right->score) return (left->score < right->score) ? TRUE : FALSE;
+	return (left->order < right->order) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static void partitionHeapSiftDown(partitionRun_t **heap, int heapNum, int index)
+ * @brief 최소 힙에서 지정한 위치의 런을 아래로 내려 힙 조건을 맞추는 함수
+ * @param heap 런 포인터 힙 배열(입력 및 출력)
+ * @param heapNum 힙에 있는 런 개수(입력)
+ * @param index 내릴 위치(입력)
+ * @return 반환값 없음
+ */
+static void partitionHeapSiftDown(partitionRun_t **heap, int heapNum, int index)
+{
+	for(;;)
+	{
+		int smallest = index;
+		int left = index * 2 + 1;
+		int right = left + 1;
+
+		if(left < heapNum && partitionRunLess(heap[left], heap[smallest]) == TRUE) smallest = left;
+		if(right < heapNum && partitionRunLess(heap[right], heap[smallest]) == TRUE) smallest = right;
+		if(smallest == index) return;
+
+		partitionRun_t *temp = heap[index];
+		heap[index] = heap[smallest];
+		heap[smallest] = temp;
+		index = smallest;
+	}
+}
+
+/**
+ * @fn static void partitionManagerSetFailed(partitionManager_t *partitionManager)
+ * @brief 처리 중 오류가 발생했음을 모든 스레드에 알리는 함수
+ * @param partitionManager 작업을 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void partitionManagerSetFailed(partitionManager_t *partitionManager)
+{
+	__atomic_store_n(&(partitionManager->failed), TRUE, __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn static int partitionManagerIsFailed(partitionManager_t *partitionManager)
+ * @brief 처리 중 오류가 발생했는지 확인하는 함수
+ * @param partitionManager 작업을 관리하는 구조체(입력, 읽기 전용)
+ * @return 오류가 발생했으면 TRUE, 아니면 FALSE 반환
+ */
+static int partitionManagerIsFailed(partitionManager_t *partitionManager)
+{
+	return __atomic_load_n(&(partitionManager->failed), __ATOMIC_RELAXED);
+}
@@ -0,0 +1,183 @@
+#ifndef __PARTITION_MANAGER_H__
+#define __PARTITION_MANAGER_H__
+
+#include <pthread.h>
+#include <limits.h>
+
+#include "inputManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 입력 파일을 한 번에 읽는 구간 크기 (바이트, 구간은 개행 문자 경계에서 나뉜다)
+#define PARTITION_CHUNK_SIZE		(4 * 1024 * 1024)
+// 스레드별 등급 출력 버퍼 크기 (가득 차면 등급 파일에 한 번에 쓴다)
+#define PARTITION_BUFFER_SIZE		(1024 * 1024)
+// 점수 순 정렬 모드에서 스레드별 등급 버퍼 크기 (가득 차면 정렬된 런 파일로 내보낸다)
+#define PARTITION_RUN_SIZE			(8 * 1024 * 1024)
+// 한 번에 병합하는 런 파일 최대 개수 (넘으면 여러 단계로 병합한다)
+#define PARTITION_MERGE_FAN_IN		64
+// 병합할 때 런 파일별 읽기 버퍼 크기
+#define PARTITION_MERGE_BUFFER_SIZE	(256 * 1024)
+// 작업 스레드 최대 개수
+#define PARTITION_MAX_THREAD_NUM	64
+// 등급별 출력 파일 확장자
+#define PARTITION_OUTPUT_SUFFIX		".txt"
+// 점수 범위를 벗어나거나 읽을 수 없는 레코드의 출력 파일 이름
+#define PARTITION_INVALID_NAME		"invalid"
+
+/**
+ * @struct partitionChunk_t
+ * @brief 입력 파일에서 읽은 구간(개행 문자로 끝나는 레코드들)을 담는 버퍼 구조체
+ */
+typedef struct partitionChunk_s partitionChunk_t;
+struct partitionChunk_s
+{
+	// 구간 데이터
+	char *data;
+	// 구간 데이터 길이
+	size_t length;
+	// 할당된 버퍼 크기 (한 레코드가 버퍼보다 길면 늘어난다)
+	size_t capacity;
+};
+
+/**
+ * @struct chunkQueue_t
+ * @brief 읽기 스레드와 작업 스레드 사이에서 구간 버퍼를 주고받는 고정 크기 큐 구조체
+ * 빈 버퍼 큐와 채워진 버퍼 큐 두 개로 버퍼를 순환시키므로 전체 버퍼 개수 이상의 메모리는 쓰지 않는다.
+ */
+typedef struct chunkQueue_s chunkQueue_t;
+struct chunkQueue_s
+{
+	// 큐 접근 동기화
+	pthread_mutex_t mutex;
+	// 큐가 비어있지 않음을 알리는 조건 변수
+	pthread_cond_t notEmpty;
+	// 버퍼 포인터 배열
+	partitionChunk_t **slotList;
+	// 버퍼 포인터 배열의 크기
+	int capacity;
+	// 다음에 꺼낼 위치
+	int head;
+	// 큐에 들어있는 버퍼 개수
+	int count;
+	// 더 넣을 버퍼가 없는지 여부 (TRUE 또는 FALSE)
+	int closed;
+};
+
+/**
+ * @struct partitionGrade_t
+ * @brief 등급 하나의 출력 파일과 런 파일 정보를 관리하는 구조체
+ */
+typedef struct partitionGrade_s partitionGrade_t;
+struct partitionGrade_s
+{
+	// 등급 출력 파일 경로
+	char path[PATH_MAX];
+	// 등급 출력 파일 디스크립터
+	int fd;
+	// 등급 출력 파일 쓰기 동기화
+	pthread_mutex_t mutex;
+	// 만들어진 런 파일 개수 (정렬 모드, 원자적으로 증가)
+	int runNum;
+	// 기록한 바이트 수 (mutex 또는 병합 단계에서만 변경)
+	long long byteNum;
+};
+
+/**
+ * @struct partitionRun_t
+ * @brief 병합 단계에서 정렬된 런 파일 하나를 한 줄씩 읽는 구조체
+ */
+typedef struct partitionRun_s partitionRun_t;
+struct partitionRun_s
+{
+	// 런 파일 디스크립터
+	int fd;
+	// 읽기 버퍼
+	char *buffer;
+	// 읽기 버퍼 크기
+	size_t capacity;
+	// 읽기 버퍼에 있는 데이터 길이
+	size_t length;
+	// 읽기 버퍼에서 다음 줄의 시작 위치
+	size_t pos;
+	// 파일 끝에 도달했는지 여부 (TRUE 또는 FALSE)
+	int eof;
+	// 현재 줄 시작 위치 (읽기 버퍼 안)
+	const char *line;
+	// 현재 줄 길이 (개행 문자 포함)
+	size_t lineLength;
+	// 현재 줄의 점수 (정렬 기준)
+	int score;
+	// 런 순서 (점수가 같으면 먼저 만들어진 런이 앞선다)
+	int order;
+};
+
+typedef struct partitionManager_s partitionManager_t;
+
+/**
+ * @struct partitionWorker_t
+ * @brief 작업 스레드 하나의 등급별 출력 버퍼와 통계를 관리하는 구조체
+ */
+typedef struct partitionWorker_s partitionWorker_t;
+struct partitionWorker_s
+{
+	// 작업을 관리하는 구조체
+	partitionManager_t *partitionManager;
+	// 등급별 출력 버퍼
+	recordBuffer_t bufferList[GRADE_KIND_NUM];
+	// 런 파일로 내보낼 때 정렬된 레코드를 모으는 버퍼 (정렬 모드)
+	recordBuffer_t sortBuffer;
+	// 스레드가 처리한 레코드의 등급 통계
+	gradeStats_t stats;
+};
+
+/**
+ * @struct partitionManager_t
+ * @brief 메모리보다 큰 레코드 파일을 등급별 파일로 나누는 작업을 관리하는 구조체
+ * <처리 흐름>
+ * 읽기(호출한 스레드) -> 구간 큐 -> 작업 스레드(등급 판단, 등급별 버퍼) -> 등급 파일 또는 정렬된 런 파일 -> 병합
+ * 사용하는 메모리는 구간 버퍼 (threadNum + 2) 개와 스레드별 등급 버퍼로 제한된다.
+ */
+struct partitionManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 입력 파일 경로
+	char inputPath[PATH_MAX];
+	// 출력 디렉토리 경로
+	char outputDir[PATH_MAX];
+	// 작업 스레드 개수
+	int threadNum;
+	// 등급 파일 안을 점수 순으로 정렬할지 여부 (TRUE 또는 FALSE)
+	int sorted;
+	// 스레드별 등급 버퍼 크기
+	size_t bufferSize;
+	// 구간 버퍼 목록
+	partitionChunk_t *chunkList;
+	// 구간 버퍼 개수
+	int chunkNum;
+	// 빈 구간 버퍼 큐
+	chunkQueue_t freeQueue;
+	// 채워진 구간 버퍼 큐
+	chunkQueue_t fullQueue;
+	// 등급별 출력 정보
+	partitionGrade_t gradeList[GRADE_KIND_NUM];
+	// 전체 등급 통계
+	gradeStats_t stats;
+	// 입력 바이트 수
+	long long inputByteNum;
+	// 처리 중 오류 발생 여부 (원자적으로 변경, TRUE 또는 FALSE)
+	int failed;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for partitionManager_t
+//////////////////////////////////////////////////////////////////////////
+
+partitionManager_t* partitionManagerNew(const gradeManager_t *gradeManager, const char *inputPath, const char *outputDir, int threadNum, int sorted);
+void partitionManagerDelete(partitionManager_t **partitionManager);
+int partitionManagerRun(partitionManager_t *partitionManager);
+
+#endif // #ifndef __PARTITION_MANAGER_H__
@@ -0,0 +1,343 @@
+#include <errno.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "perfManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for perfGroup_t
+//////////////////////////////////////////////////////////////////////////
+
+static void perfGroupOpen(perfGroup_t *group);
+static void perfGroupClose(perfGroup_t *group);
+static int perfGroupOpenCounter(perfGroup_t *group, int counterType, unsigned int type, unsigned long long config);
+static int perfGroupRead(const perfGroup_t *group, long long *counterList);
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinition of Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+static void printPerItem(FILE *filePtr, const char *name, long long value, long long itemNum, double unit);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for perfReport_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn perfReport_t* perfReportNew(void)
+ * @brief 측정 결과를 관리하는 perfReport_t 객체를 새로 생성하고 하드웨어 카운터 그룹을 여는 함수
+ * 커널이 카운터 사용을 허용하지 않으면(perf_event_paranoid, 컨테이너 등) 카운터 없이 시간만 측정하는 객체를 반환한다.
+ * @return 성공 시 새로 생성된 perfReport_t 구조체 객체, 실패 시 NULL 반환
+ */
+perfReport_t* perfReportNew(void)
+{
+	perfReport_t *report = (perfReport_t*)calloc(1, sizeof(perfReport_t));
+	if(report == NULL)
+	{
+		printf("[DEBUG] perfReport 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	perfGroupOpen(&(report->group));
+	return report;
+}
+
+/**
+ * @fn void perfReportDelete(perfReport_t **report)
+ * @brief 생성된 perfReport_t 구조체 객체의 카운터를 닫고 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param report 삭제할 perfReport_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void perfReportDelete(perfReport_t **report)
+{
+	if(report == NULL || *report == NULL)
+	{
+		printf("[DEBUG] perfReport 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	perfGroupClose(&((*report)->group));
+	free(*report);
+	*report = NULL;
+}
+
+/**
+ * @fn int perfReportBegin(perfReport_t *report, const char *phaseName)
+ * @brief 새 측정 구간을 시작하는 함수, 카운터를 0 으로 초기화하고 켠다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param report 측정 결과를 관리하는 구조체(입력 및 출력)
+ * @param phaseName 구간 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int perfReportBegin(perfReport_t *report, const char *phaseName)
+{
+	if(report == NULL || phaseName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (report:%p, phaseName:%p)\n", (void*)report, (const void*)phaseName);
+		return FAIL;
+	}
+
+	if(report->phaseNum >= PERF_MAX_PHASE_NUM)
+	{
+		printf("[ERROR] 측정 구간 개수 초과. (max:%d)\n", PERF_MAX_PHASE_NUM);
+		return FAIL;
+	}
+
+	perfPhase_t *phase = &(report->phaseList[report->phaseNum]);
+	memset(phase, 0, sizeof(perfPhase_t));
+	snprintf(phase->name, sizeof(phase->name), "%s", phaseName);
+
+	if(report->group.enabled == TRUE)
+	{
+		int leaderFd = report->group.fdList[PERF_CYCLES];
+		ioctl(leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &(report->startTime));
+	return SUCCESS;
+}
+
+/**
+ * @fn int perfReportEnd(perfReport_t *report, long long itemNum)
+ * @brief 현재 측정 구간을 끝내고 시간과 카운터 값을 저장하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param report 측정 결과를 관리하는 구조체(입력 및 출력)
+ * @param itemNum 구간에서 처리한 점수 개수(입력, 점수당 지표 계산에 사용, 0 이면 점수당 지표 생략)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int perfReportEnd(perfReport_t *report, long long itemNum)
+{
+	if(report == NULL)
+	{
+		printf("[DEBUG] perfReport 가 NULL.\n");
+		return FAIL;
+	}
+
+	struct timespec endTime;
+	perfPhase_t *phase = &(report->phaseList[report->phaseNum]);
+	int counterType = 0;
+
+	if(report->group.enabled == TRUE)
+	{
+		ioctl(report->group.fdList[PERF_CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+	phase->itemNum = itemNum;
+	phase->elapsedSec = (double)(endTime.tv_sec - report->startTime.tv_sec) + (double)(endTime.tv_nsec - report->startTime.tv_nsec) / 1e9;
+	for( ; counterType < PERF_COUNTER_NUM; counterType++)
+	{
+		phase->counterList[counterType] = -1;
+	}
+
+	if(report->group.enabled == TRUE && perfGroupRead(&(report->group), phase->counterList) == FAIL)
+	{
+		printf("[ERROR] 하드웨어 카운터 읽기 실패. 이후 시간만 측정함.\n");
+		perfGroupClose(&(report->group));
+	}
+
+	report->phaseNum++;
+	return SUCCESS;
+}
+
+/**
+ * @fn void perfReportPrint(const perfReport_t *report, FILE *filePtr)
+ * @brief 측정 구간별 시간과 카운터, 그리고 IPC 와 점수당 지표를 출력하는 함수
+ * 점수당 분기 예측 실패는 점수 하나당 값으로, 나머지 카운터는 점수 100 만 개당 값으로 출력한다.
+ * @param report 측정 결과를 관리하는 구조체(입력, 읽기 전용)
+ * @param filePtr 결과를 출력할 파일 스트림(입력)
+ * @return 반환값 없음
+ */
+void perfReportPrint(const perfReport_t *report, FILE *filePtr)
+{
+	if(report == NULL || filePtr == NULL) return;
+
+	int phaseIndex = 0;
+
+	fprintf(filePtr, "[성능 측정 결과] (hardware counters:%s)\n", (report->group.enabled == TRUE) ? "on" : "off");
+	for( ; phaseIndex < report->phaseNum; phaseIndex++)
+	{
+		const perfPhase_t *phase = &(report->phaseList[phaseIndex]);
+		const long long *counterList = phase->counterList;
+
+		fprintf(filePtr, "%-10s time=%.6fs items=%lld", phase->name, phase->elapsedSec, phase->itemNum);
+		if(phase->itemNum > 0 && phase->elapsedSec > 0)
+		{
+			fprintf(filePtr, " rate=%.2fM/s", (double)phase->itemNum / phase->elapsedSec / 1e6);
+		}
+		fprintf(filePtr, "\n");
+
+		if(counterList[PERF_CYCLES] < 0) continue;
+
+		fprintf(filePtr, "           cycles=%lld", counterList[PERF_CYCLES]);
+		if(counterList[PERF_INSTRUCTIONS] >= 0)
+		{
+			fprintf(filePtr, " instructions=%lld", counterList[PERF_INSTRUCTIONS]);
+			if(counterList[PERF_CYCLES] > 0)
+			{
+				fprintf(filePtr, " IPC=%.2f", (double)counterList[PERF_INSTRUCTIONS] / (double)counterList[PERF_CYCLES]);
+			}
+		}
+		fprintf(filePtr, "\n          ");
+
+		printPerItem(filePtr, "cycles/score", counterList[PERF_CYCLES], phase->itemNum, 1.0);
+		printPerItem(filePtr, "mispredicts/score", counterList[PERF_BRANCH_MISSES], phase->itemNum, 1.0);
+		printPerItem(filePtr, "branch-misses/Mscore", counterList[PERF_BRANCH_MISSES], phase->itemNum, 1e6);
+		printPerItem(filePtr, "L1D-misses/Mscore", counterList[PERF_L1D_MISSES], phase->itemNum, 1e6);
+		printPerItem(filePtr, "LLC-misses/Mscore", counterList[PERF_LLC_MISSES], phase->itemNum, 1e6);
+		fprintf(filePtr, "\n");
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for perfGroup_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void perfGroupOpen(perfGroup_t *group)
+ * @brief 사이클 카운터를 리더로 하는 카운터 그룹을 여는 함수
+ * 리더를 열지 못하면 카운터를 사용하지 않고, 나머지 카운터는 지원되지 않으면 해당 카운터만 빠진다.
+ * perfReportNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param group 카운터 그룹을 저장할 구조체(출력)
+ * @return 반환값 없음
+ */
+static void perfGroupOpen(perfGroup_t *group)
+{
+	int counterType = 0;
+	for( ; counterType < PERF_COUNTER_NUM; counterType++)
+	{
+		group->fdList[counterType] = -1;
+		group->slotList[counterType] = -1;
+	}
+	group->openedNum = 0;
+	group->enabled = FALSE;
+
+	if(perfGroupOpenCounter(group, PERF_CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES) == FAIL)
+	{
+		int savedErrno = errno;
+		int paranoid = -1;
+		FILE *filePtr = fopen("/proc/sys/kernel/perf_event_paranoid", "r");
+		if(filePtr != NULL)
+		{
+			if(fscanf(filePtr, "%d", &paranoid) != 1) paranoid = -1;
+			fclose(filePtr);
+		}
+
+		printf("[ERROR] 하드웨어 카운터를 사용할 수 없음. 시간만 측정함. (errno:%d, perf_event_paranoid:%d)\n", savedErrno, paranoid);
+		return;
+	}
+
+	perfGroupOpenCounter(group, PERF_INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	perfGroupOpenCounter(group, PERF_BRANCH_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	perfGroupOpenCounter(group, PERF_L1D_MISSES, PERF_TYPE_HW_CACHE,
+		PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+	perfGroupOpenCounter(group, PERF_LLC_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+	group->enabled = TRUE;
+}
+
+/**
+ * @fn static void perfGroupClose(perfGroup_t *group)
+ * @brief 열려 있는 모든 카운터를 닫는 함수
+ * @param group 카운터 그룹(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void perfGroupClose(perfGroup_t *group)
+{
+	int counterType = 0;
+	for( ; counterType < PERF_COUNTER_NUM; counterType++)
+	{
+		if(group->fdList[counterType] != -1) close(group->fdList[counterType]);
+		group->fdList[counterType] = -1;
+		group->slotList[counterType] = -1;
+	}
+	group->openedNum = 0;
+	group->enabled = FALSE;
+}
+
+/**
+ * @fn static int perfGroupOpenCounter(perfGroup_t *group, int counterType, unsigned int type, unsigned long long config)
+ * @brief 카운터 하나를 현재 스레드의 사용자 영역 이벤트로 열어서 그룹에 추가하는 함수
+ * @param group 카운터 그룹(입력 및 출력)
+ * @param counterType 카운터 종류(입력, PERF_COUNTER_TYPE 열거형 참조)
+ * @param type perf_event_attr 의 이벤트 유형(입력)
+ * @param config perf_event_attr 의 이벤트 설정값(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환 (errno 유지)
+ */
+static int perfGroupOpenCounter(perfGroup_t *group, int counterType, unsigned int type, unsigned long long config)
+{
+	struct perf_event_attr attr;
+	int leaderFd = group->fdList[PERF_CYCLES];
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = (leaderFd == -1) ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+	int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, leaderFd, 0);
+	if(fd == -1) return FAIL;
+
+	group->fdList[counterType] = fd;
+	group->slotList[counterType] = group->openedNum++;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int perfGroupRead(const perfGroup_t *group, long long *counterList)
+ * @brief 그룹 전체 카운터 값을 한 번에 읽는 함수
+ * 카운터가 다중화되어 일부 시간만 측정된 경우 (활성 시간 / 실행 시간) 비율로 보정한다.
+ * @param group 카운터 그룹(입력, 읽기 전용)
+ * @param counterList 카운터별 값을 저장할 배열(출력, 열지 못한 카운터는 -1 유지)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int perfGroupRead(const perfGroup_t *group, long long *counterList)
+{
+	// { nr, time_enabled, time_running, value[nr] }
+	unsigned long long readBuffer[3 + PERF_COUNTER_NUM];
+	int counterType = 0;
+
+	ssize_t readSize = read(group->fdList[PERF_CYCLES], readBuffer, sizeof(readBuffer));
+	if(readSize < (ssize_t)(sizeof(unsigned long long) * 3)) return FAIL;
+
+	unsigned long long valueNum = readBuffer[0];
+	double scale = 1.0;
+	if(readBuffer[2] == 0) return SUCCESS;
+	if(readBuffer[2] < readBuffer[1]) scale = (double)readBuffer[1] / (double)readBuffer[2];
+
+	for( ; counterType < PERF_COUNTER_NUM; counterType++)
+	{
+		int slot = group->slotList[counterType];
+		if(slot == -1 || (unsigned long long)slot >= valueNum) continue;
+		counterList[counterType] = (long long)((double)readBuffer[3 + slot] * scale);
+	}
+
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void printPerItem(FILE *filePtr, const char *name, long long value, long long itemNum, double unit)
+ * @brief 카운터 값을 점수 unit 개당 값으로 환산해서 출력하는 함수, 측정하지 못한 값이나 점수 개수가 0 이면 출력하지 않는다.
+ * @param filePtr 결과를 출력할 파일 스트림(입력)
+ * @param name 지표 이름(입력, 읽기 전용)
+ * @param value 카운터 값(입력)
+ * @param itemNum 점수 개수(입력)
+ * @param unit 환산 단위 점수 개수(입력)
+ * @return 반환값 없음
+ */
+static void printPerItem(FILE *filePtr, const char *name, long long value, long long itemNum, double unit)
+{
+	if(value < 0 || itemNum <= 0) return;
+	fprintf(filePtr, " %s=%.3f", name, (double)value * unit / (double)itemNum);
+}
@@ -0,0 +1,90 @@
+#ifndef __PERF_MANAGER_H__
+#define __PERF_MANAGER_H__
+
+#include <time.h>
+
+#include "gradeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 측정 구간(phase) 최대 개수
+#define PERF_MAX_PHASE_NUM	16
+// 측정 구간 이름 최대 길이
+#define PERF_MAX_NAME_LEN	32
+
+// 하드웨어 카운터 종류 열거형 (perfGroup_t 의 카운터 배열 인덱스)
+enum PERF_COUNTER_TYPE
+{
+	PERF_CYCLES = 0,		// CPU 사이클 (그룹 리더)
+	PERF_INSTRUCTIONS,		// 실행된 명령어
+	PERF_BRANCH_MISSES,		// 분기 예측 실패
+	PERF_L1D_MISSES,		// L1 데이터 캐시 읽기 미스
+	PERF_LLC_MISSES,		// 마지막 단계 캐시(LLC) 미스
+	PERF_COUNTER_NUM
+};
+
+/**
+ * @struct perfGroup_t
+ * @brief perf_event_open 으로 연 하드웨어 카운터 그룹을 관리하는 구조체
+ * 그룹 리더(사이클)를 열 수 없으면 카운터 없이 시간만 측정한다.
+ */
+typedef struct perfGroup_s perfGroup_t;
+struct perfGroup_s
+{
+	// 카운터별 파일 디스크립터 (열지 못한 카운터는 -1)
+	int fdList[PERF_COUNTER_NUM];
+	// 그룹 읽기 결과에서 카운터별 위치 (열지 못한 카운터는 -1)
+	int slotList[PERF_COUNTER_NUM];
+	// 그룹에 포함된 카운터 개수
+	int openedNum;
+	// 카운터 사용 가능 여부 (TRUE 또는 FALSE)
+	int enabled;
+};
+
+/**
+ * @struct perfPhase_t
+ * @brief 측정 구간 하나의 시간과 카운터 값을 저장하는 구조체
+ */
+typedef struct perfPhase_s perfPhase_t;
+struct perfPhase_s
+{
+	// 구간 이름
+	char name[PERF_MAX_NAME_LEN];
+	// 구간에서 처리한 점수 개수 (점수당 지표 계산에 사용)
+	long long itemNum;
+	// 구간 실행 시간 (초)
+	double elapsedSec;
+	// 카운터별 값 (다중화된 경우 실행 비율로 보정한 값, 측정하지 못하면 -1)
+	long long counterList[PERF_COUNTER_NUM];
+};
+
+/**
+ * @struct perfReport_t
+ * @brief 여러 측정 구간의 결과를 모아서 지표로 출력하는 구조체
+ */
+typedef struct perfReport_s perfReport_t;
+struct perfReport_s
+{
+	// 하드웨어 카운터 그룹
+	perfGroup_t group;
+	// 측정 구간 목록
+	perfPhase_t phaseList[PERF_MAX_PHASE_NUM];
+	// 측정된 구간 개수
+	int phaseNum;
+	// 현재 측정 중인 구간의 시작 시간
+	struct timespec startTime;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for perfReport_t
+//////////////////////////////////////////////////////////////////////////
+
+perfReport_t* perfReportNew(void);
+void perfReportDelete(perfReport_t **report);
+int perfReportBegin(perfReport_t *report, const char *phaseName);
+int perfReportEnd(perfReport_t *report, long long itemNum);
+void perfReportPrint(const perfReport_t *report, FILE *filePtr);
+
+#endif // #ifndef __PERF_MANAGER_H__
@@ -0,0 +1,563 @@
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinition of Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+static int isBlank(char c);
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for scoreArray_t
+//////////////////////////////////////////////////////////////////////////
+
+static int recordScoreArrayReserve(scoreArray_t *scores, size_t capacity);
+static int recordScoreArraySet(scoreArray_t *scores, int index, int score);
+static int recordLoadBinaryScores(const char *fileName, const char *data, size_t size, int scale, scoreArray_t *scores);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for recordBuffer_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int recordBufferInit(recordBuffer_t *buffer, size_t capacity)
+ * @brief 출력 버퍼를 지정한 크기로 초기화하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param buffer 초기화할 recordBuffer_t 구조체(출력)
+ * @param capacity 처음 할당할 버퍼 크기(입력, 0 이면 RECORD_BUFFER_INIT_SIZE 사용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int recordBufferInit(recordBuffer_t *buffer, size_t capacity)
+{
+	if(buffer == NULL)
+	{
+		printf("[DEBUG] recordBuffer 가 NULL.\n");
+		return FAIL;
+	}
+
+	if(capacity == 0) capacity = RECORD_BUFFER_INIT_SIZE;
+
+	buffer->length = 0;
+	buffer->capacity = capacity;
+	buffer->data = (char*)hugeAlloc(capacity);
+	if(buffer->data == NULL)
+	{
+		printf("[DEBUG] recordBuffer 데이터 동적 생성 실패. NULL. (capacity:%zu)\n", capacity);
+		buffer->capacity = 0;
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn void recordBufferFinal(recordBuffer_t *buffer)
+ * @brief 출력 버퍼의 메모리를 해제하는 함수
+ * @param buffer 해제할 recordBuffer_t 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+void recordBufferFinal(recordBuffer_t *buffer)
+{
+	if(buffer == NULL) return;
+
+	hugeFree(buffer->data);
+	buffer->data = NULL;
+	buffer->length = 0;
+	buffer->capacity = 0;
+}
+
+/**
+ * @fn int recordBufferAppend(recordBuffer_t *buffer, const char *data, size_t length)
+ * @brief 출력 버퍼 뒤에 데이터를 덧붙이는 함수, 공간이 부족하면 버퍼 크기를 두 배씩 늘린다.
+ * 레코드마다 호출되는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param buffer 데이터를 덧붙일 recordBuffer_t 구조체(입력 및 출력)
+ * @param data 덧붙일 데이터(입력, 읽기 전용)
+ * @param length 덧붙일 데이터 길이(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int recordBufferAppend(recordBuffer_t *buffer, const char *data, size_t length)
+{
+	if(buffer->length + length > buffer->capacity)
+	{
+		size_t newCapacity = (buffer->capacity == 0) ? RECORD_BUFFER_INIT_SIZE : buffer->capacity;
+		while(buffer->length + length > newCapacity) newCapacity *= 2;
+
+		char *newData = (char*)hugeRealloc(buffer->data, newCapacity);
+		if(newData == NULL)
+		{
+			printf("[DEBUG] recordBuffer 크기 확장 실패. NULL. (capacity:%zu)\n", newCapacity);
+			return FAIL;
+		}
+
+		buffer->data = newData;
+		buffer->capacity = newCapacity;
+	}
+
+	memcpy(buffer->data + buffer->length, data, length);
+	buffer->length += length;
+	return SUCCESS;
+}
+
+/**
+ * @fn int recordBufferWriteAll(int fd, const char *data, size_t length)
+ * @brief 지정한 데이터를 짧은 쓰기(short write)와 시그널 인터럽트에 관계없이 모두 기록하는 함수
+ * @param fd 기록할 파일 디스크립터(입력)
+ * @param data 기록할 데이터(입력, 읽기 전용)
+ * @param length 기록할 데이터 길이(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int recordBufferWriteAll(int fd, const char *data, size_t length)
+{
+	while(length > 0)
+	{
+		ssize_t written = write(fd, data, length);
+		if(written < 0)
+		{
+			if(errno == EINTR) continue;
+			printf("[ERROR] 파일 쓰기 실패. (fd:%d, errno:%d)\n", fd, errno);
+			return FAIL;
+		}
+
+		data += written;
+		length -= (size_t)written;
+	}
+
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for Record
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int recordParseScore(const gradeManager_t *gradeManager, const char *line, size_t length, int *score)
+ * @brief 레코드 한 줄에서 공백으로 구분된 마지막 토큰을 고정 소수점 점수로 변환하는 함수
+ * 레코드마다 호출되는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param gradeManager 고정 소수점 배율을 가진 등급 정보 구조체(입력, 읽기 전용)
+ * @param line 레코드 문자열(입력, 읽기 전용, NULL 종료 문자가 없어도 됨)
+ * @param length 레코드 문자열 길이(입력, 개행 문자 제외)
+ * @param score 변환된 점수(출력, scale 배 한 정수)
+ * @return 성공 시 SUCCESS, 점수 토큰이 없거나 숫자가 아니면 FAIL 반환
+ */
+int recordParseScore(const gradeManager_t *gradeManager, const char *line, size_t length, int *score)
+{
+	size_t end = length;
+	while(end > 0 && isBlank(line[end - 1]) == TRUE) end--;
+	if(end == 0) return FAIL;
+
+	size_t begin = end;
+	while(begin > 0 && isBlank(line[begin - 1]) == FALSE) begin--;
+
+	return gradeManagerParseScore(gradeManager, line + begin, end - begin, score);
+}
+
+/**
+ * @fn int recordGradeBlock(const gradeManager_t *gradeManager, const char *data, size_t length, recordBuffer_t *output, gradeStats_t *stats)
+ * @brief 여러 레코드가 담긴 메모리 블록의 각 줄에 대한 등급을 판단해서 출력 버퍼와 통계에 누적하는 함수
+ * 빈 줄은 건너뛰고, 점수를 읽을 수 없는 줄은 '?' 등급으로 출력한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param data 레코드들이 개행 문자로 구분된 메모리 블록(입력, 읽기 전용)
+ * @param length 메모리 블록의 길이(입력)
+ * @param output 등급이 붙은 레코드를 덧붙일 출력 버퍼(출력, NULL 이면 통계만 누적)
+ * @param stats 등급 통계(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int recordGradeBlock(const gradeManager_t *gradeManager, const char *data, size_t length, recordBuffer_t *output, gradeStats_t *stats)
+{
+	if(gradeManager == NULL || data == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, data:%p, stats:%p)\n", (const void*)gradeManager, (const void*)data, (void*)stats);
+		return FAIL;
+	}
+
+	size_t pos = 0;
+	while(pos < length)
+	{
+		const char *line = data + pos;
+		const char *newLine = (const char*)memchr(line, '\n', length - pos);
+		size_t lineLength = (newLine == NULL) ? (length - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		if(lineLength > 0 && line[lineLength - 1] == '\r') lineLength--;
+
+		size_t textLength = lineLength;
+		while(textLength > 0 && isBlank(line[textLength - 1]) == TRUE) textLength--;
+		if(textLength == 0) continue;
+
+		int score = 0;
+		char grade = '?';
+		if(recordParseScore(gradeManager, line, textLength, &score) == SUCCESS)
+		{
+			grade = gradeManagerClassifyScore(gradeManager, score);
+		}
+		gradeStatsAdd(stats, score, grade);
+
+		if(output == NULL) continue;
+
+		char suffix[3] = { ' ', grade, '\n' };
+		if(recordBufferAppend(output, line, textLength) == FAIL) return FAIL;
+		if(recordBufferAppend(output, suffix, sizeof(suffix)) == FAIL) return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for scoreArray_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int recordLoadScoreArray(const gradeManager_t *gradeManager, const char *fileName, int width, scoreArray_t *scores)
+ * @brief 점수 파일의 모든 레코드에서 점수를 읽어 지정한 원소 크기의 점수 배열로 만드는 함수
+ * 빈 줄은 건너뛰고, 점수를 읽을 수 없는 줄은 RECORD_INVALID_SCORE 로 넣어서 '?' 로 판단되게 한다. (배열 위치가 입력 레코드 순서와 어긋나지 않는다)
+ * 파일이 RECORD_BINARY_MAGIC 으로 시작하면 이진 점수 파일로 읽는다.
+ * 좁은 배열로 읽을 때 등급 전체 범위를 벗어난 점수는 원래 값으로 검사해서 범위 밖 표시로 바꾸므로 잘려서 범위 안 값이 되지 않는다.
+ * 사용이 끝난 배열은 recordScoreArrayFinal 로 해제해야 한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 고정 소수점 배율과 전체 범위를 가진 등급 정보 구조체(입력, 읽기 전용)
+ * @param fileName 점수 파일 이름(입력, 읽기 전용)
+ * @param width 원소 크기(입력, SCORE_WIDTH, SCORE_WIDTH_AUTO 이면 전체 범위에 맞는 가장 작은 크기)
+ * @param scores 새로 생성된 점수 배열(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int recordLoadScoreArray(const gradeManager_t *gradeManager, const char *fileName, int width, scoreArray_t *scores)
+{
+	if(gradeManager == NULL || fileName == NULL || scores == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, fileName:%p, scores:%p)\n", (const void*)gradeManager, (const void*)fileName, (void*)scores);
+		return FAIL;
+	}
+
+	int minWidth = gradeManagerGetScoreWidth(gradeManager);
+	if(width == SCORE_WIDTH_AUTO) width = minWidth;
+	if(width != SCORE_WIDTH_8 && width != SCORE_WIDTH_16 && width != SCORE_WIDTH_32)
+	{
+		printf("[DEBUG] 알 수 없는 점수 배열 원소 크기. (width:%d)\n", width);
+		return FAIL;
+	}
+	if(width < minWidth)
+	{
+		printf("[ERROR] 등급 전체 범위가 점수 배열 원소 크기보다 큼. (width:%d, minimum width:%d)\n", width * 8, minWidth * 8);
+		return FAIL;
+	}
+
+	memset(scores, 0, sizeof(scoreArray_t));
+	scores->width = width;
+	scores->base = gradeManager->totalMin;
+	// 좁은 배열이면 전체 범위의 길이가 원소 최대값보다 작음을 위에서 확인했다.
+	scores->range = (width == SCORE_WIDTH_32) ? 0 : gradeManager->totalMax - gradeManager->totalMin;
+
+	int fd = open(fileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 점수 파일 열기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		return FAIL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1)
+	{
+		printf("[ERROR] 점수 파일 정보 읽기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		close(fd);
+		return FAIL;
+	}
+
+	size_t size = (size_t)fileStat.st_size;
+	char *data = NULL;
+	if(size > 0)
+	{
+		void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapped == MAP_FAILED)
+		{
+			printf("[ERROR] 점수 파일 매핑 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+			close(fd);
+			return FAIL;
+		}
+		madvise(mapped, size, MADV_SEQUENTIAL);
+		data = (char*)mapped;
+	}
+	close(fd);
+
+	int result = SUCCESS;
+	if(size >= sizeof(recordBinaryHeader_t) && memcmp(data, RECORD_BINARY_MAGIC, 4) == 0)
+	{
+		result = recordLoadBinaryScores(fileName, data, size, gradeManager->scale, scores);
+	}
+	else
+	{
+		// 한 줄은 최소 2 바이트(숫자와 개행 문자)이므로 파일 크기의 절반이면 충분하다.
+		size_t capacity = size / 2 + 1;
+		if(capacity > INT_MAX) capacity = INT_MAX;
+		result = recordScoreArrayReserve(scores, capacity);
+
+		size_t pos = 0;
+		int count = 0;
+		while(result == SUCCESS && pos < size)
+		{
+			const char *line = data + pos;
+			const char *newLine = (const char*)memchr(line, '\n', size - pos);
+			size_t lineLength = (newLine == NULL) ? (size - pos) : (size_t)(newLine - line);
+			pos += lineLength + 1;
+
+			// recordGradeBlock 과 같이 공백만 있는 줄은 레코드로 세지 않는다.
+			while(lineLength > 0 && isBlank(line[lineLength - 1]) == TRUE) lineLength--;
+			if(lineLength == 0) continue;
+
+			// 이진 점수 파일과 같이 int 로 셀 수 없는 개수는 잘라서 읽지 않고 실패한다.
+			if((size_t)count >= capacity)
+			{
+				printf("[ERROR] 점수 파일의 레코드가 너무 많음. (fileName:%s, max records:%zu)\n", fileName, capacity);
+				result = FAIL;
+				break;
+			}
+
+			int score = 0;
+			if(recordParseScore(gradeManager, line, lineLength, &score) == FAIL) score = RECORD_INVALID_SCORE;
+			result = recordScoreArraySet(scores, count++, score);
+		}
+		scores->num = count;
+	}
+
+	if(data != NULL) munmap(data, size);
+	if(result == FAIL) recordScoreArrayFinal(scores);
+	return result;
+}
+
+/**
+ * @fn void recordScoreArrayFinal(scoreArray_t *scores)
+ * @brief 점수 배열과 범위 밖 점수 목록을 해제하고 구조체를 비우는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param scores 해제할 scoreArray_t 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+void recordScoreArrayFinal(scoreArray_t *scores)
+{
+	if(scores == NULL)
+	{
+		printf("[DEBUG] scoreArray 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	hugeFree(scores->data);
+	free(scores->exceptionList);
+	memset(scores, 0, sizeof(scoreArray_t));
+}
+
+/**
+ * @fn int recordScoreArrayGet(const scoreArray_t *scores, int index)
+ * @brief 점수 배열에서 지정한 위치의 원래 점수를 꺼내는 함수
+ * 범위 밖 표시인 원소는 범위 밖 점수 목록에서 이진 탐색으로 원래 값을 찾는다.
+ * 결과 출력처럼 원소마다 호출되는 경로에서 사용되므로 전달받은 구조체 포인터와 위치를 검사하지 않는다.
+ * @param scores 점수 배열(입력, 읽기 전용)
+ * @param index 꺼낼 점수의 위치(입력, 0 ~ num - 1)
+ * @return 원래 점수 (scale 배 한 정수) 반환
+ */
+int recordScoreArrayGet(const scoreArray_t *scores, int index)
+{
+	int value = 0;
+	int invalid = 0;
+
+	switch(scores->width)
+	{
+		case SCORE_WIDTH_8:
+			value = ((const uint8_t*)scores->data)[index];
+			invalid = GRADE_NARROW8_INVALID;
+			break;
+		case SCORE_WIDTH_16:
+			value = ((const uint16_t*)scores->data)[index];
+			invalid = GRADE_NARROW16_INVALID;
+			break;
+		default:
+			return ((const int*)scores->data)[index];
+	}
+
+	if(value != invalid) return scores->base + value;
+
+	int low = 0;
+	int high = scores->exceptionNum - 1;
+	while(low <= high)
+	{
+		int middle = low + (high - low) / 2;
+		if(scores->exceptionList[middle].index == index) return scores->exceptionList[middle].score;
+		if(scores->exceptionList[middle].index < index) low = middle + 1;
+		else high = middle - 1;
+	}
+
+	return scores->base + value;
+}
+
+/**
+ * @fn void recordScoreArrayClassify(const gradeManager_t *gradeManager, const scoreArray_t *scores, int start, int num, char *grades)
+ * @brief 점수 배열의 일부 구간에 대한 등급을 원소 크기에 맞는 판단 함수로 판단하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param scores 점수 배열(입력, 읽기 전용)
+ * @param start 판단을 시작할 위치(입력)
+ * @param num 판단할 점수 개수(입력)
+ * @param grades 판단된 등급 문자를 저장할 배열(출력, num 크기)
+ * @return 반환값 없음
+ */
+void recordScoreArrayClassify(const gradeManager_t *gradeManager, const scoreArray_t *scores, int start, int num, char *grades)
+{
+	if(gradeManager == NULL || scores == NULL || grades == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, scores:%p, grades:%p)\n", (const void*)gradeManager, (const void*)scores, (void*)grades);
+		return;
+	}
+
+	switch(scores->width)
+	{
+		case SCORE_WIDTH_8:
+			gradeManagerClassifyScores8(gradeManager, (const uint8_t*)scores->data + start, grades, num);
+			break;
+		case SCORE_WIDTH_16:
+			gradeManagerClassifyScores16(gradeManager, (const uint16_t*)scores->data + start, grades, num);
+			break;
+		default:
+			gradeManagerClassifyScores(gradeManager, (const int*)scores->data + start, grades, num);
+			break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for scoreArray_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int recordScoreArrayReserve(scoreArray_t *scores, size_t capacity)
+ * @brief 점수 배열의 데이터를 원소 크기에 맞춰 할당하는 함수
+ * recordLoadScoreArray 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param scores 점수 배열(입력 및 출력, width 가 정해져 있어야 함)
+ * @param capacity 담을 수 있는 점수 개수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int recordScoreArrayReserve(scoreArray_t *scores, size_t capacity)
+{
+	scores->data = hugeAlloc((size_t)scores->width * (capacity + 1));
+	if(scores->data == NULL)
+	{
+		printf("[DEBUG] 점수 배열 동적 생성 실패. NULL. (capacity:%zu, width:%d)\n", capacity, scores->width);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int recordScoreArraySet(scoreArray_t *scores, int index, int score)
+ * @brief 원래 점수를 점수 배열의 원소 크기로 좁혀서 저장하는 함수
+ * 등급 전체 범위를 벗어난 점수는 좁히기 전에 범위 밖 표시로 바꾸고 원래 값을 범위 밖 점수 목록에 덧붙인다.
+ * index 는 호출할 때마다 커져야 범위 밖 점수 목록이 정렬된 상태로 유지된다.
+ * recordLoadScoreArray 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param scores 점수 배열(입력 및 출력)
+ * @param index 저장할 위치(입력)
+ * @param score 원래 점수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int recordScoreArraySet(scoreArray_t *scores, int index, int score)
+{
+	if(scores->width == SCORE_WIDTH_32)
+	{
+		((int*)scores->data)[index] = score;
+		return SUCCESS;
+	}
+
+	long long value = (long long)score - scores->base;
+	int inRange = (value >= 0 && value <= scores->range) ? TRUE : FALSE;
+
+	if(scores->width == SCORE_WIDTH_8) ((uint8_t*)scores->data)[index] = (inRange == TRUE) ? (uint8_t)value : GRADE_NARROW8_INVALID;
+	else ((uint16_t*)scores->data)[index] = (inRange == TRUE) ? (uint16_t)value : GRADE_NARROW16_INVALID;
+	if(inRange == TRUE) return SUCCESS;
+
+	if(scores->exceptionNum == scores->exceptionCapacity)
+	{
+		int newCapacity = (scores->exceptionCapacity == 0) ? RECORD_EXCEPTION_INIT_NUM : scores->exceptionCapacity * 2;
+		scoreException_t *newList = (scoreException_t*)realloc(scores->exceptionList, sizeof(scoreException_t) * (size_t)newCapacity);
+		if(newList == NULL)
+		{
+			printf("[DEBUG] 범위 밖 점수 목록 동적 생성 실패. NULL. (capacity:%d)\n", newCapacity);
+			return FAIL;
+		}
+		scores->exceptionList = newList;
+		scores->exceptionCapacity = newCapacity;
+	}
+
+	scores->exceptionList[scores->exceptionNum].index = index;
+	scores->exceptionList[scores->exceptionNum].score = score;
+	scores->exceptionNum++;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int recordLoadBinaryScores(const char *fileName, const char *data, size_t size, int scale, scoreArray_t *scores)
+ * @brief 매핑된 이진 점수 파일의 헤더를 검증하고 점수를 점수 배열의 원소 크기로 읽는 함수
+ * recordLoadScoreArray 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param fileName 점수 파일 이름(입력, 읽기 전용, 오류 메시지용)
+ * @param data 매핑된 파일 내용(입력, 읽기 전용)
+ * @param size 파일 크기(입력)
+ * @param scale 등급 정보의 고정 소수점 배율(입력)
+ * @param scores 점수 배열(입력 및 출력, width 와 범위가 정해져 있어야 함)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int recordLoadBinaryScores(const char *fileName, const char *data, size_t size, int scale, scoreArray_t *scores)
+{
+	recordBinaryHeader_t header;
+	memcpy(&header, data, sizeof(header));
+
+	if(header.version != RECORD_BINARY_VERSION || header.scale != scale)
+	{
+		printf("[ERROR] 이진 점수 파일의 버전 또는 배율이 다름. (fileName:%s, version:%u, scale:%d, expected scale:%d)\n",
+			fileName, header.version, header.scale, scale);
+		return FAIL;
+	}
+
+	if(header.recordNum > (uint64_t)INT_MAX || size != sizeof(header) + header.recordNum * sizeof(int32_t))
+	{
+		printf("[ERROR] 이진 점수 파일 크기가 헤더와 맞지 않거나 너무 큼. (fileName:%s, size:%zu, records:%llu)\n",
+			fileName, size, (unsigned long long)header.recordNum);
+		return FAIL;
+	}
+
+	int recordNum = (int)header.recordNum;
+	if(recordScoreArrayReserve(scores, (size_t)recordNum) == FAIL) return FAIL;
+
+	const char *source = data + sizeof(header);
+	if(scores->width == SCORE_WIDTH_32)
+	{
+		memcpy(scores->data, source, (size_t)recordNum * sizeof(int32_t));
+		scores->num = recordNum;
+		return SUCCESS;
+	}
+
+	int recordPos = 0;
+	for( ; recordPos < recordNum; recordPos++)
+	{
+		int32_t score;
+		memcpy(&score, source + (size_t)recordPos * sizeof(int32_t), sizeof(score));
+		if(recordScoreArraySet(scores, recordPos, score) == FAIL) return FAIL;
+	}
+
+	scores->num = recordNum;
+	return SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int isBlank(char c)
+ * @brief 지정한 문자가 레코드 필드 구분 문자(공백, 탭, 캐리지 리턴)인지 검사하는 함수
+ * @param c 검사할 문자(입력)
+ * @return 구분 문자면 TRUE, 아니면 FALSE 반환
+ */
+static int isBlank(char c)
+{
+	return (c == ' ' || c == '\t' || c == '\r') ? TRUE : FALSE;
+}
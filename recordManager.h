@@ -0,0 +1,132 @@
+#ifndef __RECORD_MANAGER_H__
+#define __RECORD_MANAGER_H__
+
+#include <stdint.h>
+#include <limits.h>
+
+#include "gradeManager.h"
+#include "hugeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 출력 버퍼의 초기 크기 (바이트)
+#define RECORD_BUFFER_INIT_SIZE	(64 * 1024)
+// 이진 점수 파일 식별 문자열
+#define RECORD_BINARY_MAGIC		"GRSC"
+// 이진 점수 파일 형식 버전
+#define RECORD_BINARY_VERSION	1
+// 범위 밖 점수 목록의 초기 크기 (항목 개수)
+#define RECORD_EXCEPTION_INIT_NUM	64
+// 점수를 읽을 수 없는 줄 대신 점수 배열에 넣는 값 (ini 범위값은 음수가 될 수 없으므로 항상 전체 범위 밖이라 '?' 로 판단된다)
+#define RECORD_INVALID_SCORE	INT_MIN
+
+/**
+ * @struct recordBinaryHeader_t
+ * @brief 이진 점수 파일 앞에 놓이는 고정 크기 헤더 구조체
+ * <파일 구성>
+ * (recordBinaryHeader_t) (int32_t 점수 recordNum 개, scale 배 한 정수, 호스트 바이트 순서)
+ * 텍스트를 분석하지 않고 점수를 바로 읽기 때문에 등급 판단 자체의 성능을 측정할 때 사용한다.
+ */
+typedef struct recordBinaryHeader_s recordBinaryHeader_t;
+struct recordBinaryHeader_s
+{
+	// 식별 문자열 (RECORD_BINARY_MAGIC)
+	char magic[4];
+	// 형식 버전 (RECORD_BINARY_VERSION)
+	uint32_t version;
+	// 점수의 고정 소수점 배율 (읽을 때 grade.ini 의 배율과 같아야 한다)
+	int32_t scale;
+	// 예약 (0)
+	uint32_t reserved;
+	// 점수 개수
+	uint64_t recordNum;
+};
+
+/**
+ * @struct recordBuffer_t
+ * @brief 등급 판단 결과 레코드를 모아두는 가변 길이 출력 버퍼 구조체
+ * <레코드 형식>
+ * 입력 : (필드 ...) (점수) -> 공백으로 구분된 마지막 토큰이 점수
+ * 출력 : (입력 레코드) (등급) -> 입력 레코드 뒤에 공백과 등급 문자를 붙인다.
+ * 데이터는 hugeAlloc 으로 할당하므로 커진 버퍼는 큰 페이지로 채워진다.
+ */
+typedef struct recordBuffer_s recordBuffer_t;
+struct recordBuffer_s
+{
+	// 버퍼 데이터
+	char *data;
+	// 버퍼에 저장된 데이터 길이
+	size_t length;
+	// 버퍼에 할당된 전체 크기
+	size_t capacity;
+};
+
+/**
+ * @struct scoreException_t
+ * @brief 좁은 점수 배열에 담을 수 없어 범위 밖 표시로 바꾼 원래 점수를 기억하는 구조체
+ */
+typedef struct scoreException_s scoreException_t;
+struct scoreException_s
+{
+	// 점수 배열에서의 위치
+	int index;
+	// 원래 점수 (scale 배 한 정수)
+	int score;
+};
+
+/**
+ * @struct scoreArray_t
+ * @brief 등급 전체 범위에 맞춰 원소 크기를 고른 점수 배열 구조체
+ * 원소 크기가 1 또는 2 바이트이면 점수에서 전체 최소값(base)을 뺀 값을 저장하고,
+ * 전체 범위를 벗어난 점수는 좁히기 전에 GRADE_NARROW8_INVALID / GRADE_NARROW16_INVALID 로 표시한 뒤 원래 값을 exceptionList 에 남긴다.
+ * 원소 크기가 4 바이트이면 원래 점수를 그대로 저장한다. 데이터는 hugeAlloc 으로 할당한다.
+ */
+typedef struct scoreArray_s scoreArray_t;
+struct scoreArray_s
+{
+	// 점수 배열 (width 바이트 원소 num 개)
+	void *data;
+	// 원소 크기 (SCORE_WIDTH_8, SCORE_WIDTH_16, SCORE_WIDTH_32)
+	int width;
+	// 점수 개수
+	int num;
+	// 좁은 배열의 기준값 (등급 전체 범위의 최소값)
+	int base;
+	// 좁은 배열의 최대 상대값 (등급 전체 범위의 최대값 - 최소값)
+	int range;
+	// 범위 밖 표시로 바꾼 원래 점수 목록 (index 오름차순)
+	scoreException_t *exceptionList;
+	// 범위 밖 점수 개수
+	int exceptionNum;
+	// 범위 밖 점수 목록에 할당된 항목 개수
+	int exceptionCapacity;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for recordBuffer_t
+//////////////////////////////////////////////////////////////////////////
+
+int recordBufferInit(recordBuffer_t *buffer, size_t capacity);
+void recordBufferFinal(recordBuffer_t *buffer);
+int recordBufferAppend(recordBuffer_t *buffer, const char *data, size_t length);
+int recordBufferWriteAll(int fd, const char *data, size_t length);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for Record
+//////////////////////////////////////////////////////////////////////////
+
+int recordParseScore(const gradeManager_t *gradeManager, const char *line, size_t length, int *score);
+int recordGradeBlock(const gradeManager_t *gradeManager, const char *data, size_t length, recordBuffer_t *output, gradeStats_t *stats);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for scoreArray_t
+//////////////////////////////////////////////////////////////////////////
+
+int recordLoadScoreArray(const gradeManager_t *gradeManager, const char *fileName, int width, scoreArray_t *scores);
+void recordScoreArrayFinal(scoreArray_t *scores);
+int recordScoreArrayGet(const scoreArray_t *scores, int index);
+void recordScoreArrayClassify(const gradeManager_t *gradeManager, const scoreArray_t *scores, int start, int num, char *grades);
+
+#endif // #ifndef __RECORD_MANAGER_H__
@@ -0,0 +1,339 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "sampleManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for sampleManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static uint64_t sampleManagerNextRandom(sampleManager_t *sampleManager);
+static void sampleManagerDrawOne(sampleManager_t *sampleManager);
+static int sampleManagerCountExact(const sampleManager_t *sampleManager, sampleEstimate_t *estimate);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for sampleManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn sampleManager_t* sampleManagerNew(const gradeManager_t *gradeManager, const char *fileName, uint64_t seed)
+ * @brief 점수 파일을 임의 접근용으로 매핑하고 표본 추출 상태를 초기화하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param fileName 점수 파일 이름(입력, 읽기 전용)
+ * @param seed 난수 시드(입력, 같은 시드면 같은 표본을 뽑는다)
+ * @return 성공 시 새로 생성된 sampleManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+sampleManager_t* sampleManagerNew(const gradeManager_t *gradeManager, const char *fileName, uint64_t seed)
+{
+	if(gradeManager == NULL || fileName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, fileName:%p)\n", (const void*)gradeManager, (const void*)fileName);
+		return NULL;
+	}
+
+	int fd = open(fileName, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 점수 파일 열기 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		return NULL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1 || fileStat.st_size == 0)
+	{
+		printf("[ERROR] 점수 파일이 비어있거나 정보를 읽을 수 없음. (fileName:%s, errno:%d)\n", fileName, errno);
+		close(fd);
+		return NULL;
+	}
+
+	void *mapped = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(mapped == MAP_FAILED)
+	{
+		printf("[ERROR] 점수 파일 매핑 실패. (fileName:%s, errno:%d)\n", fileName, errno);
+		return NULL;
+	}
+	// 표본 위치만 읽으므로 미리 읽기(readahead)를 끈다.
+	madvise(mapped, (size_t)fileStat.st_size, MADV_RANDOM);
+
+	sampleManager_t *sampleManager = (sampleManager_t*)calloc(1, sizeof(sampleManager_t));
+	if(sampleManager == NULL)
+	{
+		printf("[DEBUG] sampleManager 객체 동적 생성 실패. NULL.\n");
+		munmap(mapped, (size_t)fileStat.st_size);
+		return NULL;
+	}
+
+	sampleManager->gradeManager = gradeManager;
+	sampleManager->data = (char*)mapped;
+	sampleManager->size = (size_t)fileStat.st_size;
+	sampleManager->randomState = seed;
+
+	return sampleManager;
+}
+
+/**
+ * @fn void sampleManagerDelete(sampleManager_t **sampleManager)
+ * @brief 생성된 sampleManager_t 구조체 객체의 매핑과 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param sampleManager 삭제할 sampleManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void sampleManagerDelete(sampleManager_t **sampleManager)
+{
+	if(sampleManager == NULL || *sampleManager == NULL)
+	{
+		printf("[DEBUG] sampleManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	munmap((*sampleManager)->data, (*sampleManager)->size);
+	free(*sampleManager);
+	*sampleManager = NULL;
+}
+
+/**
+ * @fn int sampleManagerDraw(sampleManager_t *sampleManager, long long drawNum)
+ * @brief 뽑은 위치 개수가 drawNum 이 될 때까지 표본을 더 뽑는 함수 (이전 표본은 그대로 누적된다)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param sampleManager 표본 추출 상태를 관리하는 구조체(입력 및 출력)
+ * @param drawNum 누적 표본 위치 개수 목표(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int sampleManagerDraw(sampleManager_t *sampleManager, long long drawNum)
+{
+	if(sampleManager == NULL)
+	{
+		printf("[DEBUG] sampleManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	while(sampleManager->drawNum < drawNum)
+	{
+		sampleManagerDrawOne(sampleManager);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int sampleManagerEstimate(const sampleManager_t *sampleManager, sampleEstimate_t *estimate)
+ * @brief 지금까지 뽑은 표본으로 등급별 비율과 95% 신뢰 구간을 계산하는 함수
+ * 비율은 가중 비율 추정량 p = sum(w * y) / sum(w) 이고, 분산은 선형 근사 sum(w^2 * (y - p)^2) / sum(w)^2 를 사용한다.
+ * 한 번도 관측되지 않은 등급(또는 모두 같은 등급)은 분산이 0 이 되므로 반폭을 3 / n 으로 둔다. (3 의 규칙)
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param sampleManager 표본 추출 상태를 관리하는 구조체(입력, 읽기 전용)
+ * @param estimate 추정 결과(출력)
+ * @return 성공 시 SUCCESS, 표본이 없으면 FAIL 반환
+ */
+int sampleManagerEstimate(const sampleManager_t *sampleManager, sampleEstimate_t *estimate)
+{
+	if(sampleManager == NULL || estimate == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (sampleManager:%p, estimate:%p)\n", (const void*)sampleManager, (void*)estimate);
+		return FAIL;
+	}
+
+	memset(estimate, 0, sizeof(sampleEstimate_t));
+	estimate->drawNum = sampleManager->drawNum;
+	estimate->sampleNum = sampleManager->sampleNum;
+	if(sampleManager->sampleNum == 0 || sampleManager->weightSum <= 0) return FAIL;
+
+	double weightSum = sampleManager->weightSum;
+	double minHalfWidth = 3.0 / (double)sampleManager->sampleNum;
+
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		double proportion = sampleManager->gradeWeightSum[gradeIndex] / weightSum;
+		// sum(w^2 * (y - p)^2) = (1 - 2p) * sum(w^2 * y) + p^2 * sum(w^2)   (y 는 0 또는 1)
+		double variance = ((1.0 - 2.0 * proportion) * sampleManager->gradeWeightSquareSum[gradeIndex]
+			+ proportion * proportion * sampleManager->weightSquareSum) / (weightSum * weightSum);
+		double halfWidth = SAMPLE_Z_95 * sqrt((variance > 0) ? variance : 0);
+		if(halfWidth < minHalfWidth && (proportion <= 0 || proportion >= 1)) halfWidth = minHalfWidth;
+
+		estimate->proportion[gradeIndex] = proportion;
+		estimate->halfWidth[gradeIndex] = halfWidth;
+		if(halfWidth > estimate->maxHalfWidth) estimate->maxHalfWidth = halfWidth;
+	}
+
+	// E[w] = (레코드 개수) / (파일 크기) 이므로 가중치 평균에 파일 크기를 곱하면 레코드 개수가 된다.
+	estimate->recordNum = weightSum / (double)sampleManager->drawNum * (double)sampleManager->size;
+	return SUCCESS;
+}
+
+/**
+ * @fn int sampleManagerRun(sampleManager_t *sampleManager, double errorTarget, sampleEstimate_t *estimate)
+ * @brief 표본을 단계마다 두 배로 늘리며 모든 등급의 신뢰 구간 반폭이 목표 이하가 될 때까지 추정을 반복하는 함수
+ * 다음 단계의 표본 개수가 추정한 전체 레코드 개수를 넘으면 전체를 읽어 정확히 계산하는 편이 빠르므로 정확한 값을 반환한다.
+ * 단계마다 중간 추정을 출력한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param sampleManager 표본 추출 상태를 관리하는 구조체(입력 및 출력)
+ * @param errorTarget 신뢰 구간 반폭 목표(입력, 0 ~ 1 비율)
+ * @param estimate 최종 추정 결과(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int sampleManagerRun(sampleManager_t *sampleManager, double errorTarget, sampleEstimate_t *estimate)
+{
+	if(sampleManager == NULL || estimate == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (sampleManager:%p, estimate:%p)\n", (void*)sampleManager, (void*)estimate);
+		return FAIL;
+	}
+
+	if(errorTarget <= 0 || errorTarget >= 1)
+	{
+		printf("[ERROR] 잘못된 오차 목표. 0 보다 크고 100 %%p 보다 작아야 함. (target:%f%%p)\n", errorTarget * 100.0);
+		return FAIL;
+	}
+
+	long long drawNum = SAMPLE_INIT_NUM;
+	int round = 1;
+	while(1)
+	{
+		sampleManagerDraw(sampleManager, drawNum);
+		int result = sampleManagerEstimate(sampleManager, estimate);
+
+		if(result == SUCCESS)
+		{
+			printf("[근사 %d] (samples:%lld, records:~%.0f, maxError:%.3f%%p)\n", round, estimate->sampleNum, estimate->recordNum, estimate->maxHalfWidth * 100.0);
+			if(estimate->maxHalfWidth <= errorTarget) return SUCCESS;
+		}
+
+		// 표본이 전체보다 많아지면 (또는 레코드가 거의 없으면) 전체를 읽는다.
+		if(result == FAIL || (double)(drawNum * 2) >= estimate->recordNum)
+		{
+			return sampleManagerCountExact(sampleManager, estimate);
+		}
+
+		if(drawNum * 2 > SAMPLE_MAX_NUM)
+		{
+			printf("[ERROR] 최대 표본 개수 안에서 오차 목표를 만족하지 못함. 마지막 추정을 사용. (max:%lld, target:%.3f%%p)\n",
+				SAMPLE_MAX_NUM, errorTarget * 100.0);
+			return SUCCESS;
+		}
+
+		drawNum *= 2;
+		round++;
+	}
+}
+
+/**
+ * @fn void sampleEstimatePrint(FILE *filePtr, const sampleEstimate_t *estimate)
+ * @brief 추정 결과를 등급별 비율, 신뢰 구간, 추정 개수로 출력하는 함수
+ * @param filePtr 출력할 파일 포인터(입력)
+ * @param estimate 추정 결과(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void sampleEstimatePrint(FILE *filePtr, const sampleEstimate_t *estimate)
+{
+	if(filePtr == NULL || estimate == NULL) return;
+
+	fprintf(filePtr, "[%s] records=%.0f samples=%lld\n", (estimate->exact == TRUE) ? "정확" : "근사, 95% 신뢰 구간", estimate->recordNum, estimate->sampleNum);
+
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM; gradeIndex++)
+	{
+		fprintf(filePtr, "%c : %6.2f%% +- %.2f%%p (~%.0f)\n", gradeManagerGetGradeFromIndex(gradeIndex), estimate->proportion[gradeIndex] * 100.0,
+			estimate->halfWidth[gradeIndex] * 100.0, estimate->proportion[gradeIndex] * estimate->recordNum);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for sampleManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static uint64_t sampleManagerNextRandom(sampleManager_t *sampleManager)
+ * @brief splitmix64 로 다음 64 비트 난수를 만드는 함수
+ * @param sampleManager 난수 상태를 가진 구조체(입력 및 출력)
+ * @return 64 비트 난수 반환
+ */
+static uint64_t sampleManagerNextRandom(sampleManager_t *sampleManager)
+{
+	uint64_t value = (sampleManager->randomState += 0x9E3779B97F4A7C15ULL);
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+/**
+ * @fn static void sampleManagerDrawOne(sampleManager_t *sampleManager)
+ * @brief 파일 안의 임의 바이트 위치를 하나 골라 그 위치가 속한 레코드를 표본에 더하는 함수
+ * 개행 문자는 그 문자로 끝나는 레코드에 속하므로 모든 바이트는 정확히 한 레코드에 속하고,
+ * 레코드가 뽑힐 확률은 (개행 문자를 포함한 길이) / (파일 크기) 이다. 가중치는 그 역수에 비례하는 1 / 길이 를 사용한다.
+ * 빈 줄이 뽑히면 위치 개수만 늘리고 표본에는 더하지 않는다.
+ * sampleManagerDraw 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param sampleManager 표본 추출 상태를 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void sampleManagerDrawOne(sampleManager_t *sampleManager)
+{
+	const char *data = sampleManager->data;
+	size_t size = sampleManager->size;
+	// 나머지 연산 대신 128 비트 곱셈으로 [0, size) 범위에 고르게 대응시킨다.
+	size_t offset = (size_t)(((unsigned __int128)sampleManagerNextRandom(sampleManager) * size) >> 64);
+
+	size_t start = offset;
+	while(start > 0 && data[start - 1] != '\n') start--;
+	size_t end = offset;
+	while(end < size && data[end] != '\n') end++;
+	size_t recordLength = ((end < size) ? end + 1 : end) - start;
+
+	sampleManager->drawNum++;
+
+	size_t textLength = end - start;
+	while(textLength > 0 && (data[start + textLength - 1] == ' ' || data[start + textLength - 1] == '\t' || data[start + textLength - 1] == '\r')) textLength--;
+	if(textLength == 0) return;
+
+	int score = 0;
+	char grade = '?';
+	if(recordParseScore(sampleManager->gradeManager, data + start, textLength, &score) == SUCCESS)
+	{
+		grade = gradeManagerClassifyScore(sampleManager->gradeManager, score);
+	}
+
+	int gradeIndex = gradeManagerGetGradeIndex(grade);
+	double weight = 1.0 / (double)recordLength;
+	sampleManager->sampleNum++;
+	sampleManager->weightSum += weight;
+	sampleManager->weightSquareSum += weight * weight;
+	sampleManager->gradeWeightSum[gradeIndex] += weight;
+	sampleManager->gradeWeightSquareSum[gradeIndex] += weight * weight;
+}
+
+/**
+ * @fn static int sampleManagerCountExact(const sampleManager_t *sampleManager, sampleEstimate_t *estimate)
+ * @brief 파일 전체의 등급을 판단해서 정확한 분포를 계산하는 함수 (표본이 전체보다 커지는 작은 파일용)
+ * sampleManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param sampleManager 표본 추출 상태를 관리하는 구조체(입력, 읽기 전용)
+ * @param estimate 정확한 분포(출력, 신뢰 구간 반폭은 0)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int sampleManagerCountExact(const sampleManager_t *sampleManager, sampleEstimate_t *estimate)
+{
+	gradeStats_t stats;
+	gradeStatsInit(&stats);
+	madvise(sampleManager->data, sampleManager->size, MADV_SEQUENTIAL);
+	if(recordGradeBlock(sampleManager->gradeManager, sampleManager->data, sampleManager->size, NULL, &stats) == FAIL) return FAIL;
+
+	memset(estimate, 0, sizeof(sampleEstimate_t));
+	estimate->exact = TRUE;
+	estimate->recordNum = (double)stats.total;
+	estimate->sampleNum = stats.total;
+	estimate->drawNum = stats.total;
+
+	int gradeIndex = 0;
+	for( ; gradeIndex < GRADE_KIND_NUM && stats.total > 0; gradeIndex++)
+	{
+		estimate->proportion[gradeIndex] = (double)stats.count[gradeIndex] / (double)stats.total;
+	}
+
+	printf("[정확] 표본이 전체 레코드보다 많아 전체를 읽음. (records:%lld)\n", stats.total);
+	return SUCCESS;
+}
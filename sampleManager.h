@@ -0,0 +1,87 @@
+#ifndef __SAMPLE_MANAGER_H__
+#define __SAMPLE_MANAGER_H__
+
+#include <stdint.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 첫 단계의 표본 위치 개수 (단계마다 두 배로 늘린다)
+#define SAMPLE_INIT_NUM		1024
+// 표본 위치 최대 개수 (오차 목표를 이 안에서 만족하지 못하면 마지막 추정을 반환한다)
+#define SAMPLE_MAX_NUM		(16LL * 1024 * 1024)
+// 기본 오차 목표 (비율의 신뢰 구간 반폭, %p)
+#define SAMPLE_DEFAULT_ERROR	1.0
+// 95% 신뢰 수준의 정규 분포 임계값
+#define SAMPLE_Z_95			1.959964
+
+/**
+ * @struct sampleEstimate_t
+ * @brief 표본으로 추정한 등급별 비율과 신뢰 구간을 저장하는 구조체
+ */
+typedef struct sampleEstimate_s sampleEstimate_t;
+struct sampleEstimate_s
+{
+	// 등급별 비율 추정값 (0 ~ 1, gradeManagerGetGradeIndex 의 인덱스 순서)
+	double proportion[GRADE_KIND_NUM];
+	// 등급별 95% 신뢰 구간 반폭 (0 ~ 1)
+	double halfWidth[GRADE_KIND_NUM];
+	// 등급별 반폭 중 최대값
+	double maxHalfWidth;
+	// 전체 레코드 개수 추정값
+	double recordNum;
+	// 표본 위치 개수
+	long long drawNum;
+	// 표본 중 레코드 개수 (빈 줄 제외)
+	long long sampleNum;
+	// 전체를 읽어 정확히 계산했는지 여부 (TRUE 또는 FALSE)
+	int exact;
+};
+
+/**
+ * @struct sampleManager_t
+ * @brief 매핑된 점수 파일의 임의 위치를 뽑아 등급 분포를 근사하는 구조체
+ * 파일 안의 임의 바이트 위치를 고르고 그 위치가 속한 레코드를 표본으로 사용하므로 긴 레코드가 더 자주 뽑힌다.
+ * 이를 보정하기 위해 레코드마다 1 / (레코드 길이) 가중치를 주는 비율 추정량을 사용한다.
+ * 전체를 한 번도 읽지 않으므로 표본 개수에 비례하는 시간만 걸린다.
+ */
+typedef struct sampleManager_s sampleManager_t;
+struct sampleManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 매핑된 점수 파일
+	char *data;
+	// 점수 파일 크기
+	size_t size;
+	// 난수 상태 (splitmix64)
+	uint64_t randomState;
+	// 뽑은 위치 개수
+	long long drawNum;
+	// 뽑은 레코드 개수 (빈 줄 제외)
+	long long sampleNum;
+	// 가중치 합
+	double weightSum;
+	// 가중치 제곱의 합
+	double weightSquareSum;
+	// 등급별 가중치 합
+	double gradeWeightSum[GRADE_KIND_NUM];
+	// 등급별 가중치 제곱의 합
+	double gradeWeightSquareSum[GRADE_KIND_NUM];
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for sampleManager_t
+//////////////////////////////////////////////////////////////////////////
+
+sampleManager_t* sampleManagerNew(const gradeManager_t *gradeManager, const char *fileName, uint64_t seed);
+void sampleManagerDelete(sampleManager_t **sampleManager);
+int sampleManagerDraw(sampleManager_t *sampleManager, long long drawNum);
+int sampleManagerEstimate(const sampleManager_t *sampleManager, sampleEstimate_t *estimate);
+int sampleManagerRun(sampleManager_t *sampleManager, double errorTarget, sampleEstimate_t *estimate);
+void sampleEstimatePrint(FILE *filePtr, const sampleEstimate_t *estimate);
+
+#endif // #ifndef __SAMPLE_MANAGER_H__
@@ -0,0 +1,273 @@
+#include "schemeManager.h"
+#include "cacheManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for schemeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static int schemeManagerFindSlot(const schemeManager_t *schemeManager, const int *table, uint64_t hash);
+static int schemeManagerGrow(schemeManager_t *schemeManager);
+static void schemeManagerRemoveSlot(schemeManager_t *schemeManager, int slotIndex);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for schemeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn schemeManager_t* schemeManagerNew(void)
+ * @brief 등급 테이블 공유 목록을 관리하는 schemeManager_t 객체를 새로 생성하는 함수
+ * @return 성공 시 새로 생성된 schemeManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+schemeManager_t* schemeManagerNew(void)
+{
+	schemeManager_t *schemeManager = (schemeManager_t*)calloc(1, sizeof(schemeManager_t));
+	if(schemeManager == NULL)
+	{
+		printf("[DEBUG] schemeManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	schemeManager->slotList = (gradeScheme_t**)calloc(SCHEME_INIT_SLOT_NUM, sizeof(gradeScheme_t*));
+	if(schemeManager->slotList == NULL)
+	{
+		printf("[DEBUG] slotList 객체 동적 생성 실패. NULL.\n");
+		free(schemeManager);
+		return NULL;
+	}
+
+	schemeManager->slotNum = SCHEME_INIT_SLOT_NUM;
+	pthread_mutex_init(&(schemeManager->mutex), NULL);
+	return schemeManager;
+}
+
+/**
+ * @fn void schemeManagerDelete(schemeManager_t **schemeManager)
+ * @brief 생성된 schemeManager_t 구조체 객체와 남아있는 공유 등급 정보를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param schemeManager 삭제할 schemeManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void schemeManagerDelete(schemeManager_t **schemeManager)
+{
+	if(schemeManager == NULL || *schemeManager == NULL)
+	{
+		printf("[DEBUG] schemeManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	schemeManager_t *manager = *schemeManager;
+	int slotIndex = 0;
+	for( ; slotIndex < manager->slotNum; slotIndex++)
+	{
+		gradeScheme_t *scheme = manager->slotList[slotIndex];
+		if(scheme == NULL) continue;
+
+		gradeManagerDelete(&(scheme->gradeManager));
+		free(scheme);
+	}
+
+	pthread_mutex_destroy(&(manager->mutex));
+	free(manager->slotList);
+	free(manager);
+	*schemeManager = NULL;
+}
+
+/**
+ * @fn const gradeManager_t* schemeManagerIntern(schemeManager_t *schemeManager, gradeManager_t **gradeManager)
+ * @brief 검증된 등급 정보를 등록하고 같은 등급 테이블을 가진 공유 객체를 반환하는 함수
+ * 전달받은 객체의 소유권을 가져온다. 같은 테이블이 이미 있으면 전달받은 객체를 해제하고,
+ * 없으면 iniManager 를 해제한 뒤 공유 객체로 등록한다. 어느 경우든 *gradeManager 는 NULL 이 된다.
+ * 반환된 객체는 참조 개수가 1 늘어나므로 다 쓰면 schemeManagerRelease 를 호출해야 한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param schemeManager 등급 테이블 공유 목록(입력 및 출력)
+ * @param gradeManager 등록할 등급 정보(입력 및 출력, 이중 포인터)
+ * @return 성공 시 공유하는 등급 정보, 실패 시 NULL 반환 (실패해도 전달받은 객체는 해제한다)
+ */
+const gradeManager_t* schemeManagerIntern(schemeManager_t *schemeManager, gradeManager_t **gradeManager)
+{
+	if(schemeManager == NULL || gradeManager == NULL || *gradeManager == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (schemeManager:%p, gradeManager:%p)\n", (void*)schemeManager, (void*)gradeManager);
+		return NULL;
+	}
+
+	int table[GRADE_TABLE_LEN];
+	gradeManagerGetTable(*gradeManager, table);
+	uint64_t hash = cacheHash64(table, sizeof(table), 0);
+
+	const gradeManager_t *shared = NULL;
+	pthread_mutex_lock(&(schemeManager->mutex));
+	schemeManager->internNum++;
+
+	int slotIndex = schemeManagerFindSlot(schemeManager, table, hash);
+	gradeScheme_t *scheme = schemeManager->slotList[slotIndex];
+	if(scheme != NULL)
+	{
+		scheme->refCount++;
+		schemeManager->hitNum++;
+		shared = scheme->gradeManager;
+	}
+	else if((schemeManager->schemeNum + 1) * 2 <= schemeManager->slotNum || schemeManagerGrow(schemeManager) == SUCCESS)
+	{
+		scheme = (gradeScheme_t*)calloc(1, sizeof(gradeScheme_t));
+		if(scheme != NULL)
+		{
+			memcpy(scheme->table, table, sizeof(table));
+			scheme->hash = hash;
+			scheme->refCount = 1;
+			scheme->gradeManager = *gradeManager;
+			*gradeManager = NULL;
+
+			// 등급 테이블만 공유하므로 ini 파일 내용은 더 이상 필요하지 않다.
+			if(scheme->gradeManager->iniManager != NULL) iniManagerDelete(&(scheme->gradeManager->iniManager));
+
+			schemeManager->slotList[schemeManagerFindSlot(schemeManager, table, hash)] = scheme;
+			schemeManager->schemeNum++;
+			shared = scheme->gradeManager;
+		}
+		else
+		{
+			printf("[DEBUG] gradeScheme 객체 동적 생성 실패. NULL.\n");
+		}
+	}
+	pthread_mutex_unlock(&(schemeManager->mutex));
+
+	if(*gradeManager != NULL) gradeManagerDelete(gradeManager);
+	return shared;
+}
+
+/**
+ * @fn void schemeManagerRelease(schemeManager_t *schemeManager, const gradeManager_t *gradeManager)
+ * @brief 공유 등급 정보의 참조 개수를 줄이고, 0 이 되면 목록에서 지우고 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param schemeManager 등급 테이블 공유 목록(입력 및 출력)
+ * @param gradeManager schemeManagerIntern 이 반환한 등급 정보(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void schemeManagerRelease(schemeManager_t *schemeManager, const gradeManager_t *gradeManager)
+{
+	if(schemeManager == NULL || gradeManager == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (schemeManager:%p, gradeManager:%p)\n", (void*)schemeManager, (const void*)gradeManager);
+		return;
+	}
+
+	int table[GRADE_TABLE_LEN];
+	gradeManagerGetTable(gradeManager, table);
+	uint64_t hash = cacheHash64(table, sizeof(table), 0);
+
+	gradeScheme_t *removed = NULL;
+	pthread_mutex_lock(&(schemeManager->mutex));
+	int slotIndex = schemeManagerFindSlot(schemeManager, table, hash);
+	gradeScheme_t *scheme = schemeManager->slotList[slotIndex];
+	if(scheme == NULL || scheme->gradeManager != gradeManager)
+	{
+		printf("[ERROR] 등록되지 않은 등급 정보 해제 요청. (gradeManager:%p)\n", (const void*)gradeManager);
+	}
+	else if(--(scheme->refCount) == 0)
+	{
+		schemeManagerRemoveSlot(schemeManager, slotIndex);
+		removed = scheme;
+	}
+	pthread_mutex_unlock(&(schemeManager->mutex));
+
+	if(removed != NULL)
+	{
+		gradeManagerDelete(&(removed->gradeManager));
+		free(removed);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for schemeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int schemeManagerFindSlot(const schemeManager_t *schemeManager, const int *table, uint64_t hash)
+ * @brief 등급 테이블이 있는 자리 또는 등록할 빈 자리를 선형 탐사로 찾는 함수
+ * 해시 테이블은 항상 빈 자리가 있으므로 탐사는 반드시 끝난다.
+ * schemeManagerIntern, schemeManagerRelease 함수에서 잠금을 잡고 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param schemeManager 등급 테이블 공유 목록(입력, 읽기 전용)
+ * @param table 찾을 등급 테이블(입력, 읽기 전용)
+ * @param hash 등급 테이블 해시(입력)
+ * @return 같은 테이블이 있는 자리 또는 빈 자리의 인덱스 반환
+ */
+static int schemeManagerFindSlot(const schemeManager_t *schemeManager, const int *table, uint64_t hash)
+{
+	int mask = schemeManager->slotNum - 1;
+	int slotIndex = (int)(hash & (uint64_t)mask);
+
+	while(schemeManager->slotList[slotIndex] != NULL)
+	{
+		const gradeScheme_t *scheme = schemeManager->slotList[slotIndex];
+		if(scheme->hash == hash && memcmp(scheme->table, table, sizeof(scheme->table)) == 0) break;
+		slotIndex = (slotIndex + 1) & mask;
+	}
+
+	return slotIndex;
+}
+
+/**
+ * @fn static int schemeManagerGrow(schemeManager_t *schemeManager)
+ * @brief 해시 테이블 크기를 두 배로 늘리고 항목들을 다시 배치하는 함수
+ * schemeManagerIntern 함수에서 잠금을 잡고 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param schemeManager 등급 테이블 공유 목록(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int schemeManagerGrow(schemeManager_t *schemeManager)
+{
+	int oldSlotNum = schemeManager->slotNum;
+	gradeScheme_t **oldSlotList = schemeManager->slotList;
+	gradeScheme_t **newSlotList = (gradeScheme_t**)calloc((size_t)oldSlotNum * 2, sizeof(gradeScheme_t*));
+	if(newSlotList == NULL)
+	{
+		printf("[DEBUG] slotList 크기 확장 실패. NULL. (slotNum:%d)\n", oldSlotNum * 2);
+		return FAIL;
+	}
+
+	schemeManager->slotList = newSlotList;
+	schemeManager->slotNum = oldSlotNum * 2;
+
+	int slotIndex = 0;
+	for( ; slotIndex < oldSlotNum; slotIndex++)
+	{
+		gradeScheme_t *scheme = oldSlotList[slotIndex];
+		if(scheme != NULL) newSlotList[schemeManagerFindSlot(schemeManager, scheme->table, scheme->hash)] = scheme;
+	}
+
+	free(oldSlotList);
+	return SUCCESS;
+}
+
+/**
+ * @fn static void schemeManagerRemoveSlot(schemeManager_t *schemeManager, int slotIndex)
+ * @brief 해시 테이블에서 항목 하나를 지우고, 탐사 경로가 끊기지 않도록 뒤쪽 항목들을 당기는 함수
+ * schemeManagerRelease 함수에서 잠금을 잡고 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param schemeManager 등급 테이블 공유 목록(입력 및 출력)
+ * @param slotIndex 지울 항목의 인덱스(입력)
+ * @return 반환값 없음
+ */
+static void schemeManagerRemoveSlot(schemeManager_t *schemeManager, int slotIndex)
+{
+	int mask = schemeManager->slotNum - 1;
+	int emptyIndex = slotIndex;
+	int nextIndex = (slotIndex + 1) & mask;
+
+	schemeManager->slotList[emptyIndex] = NULL;
+	schemeManager->schemeNum--;
+
+	while(schemeManager->slotList[nextIndex] != NULL)
+	{
+		gradeScheme_t *scheme = schemeManager->slotList[nextIndex];
+		int homeIndex = (int)(scheme->hash & (uint64_t)mask);
+
+		// 원래 자리에서 지금 자리까지의 탐사 경로에 빈 자리가 들어있으면 빈 자리로 옮긴다.
+		if(((nextIndex - homeIndex) & mask) >= ((nextIndex - emptyIndex) & mask))
+		{
+			schemeManager->slotList[emptyIndex] = scheme;
+			schemeManager->slotList[nextIndex] = NULL;
+			emptyIndex = nextIndex;
+		}
+		nextIndex = (nextIndex + 1) & mask;
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef __SCHEME_MANAGER_H__
+#define __SCHEME_MANAGER_H__
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "gradeManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 해시 테이블 처음 크기 (2 의 거듭제곱, 항목이 절반을 넘으면 두 배로 늘린다)
+#define SCHEME_INIT_SLOT_NUM	64
+
+/**
+ * @struct gradeScheme_t
+ * @brief 같은 등급 테이블을 가진 과목들이 함께 사용하는 등급 정보 하나와 참조 개수를 저장하는 구조체
+ */
+typedef struct gradeScheme_s gradeScheme_t;
+struct gradeScheme_s
+{
+	// 정규화한 등급 테이블 (gradeManagerGetTable 순서)
+	int table[GRADE_TABLE_LEN];
+	// 등급 테이블 해시
+	uint64_t hash;
+	// 공유하는 등급 정보 (iniManager 를 해제한 읽기 전용 객체)
+	gradeManager_t *gradeManager;
+	// 참조 개수
+	int refCount;
+};
+
+/**
+ * @struct schemeManager_t
+ * @brief 검증된 등급 테이블을 정규화해서 같은 테이블이면 객체 하나를 공유하게 하는 구조체 (hash consing)
+ * 등급 테이블은 배율, 전체 범위, A ~ D 범위만으로 정하므로 ini 파일의 주석, 공백, 필드 순서가 달라도 같은 테이블이 된다.
+ * 해시 테이블은 선형 탐사(open addressing)를 사용하고, 참조 개수가 0 이 된 항목은 뒤쪽 항목을 당겨서 지운다.
+ * 여러 스레드가 동시에 등록하고 해제할 수 있도록 mutex 로 보호한다.
+ */
+typedef struct schemeManager_s schemeManager_t;
+struct schemeManager_s
+{
+	// 해시 테이블 (NULL 이면 빈 자리)
+	gradeScheme_t **slotList;
+	// 해시 테이블 크기 (2 의 거듭제곱)
+	int slotNum;
+	// 등록된 서로 다른 등급 테이블 개수
+	int schemeNum;
+	// 등록 요청 횟수
+	long long internNum;
+	// 이미 있는 등급 테이블을 공유한 횟수
+	long long hitNum;
+	// 해시 테이블 접근 동기화
+	pthread_mutex_t mutex;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for schemeManager_t
+//////////////////////////////////////////////////////////////////////////
+
+schemeManager_t* schemeManagerNew(void);
+void schemeManagerDelete(schemeManager_t **schemeManager);
+const gradeManager_t* schemeManagerIntern(schemeManager_t *schemeManager, gradeManager_t **gradeManager);
+void schemeManagerRelease(schemeManager_t *schemeManager, const gradeManager_t *gradeManager);
+
+#endif // #ifndef __SCHEME_MANAGER_H__
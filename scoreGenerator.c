@@ -0,0 +1,111 @@
+#include <math.h>
+#include <unistd.h>
+
+#include "workloadManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Macro
+//////////////////////////////////////////////////////////////////////////
+
+// 만들 수 있는 최대 레코드 개수
+#define SCORE_GEN_MAX_RECORD_NUM	1e12
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+static int scoreGeneratorGetThreadNum(void);
+
+//////////////////////////////////////////////////////////////////////////
+/// Main Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int main(int argc, char **argv)
+ * @brief ini 파일의 점수 범위와 등급 정보를 기준으로 성능 측정용 점수 파일을 생성하는 함수
+ * 사용법 : scoreGen (ini 파일) (출력 파일) (레코드 개수) [분포] [잡음 비율] [시드] [스레드 개수] [text|binary]
+ * 분포는 uniform(기본), normal, bimodal, skewed, mispredict 중 하나이고, 레코드 개수는 1e10 처럼 지수 표기도 받는다.
+ * 잡음 비율(기본 0)만큼 전체 범위를 벗어난 점수를 섞고, 시드(기본 1)가 같으면 스레드 개수와 관계없이 같은 파일을 만든다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 목록(입력)
+ * @return 성공 시 0, 실패 시 1 반환
+ */
+int main(int argc, char **argv)
+{
+	if(argc < 4)
+	{
+		printf("Usage: %s <grade.ini> <outFile> <count> [uniform|normal|bimodal|skewed|mispredict] [noiseRatio] [seed] [threads] [text|binary]\n", argv[0]);
+		return 1;
+	}
+
+	char *end = NULL;
+	double count = strtod(argv[3], &end);
+	if(*end != '\0' || count < 1 || count > SCORE_GEN_MAX_RECORD_NUM || count != floor(count))
+	{
+		printf("[ERROR] 잘못된 레코드 개수. (count:%s)\n", argv[3]);
+		return 1;
+	}
+
+	int distribution = (argc > 4) ? workloadGetDistribution(argv[4]) : WORKLOAD_UNIFORM;
+	if(distribution == FAIL)
+	{
+		printf("[ERROR] 알 수 없는 분포. (distribution:%s)\n", argv[4]);
+		return 1;
+	}
+
+	double noiseRatio = (argc > 5) ? atof(argv[5]) : 0.0;
+	uint64_t seed = (argc > 6) ? (uint64_t)strtoull(argv[6], NULL, 10) : 1;
+	int threadNum = (argc > 7) ? atoi(argv[7]) : scoreGeneratorGetThreadNum();
+
+	int format = WORKLOAD_TEXT;
+	if(argc > 8)
+	{
+		if(strcmp(argv[8], "binary") == 0) format = WORKLOAD_BINARY;
+		else if(strcmp(argv[8], "text") != 0)
+		{
+			printf("[ERROR] 알 수 없는 출력 형식. (format:%s)\n", argv[8]);
+			return 1;
+		}
+	}
+
+	gradeManager_t *gradeManager = gradeManagerNew(argv[1]);
+	if(gradeManager == NULL)
+	{
+		return 1;
+	}
+
+	int result = FAIL;
+	workloadManager_t *workloadManager = workloadManagerNew(gradeManager, argv[2], (long long)count, distribution, format);
+	if(workloadManager != NULL)
+	{
+		result = workloadManagerRun(workloadManager, noiseRatio, seed, threadNum);
+		workloadManagerDelete(&workloadManager);
+	}
+
+	gradeManagerDelete(&gradeManager);
+
+	if(result == FAIL)
+	{
+		printf("[ERROR] 점수 파일 생성 실패. (fileName:%s)\n", argv[2]);
+		return 1;
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int scoreGeneratorGetThreadNum(void)
+ * @brief 기본 작업 스레드 개수로 사용할 온라인 CPU 개수를 구하는 함수
+ * @return CPU 개수 반환 (1 ~ WORKLOAD_MAX_THREAD_NUM)
+ */
+static int scoreGeneratorGetThreadNum(void)
+{
+	long cpuNum = sysconf(_SC_NPROCESSORS_ONLN);
+	if(cpuNum < 1) return 1;
+	if(cpuNum > WORKLOAD_MAX_THREAD_NUM) return WORKLOAD_MAX_THREAD_NUM;
+	return (int)cpuNum;
+}
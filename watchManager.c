@@ -0,0 +1,895 @@
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "watchManager.h"
+#include "cacheManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 감시할 inotify 이벤트 (쓰기가 끝난 파일, 옮겨 온 파일, 지워지거나 옮겨 간 파일, 감시 디렉토리 삭제)
+#define WATCH_INOTIFY_MASK		(IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_DELETE_SELF | IN_ONLYDIR)
+// inotify 이벤트 읽기 버퍼 크기 (이름이 가장 긴 이벤트 64 개)
+#define WATCH_EVENT_BUFFER_SIZE	(64 * (sizeof(struct inotify_event) + NAME_MAX + 1))
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for watchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static int watchManagerOpenInotify(watchManager_t *watchManager);
+static int watchManagerRunInotify(watchManager_t *watchManager, long long maxFileNum);
+static int watchManagerRunPoll(watchManager_t *watchManager, long long maxFileNum);
+static int watchManagerReadEvents(watchManager_t *watchManager);
+static int watchManagerScanDir(watchManager_t *watchManager);
+static int watchManagerCheckFile(watchManager_t *watchManager, const char *fileName, int isNotified);
+static void watchManagerCheckSeen(watchManager_t *watchManager);
+static void watchManagerForgetFile(watchManager_t *watchManager, const char *fileName);
+static void watchManagerEnqueue(watchManager_t *watchManager, watchEntry_t *entry);
+static void watchManagerFlush(watchManager_t *watchManager);
+static int watchManagerGradeFile(watchManager_t *watchManager, watchEntry_t *entry, gradeStats_t *stats, double *lagSec);
+static void watchManagerPrune(watchManager_t *watchManager);
+static int watchManagerFindSlot(const watchManager_t *watchManager, const char *fileName, uint64_t hash);
+static int watchManagerGrow(watchManager_t *watchManager);
+static void watchManagerRemoveSlot(watchManager_t *watchManager, int slotIndex);
+static int watchManagerIsStopped(const watchManager_t *watchManager, long long maxFileNum);
+static double watchGetElapsedSec(const struct timespec *startTime, const struct timespec *endTime);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for watchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn const char* watchGetModeName(int mode)
+ * @brief 디렉토리 감시 방식의 이름을 반환하는 함수
+ * @param mode 감시 방식(입력, WATCH_MODE)
+ * @return 방식 이름 문자열 반환
+ */
+const char* watchGetModeName(int mode)
+{
+	return (mode == WATCH_POLL) ? "poll" : "inotify";
+}
+
+/**
+ * @fn watchManager_t* watchManagerNew(const gradeManager_t *gradeManager, const char *dirPath, const char *outputDir, int mode)
+ * @brief 점수 파일 디렉토리를 감시할 watchManager_t 객체를 새로 생성하는 함수
+ * inotify 방식을 요청했지만 초기화에 실패하면(감시 개수 한도, 지원하지 않는 파일 시스템 등) 폴링 방식으로 바꾼다.
+ * 출력 파일이 다시 입력으로 들어오지 않도록 감시 디렉토리와 출력 디렉토리가 같으면 실패한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param dirPath 감시할 디렉토리 경로(입력, 읽기 전용)
+ * @param outputDir 결과를 저장할 디렉토리 경로(입력, 읽기 전용, 없으면 생성)
+ * @param mode 감시 방식(입력, WATCH_MODE)
+ * @return 성공 시 새로 생성된 watchManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+watchManager_t* watchManagerNew(const gradeManager_t *gradeManager, const char *dirPath, const char *outputDir, int mode)
+{
+	if(gradeManager == NULL || dirPath == NULL || outputDir == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, dirPath:%p, outputDir:%p)\n", (const void*)gradeManager, (const void*)dirPath, (const void*)outputDir);
+		return NULL;
+	}
+
+	watchManager_t *watchManager = (watchManager_t*)calloc(1, sizeof(watchManager_t));
+	if(watchManager == NULL)
+	{
+		printf("[DEBUG] watchManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	watchManager->gradeManager = gradeManager;
+	watchManager->mode = mode;
+	watchManager->inotifyFd = -1;
+	gradeStatsInit(&(watchManager->stats));
+	snprintf(watchManager->dirPath, sizeof(watchManager->dirPath), "%s", dirPath);
+	snprintf(watchManager->outputDir, sizeof(watchManager->outputDir), "%s", outputDir);
+
+	watchManager->slotList = (watchEntry_t**)calloc(WATCH_INIT_SLOT_NUM, sizeof(watchEntry_t*));
+	if(watchManager->slotList == NULL)
+	{
+		printf("[DEBUG] slotList 객체 동적 생성 실패. NULL.\n");
+		watchManagerDelete(&watchManager);
+		return NULL;
+	}
+	watchManager->slotNum = WATCH_INIT_SLOT_NUM;
+
+	if(mkdir(outputDir, 0755) == -1 && errno != EEXIST)
+	{
+		printf("[ERROR] 출력 디렉토리 생성 실패. (outputDir:%s, errno:%d)\n", outputDir, errno);
+		watchManagerDelete(&watchManager);
+		return NULL;
+	}
+
+	struct stat dirStat, outputStat;
+	if(stat(dirPath, &dirStat) == -1 || S_ISDIR(dirStat.st_mode) == 0)
+	{
+		printf("[ERROR] 감시 디렉토리 접근 실패. (dirPath:%s, errno:%d)\n", dirPath, errno);
+		watchManagerDelete(&watchManager);
+		return NULL;
+	}
+
+	if(stat(outputDir, &outputStat) == 0 && dirStat.st_dev == outputStat.st_dev && dirStat.st_ino == outputStat.st_ino)
+	{
+		printf("[ERROR] 감시 디렉토리와 출력 디렉토리가 같음. (dirPath:%s, outputDir:%s)\n", dirPath, outputDir);
+		watchManagerDelete(&watchManager);
+		return NULL;
+	}
+
+	if(mode == WATCH_INOTIFY && watchManagerOpenInotify(watchManager) == FAIL)
+	{
+		printf("[감시] inotify 를 사용할 수 없어서 폴링 방식으로 바꿈. (interval:%dms)\n", WATCH_POLL_INTERVAL_MS);
+		watchManager->mode = WATCH_POLL;
+	}
+
+	return watchManager;
+}
+
+/**
+ * @fn void watchManagerDelete(watchManager_t **watchManager)
+ * @brief 생성된 watchManager_t 구조체 객체와 추적 중인 파일 목록을 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param watchManager 삭제할 watchManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void watchManagerDelete(watchManager_t **watchManager)
+{
+	if(watchManager == NULL || *watchManager == NULL)
+	{
+		printf("[DEBUG] watchManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	watchManager_t *manager = *watchManager;
+	if(manager->slotList != NULL)
+	{
+		int slotIndex = 0;
+		for( ; slotIndex < manager->slotNum; slotIndex++)
+		{
+			free(manager->slotList[slotIndex]);
+		}
+		free(manager->slotList);
+	}
+
+	if(manager->inotifyFd != -1) close(manager->inotifyFd);
+	recordBufferFinal(&(manager->output));
+
+	free(manager);
+	*watchManager = NULL;
+}
+
+/**
+ * @fn int watchManagerRun(watchManager_t *watchManager, long long maxFileNum)
+ * @brief 종료 요청이 오거나 지정한 개수의 파일을 처리할 때까지 디렉토리를 감시하면서 들어오는 점수 파일의 등급을 판단하는 함수
+ * 시작할 때 이미 있던 파일들도 처리하고, 종료할 때는 대기 중인 파일들을 마저 처리한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param maxFileNum 처리할 파일 개수(입력, 0 이하면 종료 요청이 올 때까지, 배치 단위로 확인하므로 조금 넘을 수 있음)
+ * @return 모든 파일 처리 성공 시 SUCCESS, 감시 오류가 나거나 하나라도 실패 시 FAIL 반환
+ */
+int watchManagerRun(watchManager_t *watchManager, long long maxFileNum)
+{
+	if(watchManager == NULL)
+	{
+		printf("[DEBUG] watchManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	printf("[감시 시작] (dir:%s, outDir:%s, mode:%s)\n", watchManager->dirPath, watchManager->outputDir, watchGetModeName(watchManager->mode));
+
+	int result = (watchManager->mode == WATCH_INOTIFY) ? watchManagerRunInotify(watchManager, maxFileNum) : watchManagerRunPoll(watchManager, maxFileNum);
+	watchManagerFlush(watchManager);
+
+	if(watchManager->failNum > 0) result = FAIL;
+	return result;
+}
+
+/**
+ * @fn void watchManagerRequestStop(watchManager_t *watchManager)
+ * @brief 감시를 끝내도록 요청하는 함수
+ * 시그널 처리기에서 호출할 수 있도록 플래그만 원자적으로 설정한다. 대기 중인 파일은 마저 처리한 뒤 watchManagerRun 이 반환한다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+void watchManagerRequestStop(watchManager_t *watchManager)
+{
+	if(watchManager == NULL) return;
+	__atomic_store_n(&(watchManager->stopRequested), TRUE, __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn void watchManagerPrintSummary(FILE *filePtr, const watchManager_t *watchManager)
+ * @brief 처리한 파일, 배치, 처리량, 지연 시간과 전체 등급 통계를 출력하는 함수
+ * 처리량은 파일 처리에 걸린 시간만으로 계산하므로 파일을 기다린 시간은 포함하지 않는다.
+ * 전체 등급 통계에는 다시 처리한 파일의 마지막 결과만 들어간다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param filePtr 출력할 파일 포인터(입력)
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void watchManagerPrintSummary(FILE *filePtr, const watchManager_t *watchManager)
+{
+	if(filePtr == NULL || watchManager == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (filePtr:%p, watchManager:%p)\n", (void*)filePtr, (const void*)watchManager);
+		return;
+	}
+
+	double busySec = (watchManager->busySec > 0.0) ? watchManager->busySec : 1e-9;
+	double lagAvgSec = (watchManager->gradeNum > 0) ? watchManager->lagSumSec / (double)watchManager->gradeNum : 0.0;
+
+	// 추적 중인 파일은 마지막으로 처리한 결과만 합친다.
+	gradeStats_t stats = watchManager->stats;
+	int slotIndex = 0;
+	for( ; slotIndex < watchManager->slotNum; slotIndex++)
+	{
+		const watchEntry_t *entry = watchManager->slotList[slotIndex];
+		if(entry != NULL) gradeStatsMerge(&stats, &(entry->stats));
+	}
+
+	fprintf(filePtr, "[감시 종료] (mode:%s, files:%lld, failed:%lld, batches:%lld, bytes:%lld, busy:%.3fs, throughput:%.0frec/s %.1fMB/s, lag avg:%.3fs max:%.3fs)\n",
+		watchGetModeName(watchManager->mode), watchManager->fileNum, watchManager->failNum, watchManager->batchNum, watchManager->byteNum, watchManager->busySec,
+		(double)watchManager->recordNum / busySec, (double)watchManager->byteNum / busySec / (1024.0 * 1024.0), lagAvgSec, watchManager->lagMaxSec);
+	fprintf(filePtr, "[전체 결과] ");
+	gradeStatsPrint(filePtr, &stats);
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for watchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int watchManagerOpenInotify(watchManager_t *watchManager)
+ * @brief inotify 인스턴스를 만들고 감시 디렉토리를 등록하는 함수
+ * watchManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int watchManagerOpenInotify(watchManager_t *watchManager)
+{
+	int inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(inotifyFd == -1)
+	{
+		printf("[ERROR] inotify 초기화 실패. (errno:%d)\n", errno);
+		return FAIL;
+	}
+
+	if(inotify_add_watch(inotifyFd, watchManager->dirPath, WATCH_INOTIFY_MASK) == -1)
+	{
+		printf("[ERROR] inotify 감시 등록 실패. (dirPath:%s, errno:%d)\n", watchManager->dirPath, errno);
+		close(inotifyFd);
+		return FAIL;
+	}
+
+	watchManager->inotifyFd = inotifyFd;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int watchManagerRunInotify(watchManager_t *watchManager, long long maxFileNum)
+ * @brief inotify 이벤트를 기다리면서 쓰기가 끝난 파일을 배치로 모아 처리하는 함수
+ * 감시를 등록한 뒤에 디렉토리를 한 번 읽으므로 시작 전후에 들어온 파일을 놓치지 않는다. (두 번 알려진 파일은 크기와 수정 시각으로 걸러낸다)
+ * 디렉토리를 읽어서 알림 없이 발견한 파일은 아직 쓰는 중일 수 있으므로, 쓰기가 끝났다는 알림을 받거나
+ * WATCH_POLL_INTERVAL_MS 마다 다시 확인해서 크기와 수정 시각이 두 번 연속 같을 때 처리한다.
+ * 배치가 다 차지 않아도 첫 파일이 들어온 뒤 WATCH_BATCH_DELAY_MS 가 지나면 처리해서 지연 시간을 제한한다.
+ * watchManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param maxFileNum 처리할 파일 개수(입력, 0 이하면 종료 요청이 올 때까지)
+ * @return 성공 시 SUCCESS, 감시 오류 시 FAIL 반환
+ */
+static int watchManagerRunInotify(watchManager_t *watchManager, long long maxFileNum)
+{
+	int result = watchManagerScanDir(watchManager);
+	clock_gettime(CLOCK_MONOTONIC, &(watchManager->seenTime));
+
+	while(result == SUCCESS && watchManagerIsStopped(watchManager, maxFileNum) == FALSE)
+	{
+		int timeoutMs = WATCH_IDLE_WAIT_MS;
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		if(watchManager->readyNum > 0)
+		{
+			int waitedMs = (int)(watchGetElapsedSec(&(watchManager->readyTime), &now) * 1000.0);
+			if(waitedMs >= WATCH_BATCH_DELAY_MS)
+			{
+				watchManagerFlush(watchManager);
+				continue;
+			}
+			timeoutMs = WATCH_BATCH_DELAY_MS - waitedMs;
+		}
+
+		if(watchManager->seenNum > 0)
+		{
+			int waitedMs = (int)(watchGetElapsedSec(&(watchManager->seenTime), &now) * 1000.0);
+			if(waitedMs >= WATCH_POLL_INTERVAL_MS)
+			{
+				watchManagerCheckSeen(watchManager);
+				watchManager->seenTime = now;
+				continue;
+			}
+			if(WATCH_POLL_INTERVAL_MS - waitedMs < timeoutMs) timeoutMs = WATCH_POLL_INTERVAL_MS - waitedMs;
+		}
+
+		struct pollfd pollFd = { .fd = watchManager->inotifyFd, .events = POLLIN, .revents = 0 };
+		int eventNum = poll(&pollFd, 1, timeoutMs);
+		if(eventNum == -1)
+		{
+			if(errno == EINTR) continue;
+			printf("[ERROR] inotify 대기 실패. (errno:%d)\n", errno);
+			result = FAIL;
+		}
+		else if(eventNum > 0)
+		{
+			result = watchManagerReadEvents(watchManager);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @fn static int watchManagerRunPoll(watchManager_t *watchManager, long long maxFileNum)
+ * @brief 주기적으로 디렉토리를 읽어서 크기와 수정 시각이 두 번 연속 같은 파일을 처리하는 함수 (inotify 를 쓸 수 없을 때)
+ * watchManagerRun 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param maxFileNum 처리할 파일 개수(입력, 0 이하면 종료 요청이 올 때까지)
+ * @return 성공 시 SUCCESS, 감시 오류 시 FAIL 반환
+ */
+static int watchManagerRunPoll(watchManager_t *watchManager, long long maxFileNum)
+{
+	int result = SUCCESS;
+
+	while(watchManagerIsStopped(watchManager, maxFileNum) == FALSE)
+	{
+		result = watchManagerScanDir(watchManager);
+		if(result == FAIL) break;
+
+		watchManagerFlush(watchManager);
+		watchManagerPrune(watchManager);
+		if(watchManagerIsStopped(watchManager, maxFileNum) == TRUE) break;
+
+		// 시그널이 오면 바로 깨어나서 종료 요청을 확인한다.
+		poll(NULL, 0, WATCH_POLL_INTERVAL_MS);
+	}
+
+	return result;
+}
+
+/**
+ * @fn static int watchManagerReadEvents(watchManager_t *watchManager)
+ * @brief 쌓인 inotify 이벤트를 모두 읽어서 쓰기가 끝난 파일은 처리 대기 목록에 넣고, 지워진 파일은 추적 목록에서 지우는 함수
+ * 이벤트 큐가 넘쳐서 알림을 잃었으면 디렉토리를 다시 읽는다.
+ * watchManagerRunInotify 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 감시 디렉토리가 없어지는 등 감시 오류 시 FAIL 반환
+ */
+static int watchManagerReadEvents(watchManager_t *watchManager)
+{
+	char buffer[WATCH_EVENT_BUFFER_SIZE] __attribute__((aligned(__alignof__(struct inotify_event))));
+	int overflow = FALSE;
+
+	while(TRUE)
+	{
+		ssize_t readSize = read(watchManager->inotifyFd, buffer, sizeof(buffer));
+		if(readSize == -1)
+		{
+			if(errno == EINTR) continue;
+			if(errno == EAGAIN) break;
+			printf("[ERROR] inotify 이벤트 읽기 실패. (errno:%d)\n", errno);
+			return FAIL;
+		}
+
+		size_t pos = 0;
+		while(pos < (size_t)readSize)
+		{
+			const struct inotify_event *event = (const struct inotify_event*)(buffer + pos);
+			pos += sizeof(struct inotify_event) + event->len;
+
+			if(event->mask & IN_Q_OVERFLOW)
+			{
+				overflow = TRUE;
+				continue;
+			}
+
+			if(event->mask & (IN_DELETE_SELF | IN_IGNORED))
+			{
+				printf("[ERROR] 감시 디렉토리가 없어짐. (dirPath:%s)\n", watchManager->dirPath);
+				return FAIL;
+			}
+
+			if(event->len == 0 || event->name[0] == '.') continue;
+
+			if(event->mask & (IN_DELETE | IN_MOVED_FROM))
+			{
+				watchManagerForgetFile(watchManager, event->name);
+			}
+			else if(watchManagerCheckFile(watchManager, event->name, TRUE) == FAIL)
+			{
+				return FAIL;
+			}
+		}
+	}
+
+	if(overflow == TRUE)
+	{
+		printf("[감시] inotify 이벤트 큐가 넘쳐서 디렉토리를 다시 읽음. (dirPath:%s)\n", watchManager->dirPath);
+		return watchManagerScanDir(watchManager);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int watchManagerScanDir(watchManager_t *watchManager)
+ * @brief 감시 디렉토리의 숨김 파일이 아닌 일반 파일들을 모두 확인하는 함수
+ * 쓰기가 끝났다는 알림을 받은 파일이 아니므로 크기와 수정 시각이 두 번 연속 같아야 처리한다.
+ * watchManagerRun 계열 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int watchManagerScanDir(watchManager_t *watchManager)
+{
+	DIR *dir = opendir(watchManager->dirPath);
+	if(dir == NULL)
+	{
+		printf("[ERROR] 디렉토리 열기 실패. (dirPath:%s, errno:%d)\n", watchManager->dirPath, errno);
+		return FAIL;
+	}
+
+	watchManager->scanNum++;
+
+	int result = SUCCESS;
+	struct dirent *entry = NULL;
+	while((entry = readdir(dir)) != NULL)
+	{
+		if(entry->d_name[0] == '.') continue;
+
+		if(watchManagerCheckFile(watchManager, entry->d_name, FALSE) == FAIL)
+		{
+			result = FAIL;
+			break;
+		}
+	}
+
+	closedir(dir);
+	return result;
+}
+
+/**
+ * @fn static int watchManagerCheckFile(watchManager_t *watchManager, const char *fileName, int isNotified)
+ * @brief 파일 하나의 크기와 수정 시각을 확인해서 처리할 때가 되었으면 처리 대기 목록에 넣는 함수
+ * 처리가 끝난 뒤 크기와 수정 시각이 그대로인 파일은 다시 처리하지 않는다.
+ * inotify 로 쓰기가 끝났다는 알림을 받은 파일은 바로 넣고, 디렉토리를 읽어서 발견한 파일은 두 번 연속 같은 상태로 보여야 넣는다.
+ * watchManagerScanDir, watchManagerReadEvents, watchManagerCheckSeen 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param fileName 감시 디렉토리 안의 파일 이름(입력, 읽기 전용)
+ * @param isNotified 쓰기가 끝났다는(close-write, rename) inotify 알림을 받은 파일인지 여부(입력)
+ * @return 성공 시 SUCCESS, 추적 목록 메모리 할당 실패 시 FAIL 반환
+ */
+static int watchManagerCheckFile(watchManager_t *watchManager, const char *fileName, int isNotified)
+{
+	char path[PATH_MAX];
+	struct stat fileStat;
+	if(snprintf(path, sizeof(path), "%s/%s", watchManager->dirPath, fileName) >= (int)sizeof(path)) return SUCCESS;
+	if(stat(path, &fileStat) == -1 || S_ISREG(fileStat.st_mode) == 0) return SUCCESS;
+
+	uint64_t hash = cacheHash64(fileName, strlen(fileName), 0);
+	int slotIndex = watchManagerFindSlot(watchManager, fileName, hash);
+	watchEntry_t *entry = watchManager->slotList[slotIndex];
+	if(entry == NULL)
+	{
+		if((watchManager->entryNum + 1) * 2 > watchManager->slotNum)
+		{
+			if(watchManagerGrow(watchManager) == FAIL) return FAIL;
+			slotIndex = watchManagerFindSlot(watchManager, fileName, hash);
+		}
+
+		entry = (watchEntry_t*)calloc(1, sizeof(watchEntry_t));
+		if(entry == NULL)
+		{
+			printf("[DEBUG] watchEntry 객체 동적 생성 실패. NULL.\n");
+			return FAIL;
+		}
+
+		snprintf(entry->name, sizeof(entry->name), "%s", fileName);
+		entry->hash = hash;
+		entry->size = -1;
+		entry->state = WATCH_SEEN;
+		gradeStatsInit(&(entry->stats));
+		watchManager->slotList[slotIndex] = entry;
+		watchManager->entryNum++;
+	}
+
+	entry->scanIndex = watchManager->scanNum;
+	if(entry->state == WATCH_READY) return SUCCESS;
+
+	int isSame = (entry->size == fileStat.st_size
+		&& entry->mtime.tv_sec == fileStat.st_mtim.tv_sec
+		&& entry->mtime.tv_nsec == fileStat.st_mtim.tv_nsec) ? TRUE : FALSE;
+	if(entry->state == WATCH_DONE && isSame == TRUE) return SUCCESS;
+
+	int isReady = (isNotified == TRUE || (entry->state == WATCH_SEEN && isSame == TRUE)) ? TRUE : FALSE;
+	entry->size = fileStat.st_size;
+	entry->mtime = fileStat.st_mtim;
+
+	if(isReady == FALSE)
+	{
+		entry->state = WATCH_SEEN;
+		watchManager->seenNum++;
+		return SUCCESS;
+	}
+
+	watchManagerEnqueue(watchManager, entry);
+	return SUCCESS;
+}
+
+/**
+ * @fn static void watchManagerCheckSeen(watchManager_t *watchManager)
+ * @brief 크기와 수정 시각이 같아지기를 기다리는 파일들을 다시 확인하는 함수 (inotify 방식)
+ * 기다리는 파일 개수는 여기서 새로 센다. (그 사이 알림을 받아서 처리한 파일이나 없어진 파일은 빠진다)
+ * 이미 있는 항목만 확인하므로 해시 테이블이 바뀌지 않아서 순회하면서 호출해도 된다.
+ * watchManagerRunInotify 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void watchManagerCheckSeen(watchManager_t *watchManager)
+{
+	watchManager->seenNum = 0;
+
+	int slotIndex = 0;
+	for( ; slotIndex < watchManager->slotNum; slotIndex++)
+	{
+		const watchEntry_t *entry = watchManager->slotList[slotIndex];
+		if(entry != NULL && entry->state == WATCH_SEEN) watchManagerCheckFile(watchManager, entry->name, FALSE);
+	}
+}
+
+/**
+ * @fn static void watchManagerForgetFile(watchManager_t *watchManager, const char *fileName)
+ * @brief 지워지거나 다른 곳으로 옮겨진 파일을 추적 목록에서 지우는 함수
+ * 처리 대기 중인 파일은 처리할 때 열기 실패로 기록되도록 남겨둔다.
+ * watchManagerReadEvents 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param fileName 감시 디렉토리 안의 파일 이름(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void watchManagerForgetFile(watchManager_t *watchManager, const char *fileName)
+{
+	int slotIndex = watchManagerFindSlot(watchManager, fileName, cacheHash64(fileName, strlen(fileName), 0));
+	watchEntry_t *entry = watchManager->slotList[slotIndex];
+	if(entry != NULL && entry->state != WATCH_READY) watchManagerRemoveSlot(watchManager, slotIndex);
+}
+
+/**
+ * @fn static void watchManagerEnqueue(watchManager_t *watchManager, watchEntry_t *entry)
+ * @brief 파일을 처리 대기 목록에 넣고, 배치가 파일 개수나 크기 한도에 닿으면 바로 처리하는 함수
+ * watchManagerCheckFile 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param entry 처리할 파일(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void watchManagerEnqueue(watchManager_t *watchManager, watchEntry_t *entry)
+{
+	if(watchManager->readyNum == WATCH_BATCH_FILE_NUM) watchManagerFlush(watchManager);
+
+	if(watchManager->readyNum == 0) clock_gettime(CLOCK_MONOTONIC, &(watchManager->readyTime));
+	entry->state = WATCH_READY;
+	watchManager->readyList[watchManager->readyNum++] = entry;
+	watchManager->readySize += (size_t)entry->size;
+
+	if(watchManager->readySize >= WATCH_BATCH_SIZE) watchManagerFlush(watchManager);
+}
+
+/**
+ * @fn static void watchManagerFlush(watchManager_t *watchManager)
+ * @brief 처리 대기 목록의 파일들을 차례로 등급 판단해서 기록하고, 배치 결과와 처리량, 지연 시간을 집계하는 함수
+ * 배치 안의 파일들은 출력 버퍼 하나를 같이 사용한다.
+ * 처리가 끝난 뒤 바뀌어서 다시 처리한 파일은 처리한 파일 개수에 다시 더하지 않고, 등급 통계도 새 결과로 바꾼다.
+ * watchManagerRun 계열 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void watchManagerFlush(watchManager_t *watchManager)
+{
+	if(watchManager->readyNum == 0) return;
+
+	struct timespec startTime, endTime;
+	gradeStats_t batchStats;
+	double lagMaxSec = 0.0;
+	long long byteNum = watchManager->byteNum;
+	int failNum = 0;
+	int newFileNum = 0;
+	int readyIndex = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+	gradeStatsInit(&batchStats);
+
+	for( ; readyIndex < watchManager->readyNum; readyIndex++)
+	{
+		watchEntry_t *entry = watchManager->readyList[readyIndex];
+		double lagSec = 0.0;
+
+		if(entry->isCounted == FALSE)
+		{
+			entry->isCounted = TRUE;
+			newFileNum++;
+		}
+
+		gradeStatsInit(&(entry->stats));
+		if(watchManagerGradeFile(watchManager, entry, &(entry->stats), &lagSec) == FAIL)
+		{
+			// 이전 결과도 지금 내용과 맞지 않으므로 통계에 남기지 않는다.
+			gradeStatsInit(&(entry->stats));
+			failNum++;
+			continue;
+		}
+
+		gradeStatsMerge(&batchStats, &(entry->stats));
+		watchManager->gradeNum++;
+		watchManager->lagSumSec += lagSec;
+		if(lagSec > lagMaxSec) lagMaxSec = lagSec;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	double elapsedSec = watchGetElapsedSec(&startTime, &endTime);
+
+	watchManager->fileNum += newFileNum;
+	watchManager->failNum += failNum;
+	watchManager->batchNum++;
+	watchManager->recordNum += batchStats.total;
+	watchManager->busySec += elapsedSec;
+	if(lagMaxSec > watchManager->lagMaxSec) watchManager->lagMaxSec = lagMaxSec;
+
+	printf("[감시 배치] (files:%d, failed:%d, records:%lld, bytes:%lld, elapsed:%.3fs, lag max:%.3fs)\n",
+		watchManager->readyNum, failNum, batchStats.total, watchManager->byteNum - byteNum, elapsedSec, lagMaxSec);
+
+	watchManager->readyNum = 0;
+	watchManager->readySize = 0;
+}
+
+/**
+ * @fn static int watchManagerGradeFile(watchManager_t *watchManager, watchEntry_t *entry, gradeStats_t *stats, double *lagSec)
+ * @brief 점수 파일 하나를 매핑해서 등급을 판단하고, 결과를 임시 파일에 쓴 뒤 출력 파일 이름으로 바꾸는 함수
+ * 출력 파일은 rename 으로 한 번에 나타나므로 결과를 읽는 쪽이 쓰는 도중의 파일을 보지 않는다.
+ * 처리한 시점의 크기와 수정 시각을 기록해서 같은 내용을 다시 처리하지 않게 한다.
+ * watchManagerFlush 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param entry 처리할 파일(입력 및 출력)
+ * @param stats 파일 등급 통계(입력 및 출력)
+ * @param lagSec 파일 수정 시각부터 결과 기록까지 걸린 시간(출력, 초 단위)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int watchManagerGradeFile(watchManager_t *watchManager, watchEntry_t *entry, gradeStats_t *stats, double *lagSec)
+{
+	char path[PATH_MAX], outputPath[PATH_MAX], tempPath[PATH_MAX];
+	entry->state = WATCH_DONE;
+
+	if(snprintf(path, sizeof(path), "%s/%s", watchManager->dirPath, entry->name) >= (int)sizeof(path)
+		|| snprintf(outputPath, sizeof(outputPath), "%s/%s%s", watchManager->outputDir, entry->name, WATCH_OUTPUT_SUFFIX) >= (int)sizeof(outputPath)
+		|| snprintf(tempPath, sizeof(tempPath), "%s/.%s%s.tmp", watchManager->outputDir, entry->name, WATCH_OUTPUT_SUFFIX) >= (int)sizeof(tempPath))
+	{
+		printf("[ERROR] 파일 경로가 너무 김. (fileName:%s)\n", entry->name);
+		return FAIL;
+	}
+
+	int fd = open(path, O_RDONLY);
+	if(fd == -1)
+	{
+		printf("[ERROR] 점수 파일 열기 실패. (path:%s, errno:%d)\n", path, errno);
+		return FAIL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1)
+	{
+		printf("[ERROR] 점수 파일 정보 읽기 실패. (path:%s, errno:%d)\n", path, errno);
+		close(fd);
+		return FAIL;
+	}
+	entry->size = fileStat.st_size;
+	entry->mtime = fileStat.st_mtim;
+
+	size_t size = (size_t)fileStat.st_size;
+	char *data = NULL;
+	if(size > 0)
+	{
+		void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapped == MAP_FAILED)
+		{
+			printf("[ERROR] 점수 파일 매핑 실패. (path:%s, errno:%d)\n", path, errno);
+			close(fd);
+			return FAIL;
+		}
+		madvise(mapped, size, MADV_SEQUENTIAL);
+		data = (char*)mapped;
+	}
+	close(fd);
+
+	watchManager->output.length = 0;
+
+	int result = SUCCESS;
+	if(data != NULL)
+	{
+		result = recordGradeBlock(watchManager->gradeManager, data, size, &(watchManager->output), stats);
+		munmap(data, size);
+	}
+	if(result == FAIL) return FAIL;
+
+	fd = open(tempPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(fd == -1)
+	{
+		printf("[ERROR] 출력 파일 열기 실패. (outputPath:%s, errno:%d)\n", tempPath, errno);
+		return FAIL;
+	}
+
+	result = recordBufferWriteAll(fd, watchManager->output.data, watchManager->output.length);
+	close(fd);
+	if(result == SUCCESS && rename(tempPath, outputPath) == -1)
+	{
+		printf("[ERROR] 출력 파일 이름 변경 실패. (outputPath:%s, errno:%d)\n", outputPath, errno);
+		result = FAIL;
+	}
+
+	if(result == FAIL)
+	{
+		unlink(tempPath);
+		return FAIL;
+	}
+
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	*lagSec = watchGetElapsedSec(&(fileStat.st_mtim), &now);
+	if(*lagSec < 0.0) *lagSec = 0.0;
+
+	watchManager->byteNum += (long long)size;
+	return SUCCESS;
+}
+
+/**
+ * @fn static void watchManagerPrune(watchManager_t *watchManager)
+ * @brief 마지막 디렉토리 검사에서 보이지 않은 파일을 추적 목록에서 지우는 함수 (폴링 방식)
+ * 지우면서 뒤쪽 항목이 당겨질 수 있으므로 지운 자리는 한 번 더 확인한다.
+ * watchManagerRunPoll 함수에서 처리 대기 목록이 빈 상태로 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void watchManagerPrune(watchManager_t *watchManager)
+{
+	int slotIndex = 0;
+	while(slotIndex < watchManager->slotNum)
+	{
+		const watchEntry_t *entry = watchManager->slotList[slotIndex];
+		if(entry != NULL && entry->scanIndex != watchManager->scanNum)
+		{
+			watchManagerRemoveSlot(watchManager, slotIndex);
+			continue;
+		}
+		slotIndex++;
+	}
+}
+
+/**
+ * @fn static int watchManagerFindSlot(const watchManager_t *watchManager, const char *fileName, uint64_t hash)
+ * @brief 파일 이름이 있는 자리 또는 추가할 빈 자리를 선형 탐사로 찾는 함수
+ * 해시 테이블은 항상 빈 자리가 있으므로 탐사는 반드시 끝난다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력, 읽기 전용)
+ * @param fileName 찾을 파일 이름(입력, 읽기 전용)
+ * @param hash 파일 이름 해시(입력)
+ * @return 같은 이름이 있는 자리 또는 빈 자리의 인덱스 반환
+ */
+static int watchManagerFindSlot(const watchManager_t *watchManager, const char *fileName, uint64_t hash)
+{
+	int mask = watchManager->slotNum - 1;
+	int slotIndex = (int)(hash & (uint64_t)mask);
+
+	while(watchManager->slotList[slotIndex] != NULL)
+	{
+		const watchEntry_t *entry = watchManager->slotList[slotIndex];
+		if(entry->hash == hash && strcmp(entry->name, fileName) == 0) break;
+		slotIndex = (slotIndex + 1) & mask;
+	}
+
+	return slotIndex;
+}
+
+/**
+ * @fn static int watchManagerGrow(watchManager_t *watchManager)
+ * @brief 해시 테이블 크기를 두 배로 늘리고 항목들을 다시 배치하는 함수
+ * 항목은 따로 할당되어 있으므로 처리 대기 목록의 포인터는 그대로 유효하다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int watchManagerGrow(watchManager_t *watchManager)
+{
+	int oldSlotNum = watchManager->slotNum;
+	watchEntry_t **oldSlotList = watchManager->slotList;
+	watchEntry_t **newSlotList = (watchEntry_t**)calloc((size_t)oldSlotNum * 2, sizeof(watchEntry_t*));
+	if(newSlotList == NULL)
+	{
+		printf("[DEBUG] slotList 크기 확장 실패. NULL. (slotNum:%d)\n", oldSlotNum * 2);
+		return FAIL;
+	}
+
+	watchManager->slotList = newSlotList;
+	watchManager->slotNum = oldSlotNum * 2;
+
+	int slotIndex = 0;
+	for( ; slotIndex < oldSlotNum; slotIndex++)
+	{
+		watchEntry_t *entry = oldSlotList[slotIndex];
+		if(entry != NULL) newSlotList[watchManagerFindSlot(watchManager, entry->name, entry->hash)] = entry;
+	}
+
+	free(oldSlotList);
+	return SUCCESS;
+}
+
+/**
+ * @fn static void watchManagerRemoveSlot(watchManager_t *watchManager, int slotIndex)
+ * @brief 해시 테이블에서 항목 하나를 지우고, 탐사 경로가 끊기지 않도록 뒤쪽 항목들을 당기는 함수
+ * 지우는 파일의 마지막 결과는 남아 있으므로 등급 통계는 전체 통계로 옮긴다.
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력 및 출력)
+ * @param slotIndex 지울 항목의 인덱스(입력)
+ * @return 반환값 없음
+ */
+static void watchManagerRemoveSlot(watchManager_t *watchManager, int slotIndex)
+{
+	int mask = watchManager->slotNum - 1;
+	int emptyIndex = slotIndex;
+	int nextIndex = (slotIndex + 1) & mask;
+
+	gradeStatsMerge(&(watchManager->stats), &(watchManager->slotList[emptyIndex]->stats));
+	free(watchManager->slotList[emptyIndex]);
+	watchManager->slotList[emptyIndex] = NULL;
+	watchManager->entryNum--;
+
+	while(watchManager->slotList[nextIndex] != NULL)
+	{
+		watchEntry_t *entry = watchManager->slotList[nextIndex];
+		int homeIndex = (int)(entry->hash & (uint64_t)mask);
+
+		// 원래 자리에서 지금 자리까지의 탐사 경로에 빈 자리가 들어있으면 빈 자리로 옮긴다.
+		if(((nextIndex - homeIndex) & mask) >= ((nextIndex - emptyIndex) & mask))
+		{
+			watchManager->slotList[emptyIndex] = entry;
+			watchManager->slotList[nextIndex] = NULL;
+			emptyIndex = nextIndex;
+		}
+		nextIndex = (nextIndex + 1) & mask;
+	}
+}
+
+/**
+ * @fn static int watchManagerIsStopped(const watchManager_t *watchManager, long long maxFileNum)
+ * @brief 종료 요청이 왔거나 지정한 개수의 파일을 처리했는지 확인하는 함수
+ * @param watchManager 디렉토리 감시를 관리하는 구조체(입력, 읽기 전용)
+ * @param maxFileNum 처리할 파일 개수(입력, 0 이하면 제한 없음)
+ * @return 끝내야 하면 TRUE, 계속하면 FALSE 반환
+ */
+static int watchManagerIsStopped(const watchManager_t *watchManager, long long maxFileNum)
+{
+	if(__atomic_load_n(&(watchManager->stopRequested), __ATOMIC_RELAXED) == TRUE) return TRUE;
+	return (maxFileNum > 0 && watchManager->fileNum >= maxFileNum) ? TRUE : FALSE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Util Function
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double watchGetElapsedSec(const struct timespec *startTime, const struct timespec *endTime)
+ * @brief 두 시각 사이의 시간을 초 단위로 계산하는 함수
+ * @param startTime 시작 시각(입력, 읽기 전용)
+ * @param endTime 끝 시각(입력, 읽기 전용)
+ * @return 두 시각 사이의 시간(초) 반환
+ */
+static double watchGetElapsedSec(const struct timespec *startTime, const struct timespec *endTime)
+{
+	return (double)(endTime->tv_sec - startTime->tv_sec) + (double)(endTime->tv_nsec - startTime->tv_nsec) / 1e9;
+}
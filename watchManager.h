@@ -0,0 +1,147 @@
+#ifndef __WATCH_MANAGER_H__
+#define __WATCH_MANAGER_H__
+
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/types.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 한 번에 모아서 처리하는 최대 파일 개수
+#define WATCH_BATCH_FILE_NUM	64
+// 한 번에 모아서 처리하는 최대 입력 크기 (바이트, 넘으면 바로 처리)
+#define WATCH_BATCH_SIZE		(4 * 1024 * 1024)
+// 배치가 다 차지 않아도 처리를 시작하는 대기 시간 (밀리초, 첫 파일이 들어온 뒤부터)
+#define WATCH_BATCH_DELAY_MS	50
+// 폴링 방식의 디렉토리 검사 주기 (밀리초)
+#define WATCH_POLL_INTERVAL_MS	500
+// 처리할 파일이 없을 때 종료 요청을 확인하는 주기 (밀리초)
+#define WATCH_IDLE_WAIT_MS		1000
+// 파일 추적 해시 테이블 처음 크기 (2 의 거듭제곱, 항목이 절반을 넘으면 두 배로 늘린다)
+#define WATCH_INIT_SLOT_NUM		256
+// 처리한 입력 파일 하나의 출력 파일 이름에 붙는 확장자
+#define WATCH_OUTPUT_SUFFIX		".grade"
+
+// 디렉토리 감시 방식 열거형
+enum WATCH_MODE
+{
+	WATCH_INOTIFY = 0,	// inotify 로 쓰기가 끝난(close-write) 파일과 옮겨진(rename) 파일을 바로 알림받음 (알림 없이 발견한 파일은 폴링 방식처럼 확인)
+	WATCH_POLL			// 주기적으로 디렉토리를 읽어서 크기와 수정 시각이 두 번 연속 같은 파일을 처리
+};
+
+// 감시 중인 파일의 처리 상태 열거형
+enum WATCH_STATE
+{
+	WATCH_SEEN = 0,		// 발견했지만 아직 쓰는 중일 수 있는 파일 (폴링 방식, inotify 방식에서 알림 없이 발견한 파일)
+	WATCH_READY,		// 처리 대기 목록에 들어간 파일
+	WATCH_DONE			// 처리가 끝난 파일 (크기나 수정 시각이 바뀌면 다시 처리)
+};
+
+/**
+ * @struct watchEntry_t
+ * @brief 감시 디렉토리에 있는 파일 하나의 이름, 크기, 수정 시각과 처리 상태를 저장하는 구조체
+ */
+typedef struct watchEntry_s watchEntry_t;
+struct watchEntry_s
+{
+	// 파일 이름
+	char name[NAME_MAX + 1];
+	// 파일 이름 해시
+	uint64_t hash;
+	// 마지막으로 확인한 파일 크기
+	off_t size;
+	// 마지막으로 확인한 수정 시각
+	struct timespec mtime;
+	// 처리 상태 (WATCH_STATE)
+	int state;
+	// 마지막으로 발견한 디렉토리 검사 번호 (폴링 방식에서 지워진 파일을 정리할 때 사용)
+	long long scanIndex;
+	// 마지막으로 처리한 결과의 등급 통계 (다시 처리하면 새 결과로 바꾼다)
+	gradeStats_t stats;
+	// 처리한 파일 개수에 이미 들어간 파일인지 여부
+	int isCounted;
+};
+
+/**
+ * @struct watchManager_t
+ * @brief 점수 파일이 들어오는 디렉토리를 감시하다가 다 쓰인 파일을 바로 등급 판단하는 구조체
+ * inotify 를 사용할 수 없으면 폴링 방식으로 바꾸고, 작은 파일들은 배치로 모아서 한 번에 처리한다.
+ * 등급 정보는 처음 한 번만 읽어서 모든 파일에 사용하고, 처리량과 지연 시간(파일 수정 시각부터 결과 기록까지)을 집계한다.
+ * 쓰는 도중의 파일을 처리하지 않으려면 생산자는 '.' 으로 시작하는 이름으로 쓴 뒤 rename 하는 것이 좋다. (숨김 파일은 무시)
+ */
+typedef struct watchManager_s watchManager_t;
+struct watchManager_s
+{
+	// 등급 정보를 관리하는 구조체 (읽기 전용으로 공유)
+	const gradeManager_t *gradeManager;
+	// 감시할 디렉토리
+	char dirPath[PATH_MAX];
+	// 결과를 저장할 디렉토리
+	char outputDir[PATH_MAX];
+	// 감시 방식 (WATCH_MODE)
+	int mode;
+	// inotify 파일 디스크립터 (폴링 방식이면 -1)
+	int inotifyFd;
+	// 파일 추적 해시 테이블 (NULL 이면 빈 자리)
+	watchEntry_t **slotList;
+	// 해시 테이블 크기 (2 의 거듭제곱)
+	int slotNum;
+	// 추적 중인 파일 개수
+	int entryNum;
+	// 디렉토리 검사 횟수
+	long long scanNum;
+	// 크기와 수정 시각이 같아지기를 기다리는 파일 개수 (inotify 방식에서 알림 없이 발견한 파일, 다시 확인할 때 새로 센다)
+	int seenNum;
+	// 기다리는 파일들을 마지막으로 확인한 시각
+	struct timespec seenTime;
+	// 처리 대기 목록
+	watchEntry_t *readyList[WATCH_BATCH_FILE_NUM];
+	// 처리 대기 파일 개수
+	int readyNum;
+	// 처리 대기 파일 전체 크기
+	size_t readySize;
+	// 처리 대기 목록에 첫 파일이 들어온 시각
+	struct timespec readyTime;
+	// 배치들이 같이 사용하는 출력 버퍼
+	recordBuffer_t output;
+	// 종료 요청 (시그널 처리기에서 원자적으로 설정)
+	int stopRequested;
+	// 처리한 파일 개수 (다시 처리한 파일은 한 번만 센다)
+	long long fileNum;
+	// 처리에 실패한 파일 개수
+	long long failNum;
+	// 처리한 배치 개수
+	long long batchNum;
+	// 처리한 입력 바이트
+	long long byteNum;
+	// 결과를 기록한 횟수 (다시 처리한 파일도 포함, 평균 지연 시간 계산에 사용)
+	long long gradeNum;
+	// 등급을 판단한 레코드 개수 (다시 처리한 파일도 포함, 처리량 계산에 사용)
+	long long recordNum;
+	// 파일 처리에 걸린 시간의 합 (초)
+	double busySec;
+	// 파일별 지연 시간의 합 (초)
+	double lagSumSec;
+	// 가장 긴 지연 시간 (초)
+	double lagMaxSec;
+	// 추적 목록에서 빠진 파일들의 등급 통계 (추적 중인 파일은 항목별로 저장하고 출력할 때 합친다)
+	gradeStats_t stats;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for watchManager_t
+//////////////////////////////////////////////////////////////////////////
+
+watchManager_t* watchManagerNew(const gradeManager_t *gradeManager, const char *dirPath, const char *outputDir, int mode);
+void watchManagerDelete(watchManager_t **watchManager);
+int watchManagerRun(watchManager_t *watchManager, long long maxFileNum);
+void watchManagerRequestStop(watchManager_t *watchManager);
+void watchManagerPrintSummary(FILE *filePtr, const watchManager_t *watchManager);
+const char* watchGetModeName(int mode);
+
+#endif // #ifndef __WATCH_MANAGER_H__
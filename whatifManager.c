@@ -0,0 +1,451 @@
+#include <time.h>
+
+#include "whatifManager.h"
+#include "inputManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for whatifManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static void whatifManagerAddBlock(whatifManager_t *whatifManager, const char *data, size_t length);
+static void whatifManagerBuildPrefix(whatifManager_t *whatifManager);
+static int whatifManagerSearch(const whatifManager_t *whatifManager, int low, int high, long long target);
+static char whatifClassify(const gradeManager_t *candidate, int score);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for whatifManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn whatifManager_t* whatifManagerNew(const gradeManager_t *const *candidateList, int candidateNum)
+ * @brief 후보 등급 테이블들의 전체 범위를 합친 범위로 히스토그램을 준비하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param candidateList 후보 등급 정보 목록(입력, 읽기 전용, 모두 같은 배율)
+ * @param candidateNum 후보 개수(입력, 1 이상)
+ * @return 성공 시 새로 생성된 whatifManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+whatifManager_t* whatifManagerNew(const gradeManager_t *const *candidateList, int candidateNum)
+{
+	if(candidateList == NULL || candidateNum <= 0)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (candidateList:%p, candidateNum:%d)\n", (const void*)candidateList, candidateNum);
+		return NULL;
+	}
+
+	int domainMin = INT_MAX;
+	int domainMax = INT_MIN;
+	int candidateIndex = 0;
+	for( ; candidateIndex < candidateNum; candidateIndex++)
+	{
+		const gradeManager_t *candidate = candidateList[candidateIndex];
+		if(candidate == NULL || candidate->scale != candidateList[0]->scale)
+		{
+			printf("[ERROR] 후보 등급 정보가 없거나 배율이 다름. (index:%d)\n", candidateIndex);
+			return NULL;
+		}
+		if(candidate->totalMin < domainMin) domainMin = candidate->totalMin;
+		if(candidate->totalMax > domainMax) domainMax = candidate->totalMax;
+	}
+
+	long long binNum = (long long)domainMax - domainMin + 1;
+	if(binNum > WHATIF_MAX_BIN_NUM)
+	{
+		printf("[ERROR] 후보들의 전체 범위가 너무 넓음. (bins:%lld, max:%d)\n", binNum, WHATIF_MAX_BIN_NUM);
+		return NULL;
+	}
+
+	whatifManager_t *whatifManager = (whatifManager_t*)calloc(1, sizeof(whatifManager_t));
+	if(whatifManager == NULL)
+	{
+		printf("[DEBUG] whatifManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	whatifManager->parser = candidateList[0];
+	whatifManager->domainMin = domainMin;
+	whatifManager->domainMax = domainMax;
+
+	size_t listSize = sizeof(long long) * ((size_t)binNum + 1);
+	whatifManager->countPrefixList = (long long*)hugeAlloc(listSize);
+	whatifManager->sumPrefixList = (long long*)hugeAlloc(listSize);
+	if(whatifManager->countPrefixList == NULL || whatifManager->sumPrefixList == NULL)
+	{
+		printf("[DEBUG] 히스토그램 배열 동적 생성 실패. NULL. (bins:%lld)\n", binNum);
+		whatifManagerDelete(&whatifManager);
+		return NULL;
+	}
+	memset(whatifManager->countPrefixList, 0, listSize);
+	memset(whatifManager->sumPrefixList, 0, listSize);
+
+	return whatifManager;
+}
+
+/**
+ * @fn void whatifManagerDelete(whatifManager_t **whatifManager)
+ * @brief 생성된 whatifManager_t 구조체 객체와 히스토그램을 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param whatifManager 삭제할 whatifManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void whatifManagerDelete(whatifManager_t **whatifManager)
+{
+	if(whatifManager == NULL || *whatifManager == NULL)
+	{
+		printf("[DEBUG] whatifManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	hugeFree((*whatifManager)->countPrefixList);
+	hugeFree((*whatifManager)->sumPrefixList);
+	free(*whatifManager);
+	*whatifManager = NULL;
+}
+
+/**
+ * @fn int whatifManagerLoadFile(whatifManager_t *whatifManager, const char *fileName)
+ * @brief 점수 파일 전체를 한 번 읽어 점수별 개수와 합의 누적 배열을 만드는 함수
+ * stream 과 같은 입력 파이프라인을 사용하므로 gzip/zstd 로 압축된 파일도 그대로 읽는다.
+ * 빈 줄은 건너뛰고, 점수를 읽을 수 없는 줄은 stream 처럼 모든 후보에서 '?' 로 센다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param whatifManager 히스토그램 구조체(입력 및 출력, 한 번만 호출)
+ * @param fileName 점수 파일 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int whatifManagerLoadFile(whatifManager_t *whatifManager, const char *fileName)
+{
+	if(whatifManager == NULL || fileName == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (whatifManager:%p, fileName:%p)\n", (void*)whatifManager, (const void*)fileName);
+		return FAIL;
+	}
+
+	struct timespec startTime, endTime;
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	inputManager_t *inputManager = inputManagerNew(fileName, 0);
+	if(inputManager == NULL)
+	{
+		return FAIL;
+	}
+
+	const recordBuffer_t *chunk = NULL;
+	while((chunk = inputManagerNext(inputManager)) != NULL)
+	{
+		whatifManagerAddBlock(whatifManager, chunk->data, chunk->length);
+		inputManagerRelease(inputManager);
+	}
+
+	int result = SUCCESS;
+	pthread_mutex_lock(&(inputManager->mutex));
+	if(inputManager->failed == TRUE) result = FAIL;
+	pthread_mutex_unlock(&(inputManager->mutex));
+	inputManagerDelete(&inputManager);
+
+	whatifManagerBuildPrefix(whatifManager);
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	whatifManager->buildSec = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+	return result;
+}
+
+/**
+ * @fn int whatifManagerEvaluate(const whatifManager_t *whatifManager, const gradeManager_t *candidate, gradeStats_t *stats)
+ * @brief 후보 등급 테이블 하나로 판단했을 때의 등급 통계를 누적 배열만으로 계산하는 함수
+ * 전체 범위와 등급 A ~ D 의 경계로 전체 범위를 최대 WHATIF_MAX_SEGMENT_NUM 개의 기본 구간으로 나누면 한 구간 안의 점수는 모두 같은 등급이므로,
+ * 구간마다 누적 배열의 차이로 개수와 합을 구한다. 등급 범위가 겹쳐도 gradeManagerClassifyScore 처럼 A, B, C, D 순서로 먼저 맞는 등급이 된다.
+ * 최소값과 최대값은 점수가 있는 첫 구간과 마지막 구간에서 누적 배열을 이진 탐색해서 찾는다.
+ * 결과는 같은 ini 파일로 stream 을 실행한 통계와 같다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param whatifManager 누적 배열을 만든 히스토그램 구조체(입력, 읽기 전용)
+ * @param candidate 후보 등급 정보(입력, 읽기 전용, whatifManagerNew 에 넘긴 후보 중 하나)
+ * @param stats 후보의 등급 통계(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int whatifManagerEvaluate(const whatifManager_t *whatifManager, const gradeManager_t *candidate, gradeStats_t *stats)
+{
+	if(whatifManager == NULL || candidate == NULL || stats == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (whatifManager:%p, candidate:%p, stats:%p)\n", (const void*)whatifManager, (const void*)candidate, (void*)stats);
+		return FAIL;
+	}
+
+	if(candidate->scale != whatifManager->parser->scale
+		|| candidate->totalMin < whatifManager->domainMin || candidate->totalMax > whatifManager->domainMax)
+	{
+		printf("[ERROR] 후보의 배율 또는 전체 범위가 히스토그램과 맞지 않음.\n");
+		return FAIL;
+	}
+
+	// 기본 구간의 시작점 목록 (마지막 점은 전체 최대값 + 1)
+	const gradeInfo_t *gradeInfoList[4] = { &(candidate->gradeA), &(candidate->gradeB), &(candidate->gradeC), &(candidate->gradeD) };
+	long long pointList[WHATIF_MAX_SEGMENT_NUM + 1];
+	long long lower = candidate->totalMin;
+	long long upper = (long long)candidate->totalMax + 1;
+	int pointNum = 0;
+	int gradeIndex = 0;
+
+	pointList[pointNum++] = lower;
+	pointList[pointNum++] = upper;
+	for( ; gradeIndex < 4; gradeIndex++)
+	{
+		long long edgeList[2] = { gradeInfoList[gradeIndex]->min, (long long)gradeInfoList[gradeIndex]->max + 1 };
+		int edgeIndex = 0;
+		for( ; edgeIndex < 2; edgeIndex++)
+		{
+			if(edgeList[edgeIndex] > lower && edgeList[edgeIndex] < upper) pointList[pointNum++] = edgeList[edgeIndex];
+		}
+	}
+
+	// 점이 10 개 이하이므로 삽입 정렬 후 중복을 지운다.
+	int pointIndex = 1;
+	for( ; pointIndex < pointNum; pointIndex++)
+	{
+		long long point = pointList[pointIndex];
+		int insertIndex = pointIndex;
+		for( ; insertIndex > 0 && pointList[insertIndex - 1] > point; insertIndex--)
+		{
+			pointList[insertIndex] = pointList[insertIndex - 1];
+		}
+		pointList[insertIndex] = point;
+	}
+
+	int uniqueNum = 1;
+	for(pointIndex = 1; pointIndex < pointNum; pointIndex++)
+	{
+		if(pointList[pointIndex] != pointList[uniqueNum - 1]) pointList[uniqueNum++] = pointList[pointIndex];
+	}
+
+	const long long *countPrefixList = whatifManager->countPrefixList;
+	const long long *sumPrefixList = whatifManager->sumPrefixList;
+	long long validNum = 0;
+	int firstLow = 0, lastHigh = 0, found = FALSE;
+
+	gradeStatsInit(stats);
+	for(pointIndex = 0; pointIndex + 1 < uniqueNum; pointIndex++)
+	{
+		int low = (int)pointList[pointIndex];
+		int high = (int)(pointList[pointIndex + 1] - 1);
+		int begin = low - whatifManager->domainMin;
+		int end = high - whatifManager->domainMin + 1;
+
+		long long count = countPrefixList[end] - countPrefixList[begin];
+		if(count == 0) continue;
+
+		stats->count[gradeManagerGetGradeIndex(whatifClassify(candidate, low))] += count;
+		stats->sum += sumPrefixList[end] - sumPrefixList[begin];
+		validNum += count;
+
+		if(found == FALSE) firstLow = low;
+		lastHigh = high;
+		found = TRUE;
+	}
+
+	stats->total = whatifManager->total;
+	stats->count[gradeManagerGetGradeIndex('?')] = whatifManager->total - validNum;
+	if(found == TRUE)
+	{
+		stats->min = whatifManagerSearch(whatifManager, firstLow, lastHigh, countPrefixList[firstLow - whatifManager->domainMin] + 1);
+		stats->max = whatifManagerSearch(whatifManager, firstLow, lastHigh, countPrefixList[lastHigh - whatifManager->domainMin + 1]);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn void whatifManagerPrintSummary(FILE *filePtr, const whatifManager_t *whatifManager)
+ * @brief 히스토그램의 범위, 레코드 개수, 만드는 데 걸린 시간을 한 줄로 출력하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param filePtr 출력할 파일 스트림(입력)
+ * @param whatifManager 히스토그램 구조체(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void whatifManagerPrintSummary(FILE *filePtr, const whatifManager_t *whatifManager)
+{
+	if(filePtr == NULL || whatifManager == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (filePtr:%p, whatifManager:%p)\n", (void*)filePtr, (const void*)whatifManager);
+		return;
+	}
+
+	char minText[GRADE_SCORE_TEXT_LEN];
+	char maxText[GRADE_SCORE_TEXT_LEN];
+	gradeManagerFormatScore(whatifManager->parser, whatifManager->domainMin, minText, sizeof(minText));
+	gradeManagerFormatScore(whatifManager->parser, whatifManager->domainMax, maxText, sizeof(maxText));
+
+	fprintf(filePtr, "[히스토그램] (records:%lld, domain:%s~%s, bins:%d, below:%lld, above:%lld, invalid:%lld, elapsed:%.3fs)\n",
+		whatifManager->total, minText, maxText, whatifManager->domainMax - whatifManager->domainMin + 1,
+		whatifManager->belowNum, whatifManager->aboveNum, whatifManager->invalidNum, whatifManager->buildSec);
+}
+
+/**
+ * @fn void whatifPrintHeader(FILE *filePtr)
+ * @brief 후보별 등급 분포 표의 제목 줄을 출력하는 함수
+ * @param filePtr 출력할 파일 스트림(입력)
+ * @return 반환값 없음
+ */
+void whatifPrintHeader(FILE *filePtr)
+{
+	if(filePtr == NULL) return;
+
+	int index = 0;
+	fprintf(filePtr, "%-24s", "candidate");
+	for( ; index < GRADE_KIND_NUM; index++)
+	{
+		fprintf(filePtr, " %18c", gradeManagerGetGradeFromIndex(index));
+	}
+	fprintf(filePtr, " %10s %10s %10s\n", "min", "max", "avg");
+}
+
+/**
+ * @fn void whatifPrintRow(FILE *filePtr, const gradeManager_t *candidate, const char *name, const gradeStats_t *stats)
+ * @brief 후보 하나의 등급별 개수와 비율, 범위 안 점수의 최소값, 최대값, 평균을 표의 한 줄로 출력하는 함수
+ * @param filePtr 출력할 파일 스트림(입력)
+ * @param candidate 점수를 배율에 맞춰 출력할 후보 등급 정보(입력, 읽기 전용)
+ * @param name 후보 이름(입력, 읽기 전용)
+ * @param stats 후보의 등급 통계(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void whatifPrintRow(FILE *filePtr, const gradeManager_t *candidate, const char *name, const gradeStats_t *stats)
+{
+	if(filePtr == NULL || candidate == NULL || name == NULL || stats == NULL) return;
+
+	int index = 0;
+	long long validNum = stats->total - stats->count[gradeManagerGetGradeIndex('?')];
+
+	fprintf(filePtr, "%-24s", name);
+	for( ; index < GRADE_KIND_NUM; index++)
+	{
+		double ratio = (stats->total > 0) ? (double)stats->count[index] * 100.0 / (double)stats->total : 0.0;
+		fprintf(filePtr, " %10lld(%5.1f%%)", stats->count[index], ratio);
+	}
+
+	if(validNum > 0)
+	{
+		char minText[GRADE_SCORE_TEXT_LEN];
+		char maxText[GRADE_SCORE_TEXT_LEN];
+		gradeManagerFormatScore(candidate, stats->min, minText, sizeof(minText));
+		gradeManagerFormatScore(candidate, stats->max, maxText, sizeof(maxText));
+		fprintf(filePtr, " %10s %10s %10.2f\n", minText, maxText, (double)stats->sum / (double)validNum / (double)candidate->scale);
+	}
+	else
+	{
+		fprintf(filePtr, " %10s %10s %10s\n", "-", "-", "-");
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for whatifManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void whatifManagerAddBlock(whatifManager_t *whatifManager, const char *data, size_t length)
+ * @brief 여러 레코드가 담긴 메모리 블록의 점수들을 히스토그램에 더하는 함수
+ * 누적 배열을 만들기 전까지는 countPrefixList[i + 1] 과 sumPrefixList[i + 1] 에 점수 domainMin + i 의 개수와 합을 모은다.
+ * 줄 나누기와 점수 읽기는 recordGradeBlock 과 같다.
+ * whatifManagerLoadFile 함수에서 호출되기 때문에 전달받은 포인터들에 대한 NULL 체크를 수행하지 않는다.
+ * @param whatifManager 히스토그램 구조체(입력 및 출력)
+ * @param data 레코드들이 개행 문자로 구분된 메모리 블록(입력, 읽기 전용)
+ * @param length 메모리 블록의 길이(입력)
+ * @return 반환값 없음
+ */
+static void whatifManagerAddBlock(whatifManager_t *whatifManager, const char *data, size_t length)
+{
+	const int domainMin = whatifManager->domainMin;
+	const int domainMax = whatifManager->domainMax;
+	long long *countList = whatifManager->countPrefixList + 1;
+	long long *sumList = whatifManager->sumPrefixList + 1;
+	size_t pos = 0;
+
+	while(pos < length)
+	{
+		const char *line = data + pos;
+		const char *newLine = (const char*)memchr(line, '\n', length - pos);
+		size_t lineLength = (newLine == NULL) ? (length - pos) : (size_t)(newLine - line);
+		pos += lineLength + 1;
+
+		size_t textLength = lineLength;
+		while(textLength > 0 && (line[textLength - 1] == ' ' || line[textLength - 1] == '\t' || line[textLength - 1] == '\r')) textLength--;
+		if(textLength == 0) continue;
+
+		whatifManager->total++;
+
+		int score = 0;
+		if(recordParseScore(whatifManager->parser, line, textLength, &score) == FAIL)
+		{
+			whatifManager->invalidNum++;
+			continue;
+		}
+
+		if(score < domainMin) whatifManager->belowNum++;
+		else if(score > domainMax) whatifManager->aboveNum++;
+		else
+		{
+			countList[score - domainMin]++;
+			sumList[score - domainMin] += score;
+		}
+	}
+}
+
+/**
+ * @fn static void whatifManagerBuildPrefix(whatifManager_t *whatifManager)
+ * @brief 점수별 개수와 합을 누적 배열로 바꾸는 함수
+ * whatifManagerLoadFile 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param whatifManager 히스토그램 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void whatifManagerBuildPrefix(whatifManager_t *whatifManager)
+{
+	int binNum = whatifManager->domainMax - whatifManager->domainMin + 1;
+	int binIndex = 1;
+
+	for( ; binIndex <= binNum; binIndex++)
+	{
+		whatifManager->countPrefixList[binIndex] += whatifManager->countPrefixList[binIndex - 1];
+		whatifManager->sumPrefixList[binIndex] += whatifManager->sumPrefixList[binIndex - 1];
+	}
+}
+
+/**
+ * @fn static int whatifManagerSearch(const whatifManager_t *whatifManager, int low, int high, long long target)
+ * @brief 지정한 점수 범위에서 그 점수 이하인 점수 개수가 target 이상이 되는 가장 작은 점수를 이진 탐색으로 찾는 함수
+ * whatifManagerEvaluate 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param whatifManager 누적 배열을 만든 히스토그램 구조체(입력, 읽기 전용)
+ * @param low 찾을 범위의 최소 점수(입력)
+ * @param high 찾을 범위의 최대 점수(입력, 이 점수에서는 조건을 만족해야 함)
+ * @param target 누적 개수 목표(입력)
+ * @return 조건을 만족하는 가장 작은 점수 반환
+ */
+static int whatifManagerSearch(const whatifManager_t *whatifManager, int low, int high, long long target)
+{
+	const long long *countPrefixList = whatifManager->countPrefixList;
+	const int domainMin = whatifManager->domainMin;
+
+	while(low < high)
+	{
+		int middle = low + (high - low) / 2;
+		if(countPrefixList[middle - domainMin + 1] >= target) high = middle;
+		else low = middle + 1;
+	}
+
+	return low;
+}
+
+/**
+ * @fn static char whatifClassify(const gradeManager_t *candidate, int score)
+ * @brief 전체 범위 안의 점수 하나에 대한 후보의 등급을 판단하는 함수
+ * 특화 빌드(GRADE_TABLE_STATIC)의 gradeManagerClassifyScore 는 컴파일된 테이블 하나만 보므로, 후보마다 다른 범위값을 직접 비교한다.
+ * whatifManagerEvaluate 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param candidate 후보 등급 정보(입력, 읽기 전용)
+ * @param score 등급 판단에 사용될 점수(입력, 전체 범위 안)
+ * @return 결정된 등급 문자, 어떤 등급에도 속하지 않으면 'F' 문자 반환
+ */
+static char whatifClassify(const gradeManager_t *candidate, int score)
+{
+	if(score >= candidate->gradeA.min && score <= candidate->gradeA.max) return 'A';
+	if(score >= candidate->gradeB.min && score <= candidate->gradeB.max) return 'B';
+	if(score >= candidate->gradeC.min && score <= candidate->gradeC.max) return 'C';
+	if(score >= candidate->gradeD.min && score <= candidate->gradeD.max) return 'D';
+
+	return 'F';
+}
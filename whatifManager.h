@@ -0,0 +1,62 @@
+#ifndef __WHATIF_MANAGER_H__
+#define __WHATIF_MANAGER_H__
+
+#include <stdio.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 히스토그램 구간 최대 개수 (후보들의 전체 범위를 합친 길이 + 1, 누적 배열 두 개가 각각 8 바이트 * 이 개수를 쓴다)
+#define WHATIF_MAX_BIN_NUM		(8 * 1024 * 1024)
+// 후보 하나를 나누는 기본 구간 최대 개수 (전체 범위 2 개 + 등급 A ~ D 의 경계 8 개로 만들어지는 점 사이)
+#define WHATIF_MAX_SEGMENT_NUM	9
+
+/**
+ * @struct whatifManager_t
+ * @brief 점수 파일을 한 번 읽어 점수별 개수 히스토그램을 만들고, 여러 후보 등급 테이블의 등급 분포를 누적 합으로 계산하는 구조체
+ * <처리 흐름>
+ * 점수 파일 -> 점수별 개수와 점수 합의 누적 배열 (O(레코드 개수), 한 번) -> 후보마다 경계로 나눈 구간의 누적 합 차이 (O(등급 개수))
+ * 히스토그램 범위는 모든 후보의 [Total] 범위를 합친 범위이므로, 그 밖의 점수와 읽을 수 없는 줄은 모든 후보에서 '?' 이다.
+ * 모든 후보는 같은 고정 소수점 배율을 써야 한다. (점수를 한 번만 정수로 바꾼다)
+ */
+typedef struct whatifManager_s whatifManager_t;
+struct whatifManager_s
+{
+	// 점수를 읽을 때 사용하는 등급 정보 (첫 번째 후보, 배율만 사용)
+	const gradeManager_t *parser;
+	// 히스토그램 범위의 최소값
+	int domainMin;
+	// 히스토그램 범위의 최대값
+	int domainMax;
+	// 점수별 개수의 누적 배열 (countPrefixList[i] = domainMin + i 보다 작은 점수 개수, 구간 개수 + 1 크기)
+	long long *countPrefixList;
+	// 점수 합의 누적 배열 (sumPrefixList[i] = domainMin + i 보다 작은 점수들의 합, 구간 개수 + 1 크기)
+	long long *sumPrefixList;
+	// 히스토그램 범위보다 작은 점수 개수
+	long long belowNum;
+	// 히스토그램 범위보다 큰 점수 개수
+	long long aboveNum;
+	// 점수를 읽을 수 없는 줄 개수
+	long long invalidNum;
+	// 전체 레코드 개수 (빈 줄 제외)
+	long long total;
+	// 히스토그램을 만드는 데 걸린 시간 (초)
+	double buildSec;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for whatifManager_t
+//////////////////////////////////////////////////////////////////////////
+
+whatifManager_t* whatifManagerNew(const gradeManager_t *const *candidateList, int candidateNum);
+void whatifManagerDelete(whatifManager_t **whatifManager);
+int whatifManagerLoadFile(whatifManager_t *whatifManager, const char *fileName);
+int whatifManagerEvaluate(const whatifManager_t *whatifManager, const gradeManager_t *candidate, gradeStats_t *stats);
+void whatifManagerPrintSummary(FILE *filePtr, const whatifManager_t *whatifManager);
+void whatifPrintHeader(FILE *filePtr);
+void whatifPrintRow(FILE *filePtr, const gradeManager_t *candidate, const char *name, const gradeStats_t *stats);
+
+#endif // #ifndef __WHATIF_MANAGER_H__
@@ -0,0 +1,565 @@
+#include <fcntl.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "workloadManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 레코드 하나에 대해 서로 다른 난수를 얻기 위한 스트림 번호
+#define WORKLOAD_STREAM_VALUE	0
+#define WORKLOAD_STREAM_SELECT	1
+#define WORKLOAD_STREAM_ANGLE	2
+#define WORKLOAD_STREAM_NOISE	3
+
+//////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions for workloadManager_t
+//////////////////////////////////////////////////////////////////////////
+
+static void workloadManagerBuildRanges(workloadManager_t *workloadManager);
+static void* workloadManagerWorkerThread(void *data);
+static int workloadWorkerWriteBlock(workloadWorker_t *worker, long long blockIndex, long long first, int count);
+static int workloadManagerMakeScore(const workloadManager_t *workloadManager, long long index);
+static int workloadManagerMakeNormal(const workloadManager_t *workloadManager, long long index, double mean, double stddev);
+static uint64_t workloadRandom(uint64_t seed, long long index, int stream);
+static double workloadUnit(uint64_t value);
+static void workloadManagerSetFailed(workloadManager_t *workloadManager);
+static int workloadManagerIsFailed(workloadManager_t *workloadManager);
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for workloadManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn workloadManager_t* workloadManagerNew(const gradeManager_t *gradeManager, const char *outputPath, long long recordNum, int distribution, int format)
+ * @brief 점수 파일 생성 작업을 만들고 출력 파일을 여는 함수
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 포인터들에 대한 NULL 체크를 수행한다.
+ * @param gradeManager 등급 정보를 관리하는 구조체(입력, 읽기 전용)
+ * @param outputPath 출력 파일 경로(입력, 읽기 전용)
+ * @param recordNum 만들 레코드 개수(입력)
+ * @param distribution 점수 분포(입력, WORKLOAD_DISTRIBUTION)
+ * @param format 출력 형식(입력, WORKLOAD_FORMAT)
+ * @return 성공 시 새로 생성된 workloadManager_t 구조체 객체, 실패 시 NULL 반환
+ */
+workloadManager_t* workloadManagerNew(const gradeManager_t *gradeManager, const char *outputPath, long long recordNum, int distribution, int format)
+{
+	if(gradeManager == NULL || outputPath == NULL)
+	{
+		printf("[DEBUG] 매개변수 참조 오류. (gradeManager:%p, outputPath:%p)\n", (const void*)gradeManager, (const void*)outputPath);
+		return NULL;
+	}
+
+	if(recordNum <= 0 || distribution < 0 || distribution >= WORKLOAD_DISTRIBUTION_NUM || (format != WORKLOAD_TEXT && format != WORKLOAD_BINARY))
+	{
+		printf("[ERROR] 잘못된 생성 조건. (records:%lld, distribution:%d, format:%d)\n", recordNum, distribution, format);
+		return NULL;
+	}
+
+	workloadManager_t *workloadManager = (workloadManager_t*)calloc(1, sizeof(workloadManager_t));
+	if(workloadManager == NULL)
+	{
+		printf("[DEBUG] workloadManager 객체 동적 생성 실패. NULL.\n");
+		return NULL;
+	}
+
+	pthread_mutex_init(&(workloadManager->mutex), NULL);
+	pthread_cond_init(&(workloadManager->turn), NULL);
+	workloadManager->gradeManager = gradeManager;
+	workloadManager->recordNum = recordNum;
+	workloadManager->distribution = distribution;
+	workloadManager->format = format;
+	workloadManager->blockNum = (recordNum + WORKLOAD_BLOCK_NUM - 1) / WORKLOAD_BLOCK_NUM;
+	gradeStatsInit(&(workloadManager->stats));
+	workloadManagerBuildRanges(workloadManager);
+
+	if(snprintf(workloadManager->outputPath, sizeof(workloadManager->outputPath), "%s", outputPath) >= (int)sizeof(workloadManager->outputPath))
+	{
+		printf("[ERROR] 출력 파일 경로가 너무 김. (outputPath:%s)\n", outputPath);
+		workloadManager->fd = -1;
+		workloadManagerDelete(&workloadManager);
+		return NULL;
+	}
+
+	workloadManager->fd = open(outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(workloadManager->fd == -1)
+	{
+		printf("[ERROR] 출력 파일 열기 실패. (fileName:%s, errno:%d)\n", outputPath, errno);
+		workloadManagerDelete(&workloadManager);
+		return NULL;
+	}
+
+	return workloadManager;
+}
+
+/**
+ * @fn void workloadManagerDelete(workloadManager_t **workloadManager)
+ * @brief 생성된 workloadManager_t 구조체 객체의 출력 파일을 닫고 메모리를 해제하는 함수
+ * 외부에서 접근할 수 있는 함수이므로 생성된 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param workloadManager 삭제할 workloadManager_t 구조체 객체(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void workloadManagerDelete(workloadManager_t **workloadManager)
+{
+	if(workloadManager == NULL || *workloadManager == NULL)
+	{
+		printf("[DEBUG] workloadManager 해제 실패. 객체가 NULL.\n");
+		return;
+	}
+
+	workloadManager_t *manager = *workloadManager;
+	if(manager->fd != -1) close(manager->fd);
+	pthread_mutex_destroy(&(manager->mutex));
+	pthread_cond_destroy(&(manager->turn));
+	free(manager);
+	*workloadManager = NULL;
+}
+
+/**
+ * @fn int workloadManagerRun(workloadManager_t *workloadManager, double noiseRatio, uint64_t seed, int threadNum)
+ * @brief 작업 스레드들이 블록 단위로 점수를 만들어 출력 파일에 기록하게 하는 함수
+ * 이진 형식은 파일 크기를 미리 정하고 블록마다 제 위치에 기록하며, 텍스트 형식은 블록 번호 순서대로 이어서 기록한다.
+ * 외부에서 접근할 수 있는 함수이므로 전달받은 구조체 포인터에 대한 NULL 체크를 수행한다.
+ * @param workloadManager 작업을 관리하는 구조체(입력 및 출력)
+ * @param noiseRatio 범위를 벗어난 점수를 섞는 비율(입력, 0 ~ 1)
+ * @param seed 난수 시드(입력)
+ * @param threadNum 작업 스레드 개수(입력, 1 ~ WORKLOAD_MAX_THREAD_NUM)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int workloadManagerRun(workloadManager_t *workloadManager, double noiseRatio, uint64_t seed, int threadNum)
+{
+	if(workloadManager == NULL)
+	{
+		printf("[DEBUG] workloadManager 가 NULL.\n");
+		return FAIL;
+	}
+
+	if(noiseRatio < 0 || noiseRatio > 1 || threadNum <= 0 || threadNum > WORKLOAD_MAX_THREAD_NUM)
+	{
+		printf("[ERROR] 잘못된 생성 조건. (noise:%f, threads:%d, max threads:%d)\n", noiseRatio, threadNum, WORKLOAD_MAX_THREAD_NUM);
+		return FAIL;
+	}
+
+	workloadManager->noiseRatio = noiseRatio;
+	workloadManager->seed = seed;
+	workloadManager->threadNum = threadNum;
+	workloadManager->nextBlock = 0;
+	workloadManager->writeBlock = 0;
+	workloadManager->byteNum = 0;
+
+	if(workloadManager->format == WORKLOAD_BINARY)
+	{
+		recordBinaryHeader_t header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, RECORD_BINARY_MAGIC, sizeof(header.magic));
+		header.version = RECORD_BINARY_VERSION;
+		header.scale = workloadManager->gradeManager->scale;
+		header.recordNum = (uint64_t)workloadManager->recordNum;
+
+		off_t fileSize = (off_t)(sizeof(header) + (size_t)workloadManager->recordNum * sizeof(int32_t));
+		if(recordBufferWriteAll(workloadManager->fd, (const char*)&header, sizeof(header)) == FAIL) return FAIL;
+		if(ftruncate(workloadManager->fd, fileSize) == -1)
+		{
+			printf("[ERROR] 출력 파일 크기 지정 실패. (fileName:%s, errno:%d)\n", workloadManager->outputPath, errno);
+			return FAIL;
+		}
+		workloadManager->byteNum = (long long)fileSize;
+	}
+
+	printf("[생성 시작] (output:%s, records:%lld, distribution:%s, format:%s, noise:%.4f, seed:%llu, threads:%d)\n", workloadManager->outputPath,
+		workloadManager->recordNum, workloadGetDistributionName(workloadManager->distribution), (workloadManager->format == WORKLOAD_BINARY) ? "binary" : "text",
+		noiseRatio, (unsigned long long)seed, threadNum);
+
+	struct timespec startTime, endTime;
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	pthread_t threadList[WORKLOAD_MAX_THREAD_NUM];
+	workloadWorker_t workerList[WORKLOAD_MAX_THREAD_NUM];
+	memset(workerList, 0, sizeof(workerList));
+
+	int threadIndex = 0;
+	int createdNum = 0;
+	for( ; threadIndex < threadNum; threadIndex++)
+	{
+		workerList[threadIndex].workloadManager = workloadManager;
+		if(pthread_create(&(threadList[threadIndex]), NULL, workloadManagerWorkerThread, &(workerList[threadIndex])) != 0)
+		{
+			printf("[ERROR] 작업 스레드 생성 실패. (threadIndex:%d)\n", threadIndex);
+			workloadManagerSetFailed(workloadManager);
+			break;
+		}
+		createdNum++;
+	}
+
+	for(threadIndex = 0; threadIndex < createdNum; threadIndex++)
+	{
+		pthread_join(threadList[threadIndex], NULL);
+		gradeStatsMerge(&(workloadManager->stats), &(workerList[threadIndex].stats));
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+	double elapsedSec = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+	if(workloadManagerIsFailed(workloadManager) == TRUE || createdNum == 0) return FAIL;
+
+	printf("[생성 결과] ");
+	gradeStatsPrint(stdout, &(workloadManager->stats));
+	printf("[생성 종료] (elapsed:%.3fs, output:%lldB, %.1fMB/s)\n", elapsedSec, workloadManager->byteNum,
+		(elapsedSec > 0) ? (double)workloadManager->byteNum / elapsedSec / (1024.0 * 1024.0) : 0.0);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int workloadGetDistribution(const char *name)
+ * @brief 점수 분포 이름을 분포 종류로 바꾸는 함수
+ * @param name 분포 이름(입력, 읽기 전용, uniform/normal/bimodal/skewed/mispredict)
+ * @return 성공 시 분포 종류(WORKLOAD_DISTRIBUTION), 알 수 없는 이름이면 FAIL 반환
+ */
+int workloadGetDistribution(const char *name)
+{
+	if(name == NULL) return FAIL;
+
+	int distribution = 0;
+	for( ; distribution < WORKLOAD_DISTRIBUTION_NUM; distribution++)
+	{
+		if(strcmp(name, workloadGetDistributionName(distribution)) == 0) return distribution;
+	}
+
+	return FAIL;
+}
+
+/**
+ * @fn const char* workloadGetDistributionName(int distribution)
+ * @brief 점수 분포 종류의 이름을 반환하는 함수
+ * @param distribution 분포 종류(입력, WORKLOAD_DISTRIBUTION)
+ * @return 분포 이름 문자열 반환
+ */
+const char* workloadGetDistributionName(int distribution)
+{
+	switch(distribution)
+	{
+		case WORKLOAD_UNIFORM: return "uniform";
+		case WORKLOAD_NORMAL: return "normal";
+		case WORKLOAD_BIMODAL: return "bimodal";
+		case WORKLOAD_SKEWED: return "skewed";
+		case WORKLOAD_MISPREDICT: return "mispredict";
+		default: return "unknown";
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Static Functions for workloadManager_t
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void workloadManagerBuildRanges(workloadManager_t *workloadManager)
+ * @brief 분기 예측 실패 분포에서 사용할 등급별 점수 범위를 등급 판단 순서(A, B, C, D, F)로 만드는 함수
+ * F 는 A ~ D 범위 아래(없으면 위)의 남은 전체 범위로 정하고, 남은 범위가 없으면 제외한다.
+ * workloadManagerNew 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param workloadManager 작업을 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void workloadManagerBuildRanges(workloadManager_t *workloadManager)
+{
+	const gradeManager_t *gradeManager = workloadManager->gradeManager;
+	const gradeInfo_t *infoList[4] = { &(gradeManager->gradeA), &(gradeManager->gradeB), &(gradeManager->gradeC), &(gradeManager->gradeD) };
+	int gradedMin = gradeManager->totalMax;
+	int gradedMax = gradeManager->totalMin;
+
+	int infoIndex = 0;
+	workloadManager->rangeNum = 0;
+	for( ; infoIndex < 4; infoIndex++)
+	{
+		const gradeInfo_t *info = infoList[infoIndex];
+		workloadRange_t *range = &(workloadManager->rangeList[workloadManager->rangeNum++]);
+		range->grade = (char)('A' + infoIndex);
+		range->min = info->min;
+		range->max = info->max;
+		if(info->min < gradedMin) gradedMin = info->min;
+		if(info->max > gradedMax) gradedMax = info->max;
+	}
+
+	workloadRange_t *failRange = &(workloadManager->rangeList[workloadManager->rangeNum]);
+	failRange->grade = 'F';
+	if(gradedMin > gradeManager->totalMin)
+	{
+		failRange->min = gradeManager->totalMin;
+		failRange->max = gradedMin - 1;
+		workloadManager->rangeNum++;
+	}
+	else if(gradedMax < gradeManager->totalMax)
+	{
+		failRange->min = gradedMax + 1;
+		failRange->max = gradeManager->totalMax;
+		workloadManager->rangeNum++;
+	}
+}
+
+/**
+ * @fn static void* workloadManagerWorkerThread(void *data)
+ * @brief 다음 블록 번호를 받아 점수를 만들고 기록하는 것을 블록이 남지 않을 때까지 반복하는 작업 스레드 함수
+ * @param data 작업 스레드 정보(workloadWorker_t)
+ * @return 항상 NULL 반환
+ */
+static void* workloadManagerWorkerThread(void *data)
+{
+	workloadWorker_t *worker = (workloadWorker_t*)data;
+	workloadManager_t *workloadManager = worker->workloadManager;
+
+	gradeStatsInit(&(worker->stats));
+	worker->scoreList = (int*)malloc(sizeof(int) * WORKLOAD_BLOCK_NUM);
+	if(worker->scoreList == NULL || (workloadManager->format == WORKLOAD_TEXT && recordBufferInit(&(worker->buffer), (size_t)WORKLOAD_BLOCK_NUM * 24) == FAIL))
+	{
+		printf("[DEBUG] 블록 버퍼 동적 생성 실패. NULL.\n");
+		workloadManagerSetFailed(workloadManager);
+	}
+
+	while(workloadManagerIsFailed(workloadManager) == FALSE)
+	{
+		long long blockIndex = __atomic_fetch_add(&(workloadManager->nextBlock), 1, __ATOMIC_RELAXED);
+		if(blockIndex >= workloadManager->blockNum) break;
+
+		long long first = blockIndex * WORKLOAD_BLOCK_NUM;
+		long long remain = workloadManager->recordNum - first;
+		int count = (remain < WORKLOAD_BLOCK_NUM) ? (int)remain : WORKLOAD_BLOCK_NUM;
+
+		int recordIndex = 0;
+		for( ; recordIndex < count; recordIndex++)
+		{
+			int score = workloadManagerMakeScore(workloadManager, first + recordIndex);
+			worker->scoreList[recordIndex] = score;
+			gradeStatsAdd(&(worker->stats), score, gradeManagerClassifyScore(workloadManager->gradeManager, score));
+		}
+
+		if(workloadWorkerWriteBlock(worker, blockIndex, first, count) == FAIL)
+		{
+			workloadManagerSetFailed(workloadManager);
+		}
+	}
+
+	// 오류로 멈춘 경우 차례를 기다리는 다른 스레드들을 깨운다.
+	pthread_mutex_lock(&(workloadManager->mutex));
+	pthread_cond_broadcast(&(workloadManager->turn));
+	pthread_mutex_unlock(&(workloadManager->mutex));
+
+	free(worker->scoreList);
+	worker->scoreList = NULL;
+	recordBufferFinal(&(worker->buffer));
+	return NULL;
+}
+
+/**
+ * @fn static int workloadWorkerWriteBlock(workloadWorker_t *worker, long long blockIndex, long long first, int count)
+ * @brief 블록의 점수를 출력 형식에 맞게 기록하는 함수
+ * 이진 형식은 블록의 파일 위치에 바로 기록하고, 텍스트 형식은 레코드로 바꾼 뒤 앞 블록이 기록될 때까지 기다렸다가 이어서 기록한다.
+ * workloadManagerWorkerThread 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param worker 작업 스레드 정보(입력 및 출력)
+ * @param blockIndex 블록 번호(입력)
+ * @param first 블록의 첫 레코드 번호(입력)
+ * @param count 블록의 레코드 개수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int workloadWorkerWriteBlock(workloadWorker_t *worker, long long blockIndex, long long first, int count)
+{
+	workloadManager_t *workloadManager = worker->workloadManager;
+
+	if(workloadManager->format == WORKLOAD_BINARY)
+	{
+		const char *data = (const char*)worker->scoreList;
+		size_t length = (size_t)count * sizeof(int32_t);
+		off_t offset = (off_t)(sizeof(recordBinaryHeader_t) + (size_t)first * sizeof(int32_t));
+		while(length > 0)
+		{
+			ssize_t written = pwrite(workloadManager->fd, data, length, offset);
+			if(written < 0)
+			{
+				if(errno == EINTR) continue;
+				printf("[ERROR] 출력 파일 쓰기 실패. (fileName:%s, errno:%d)\n", workloadManager->outputPath, errno);
+				return FAIL;
+			}
+			data += written;
+			length -= (size_t)written;
+			offset += written;
+		}
+		return SUCCESS;
+	}
+
+	recordBuffer_t *buffer = &(worker->buffer);
+	buffer->length = 0;
+
+	int recordIndex = 0;
+	for( ; recordIndex < count; recordIndex++)
+	{
+		char line[64];
+		char scoreText[GRADE_SCORE_TEXT_LEN];
+		gradeManagerFormatScore(workloadManager->gradeManager, worker->scoreList[recordIndex], scoreText, sizeof(scoreText));
+		int lineLength = snprintf(line, sizeof(line), "%010lld %s\n", first + recordIndex, scoreText);
+		if(recordBufferAppend(buffer, line, (size_t)lineLength) == FAIL) return FAIL;
+	}
+
+	int result = SUCCESS;
+	pthread_mutex_lock(&(workloadManager->mutex));
+	while(workloadManager->writeBlock != blockIndex && workloadManagerIsFailed(workloadManager) == FALSE)
+	{
+		pthread_cond_wait(&(workloadManager->turn), &(workloadManager->mutex));
+	}
+	pthread_mutex_unlock(&(workloadManager->mutex));
+
+	if(workloadManagerIsFailed(workloadManager) == TRUE) return FAIL;
+
+	// 차례가 된 스레드만 기록하므로 쓰는 동안에는 잠금을 잡지 않는다.
+	result = recordBufferWriteAll(workloadManager->fd, buffer->data, buffer->length);
+
+	pthread_mutex_lock(&(workloadManager->mutex));
+	workloadManager->byteNum += (long long)buffer->length;
+	workloadManager->writeBlock++;
+	pthread_cond_broadcast(&(workloadManager->turn));
+	pthread_mutex_unlock(&(workloadManager->mutex));
+
+	return result;
+}
+
+/**
+ * @fn static int workloadManagerMakeScore(const workloadManager_t *workloadManager, long long index)
+ * @brief index 번째 레코드의 점수를 분포와 잡음 비율에 따라 만드는 함수
+ * 모든 난수는 (seed, index, 스트림 번호) 로 정해지므로 어느 스레드가 만들어도 같은 점수가 나온다.
+ * 분기 예측 실패 분포는 등급 판단 순서(A, B, C, D, F)의 각 비교가 참일 확률이 1/2 이 되도록
+ * 등급을 1/2, 1/4, 1/8, ... 확률로 고르고(마지막 등급이 나머지를 가진다) 등급 범위 안에서 균등하게 점수를 고른다.
+ * workloadManagerWorkerThread 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param workloadManager 작업을 관리하는 구조체(입력, 읽기 전용)
+ * @param index 레코드 번호(입력)
+ * @return 만든 점수 반환 (scale 배 한 정수)
+ */
+static int workloadManagerMakeScore(const workloadManager_t *workloadManager, long long index)
+{
+	const gradeManager_t *gradeManager = workloadManager->gradeManager;
+	long long totalMin = gradeManager->totalMin;
+	long long totalMax = gradeManager->totalMax;
+	uint64_t range = (uint64_t)(totalMax - totalMin + 1);
+	uint64_t value = workloadRandom(workloadManager->seed, index, WORKLOAD_STREAM_VALUE);
+
+	if(workloadManager->noiseRatio > 0 && workloadUnit(workloadRandom(workloadManager->seed, index, WORKLOAD_STREAM_NOISE)) < workloadManager->noiseRatio)
+	{
+		// 전체 범위 크기만큼 아래 또는 위로 벗어난 점수 (int 범위로 제한)
+		long long offset = (long long)(value % range) + 1;
+		long long score = ((value >> 63) == 0) ? totalMin - offset : totalMax + offset;
+		if(score < INT_MIN) score = INT_MIN;
+		if(score > INT_MAX) score = INT_MAX;
+		return (int)score;
+	}
+
+	switch(workloadManager->distribution)
+	{
+		case WORKLOAD_NORMAL:
+			return workloadManagerMakeNormal(workloadManager, index, (double)(totalMin + totalMax) / 2.0, (double)range / 6.0);
+
+		case WORKLOAD_BIMODAL:
+		{
+			uint64_t select = workloadRandom(workloadManager->seed, index, WORKLOAD_STREAM_SELECT);
+			double center = (double)totalMin + (double)range * (((select & 1) == 0) ? 0.3 : 0.8);
+			return workloadManagerMakeNormal(workloadManager, index, center, (double)range / 10.0);
+		}
+
+		case WORKLOAD_SKEWED:
+		{
+			double unit = workloadUnit(value);
+			long long offset = (long long)((double)range * unit * unit * unit * unit);
+			return (int)(totalMax - ((offset < (long long)range) ? offset : (long long)range - 1));
+		}
+
+		case WORKLOAD_MISPREDICT:
+		{
+			// 연속된 1 비트 개수로 등급을 고르면 k 번째 등급이 뽑힐 확률은 1 / 2^(k+1) 이다.
+			uint64_t select = workloadRandom(workloadManager->seed, index, WORKLOAD_STREAM_SELECT);
+			int rangeIndex = 0;
+			while(rangeIndex < workloadManager->rangeNum - 1 && (select & 1) == 1)
+			{
+				select >>= 1;
+				rangeIndex++;
+			}
+			const workloadRange_t *gradeRange = &(workloadManager->rangeList[rangeIndex]);
+			return (int)((long long)gradeRange->min + (long long)(value % (uint64_t)((long long)gradeRange->max - gradeRange->min + 1)));
+		}
+
+		default:
+			return (int)(totalMin + (long long)(value % range));
+	}
+}
+
+/**
+ * @fn static int workloadManagerMakeNormal(const workloadManager_t *workloadManager, long long index, double mean, double stddev)
+ * @brief Box-Muller 변환으로 정규 분포 점수를 만들고 전체 범위 안으로 자르는 함수
+ * workloadManagerMakeScore 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param workloadManager 작업을 관리하는 구조체(입력, 읽기 전용)
+ * @param index 레코드 번호(입력)
+ * @param mean 평균(입력)
+ * @param stddev 표준편차(입력)
+ * @return 만든 점수 반환 (scale 배 한 정수)
+ */
+static int workloadManagerMakeNormal(const workloadManager_t *workloadManager, long long index, double mean, double stddev)
+{
+	const gradeManager_t *gradeManager = workloadManager->gradeManager;
+	// log(0) 을 피하기 위해 (0, 1] 범위를 사용한다.
+	double radiusUnit = 1.0 - workloadUnit(workloadRandom(workloadManager->seed, index, WORKLOAD_STREAM_VALUE));
+	double angleUnit = workloadUnit(workloadRandom(workloadManager->seed, index, WORKLOAD_STREAM_ANGLE));
+	double normal = sqrt(-2.0 * log(radiusUnit)) * cos(2.0 * M_PI * angleUnit);
+
+	double score = floor(mean + normal * stddev + 0.5);
+	if(score < (double)gradeManager->totalMin) return gradeManager->totalMin;
+	if(score > (double)gradeManager->totalMax) return gradeManager->totalMax;
+	return (int)score;
+}
+
+/**
+ * @fn static uint64_t workloadRandom(uint64_t seed, long long index, int stream)
+ * @brief (시드, 레코드 번호, 스트림 번호) 로 정해지는 카운터 기반 64 비트 난수를 만드는 함수
+ * 상태를 갖지 않으므로 스레드들이 임의의 레코드 번호부터 독립적으로 만들 수 있다. (splitmix64 의 섞기 함수 사용)
+ * @param seed 난수 시드(입력)
+ * @param index 레코드 번호(입력)
+ * @param stream 스트림 번호(입력)
+ * @return 64 비트 난수 반환
+ */
+static uint64_t workloadRandom(uint64_t seed, long long index, int stream)
+{
+	uint64_t value = seed + ((uint64_t)index * 4 + (uint64_t)stream + 1) * 0x9E3779B97F4A7C15ULL;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+/**
+ * @fn static double workloadUnit(uint64_t value)
+ * @brief 64 비트 난수의 상위 53 비트로 [0, 1) 범위의 실수를 만드는 함수
+ * @param value 64 비트 난수(입력)
+ * @return [0, 1) 범위의 실수 반환
+ */
+static double workloadUnit(uint64_t value)
+{
+	return (double)(value >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @fn static void workloadManagerSetFailed(workloadManager_t *workloadManager)
+ * @brief 처리 중 오류가 발생했음을 표시하는 함수 (다른 스레드들이 작업을 멈추게 한다)
+ * @param workloadManager 작업을 관리하는 구조체(입력 및 출력)
+ * @return 반환값 없음
+ */
+static void workloadManagerSetFailed(workloadManager_t *workloadManager)
+{
+	__atomic_store_n(&(workloadManager->failed), TRUE, __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn static int workloadManagerIsFailed(workloadManager_t *workloadManager)
+ * @brief 처리 중 오류가 발생했는지 확인하는 함수
+ * @param workloadManager 작업을 관리하는 구조체(입력)
+ * @return 오류가 발생했으면 TRUE, 아니면 FALSE 반환
+ */
+static int workloadManagerIsFailed(workloadManager_t *workloadManager)
+{
+	return __atomic_load_n(&(workloadManager->failed), __ATOMIC_RELAXED);
+}
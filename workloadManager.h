@@ -0,0 +1,129 @@
+#ifndef __WORKLOAD_MANAGER_H__
+#define __WORKLOAD_MANAGER_H__
+
+#include <stdint.h>
+#include <pthread.h>
+#include <limits.h>
+
+#include "recordManager.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+//////////////////////////////////////////////////////////////////////////
+
+// 작업 스레드가 한 번에 만드는 레코드 개수 (블록 단위로 순서대로 기록된다)
+#define WORKLOAD_BLOCK_NUM			(256 * 1024)
+// 작업 스레드 최대 개수
+#define WORKLOAD_MAX_THREAD_NUM		64
+
+// 점수 분포 종류 열거형
+enum WORKLOAD_DISTRIBUTION
+{
+	WORKLOAD_UNIFORM = 0,	// 전체 범위 균등 분포
+	WORKLOAD_NORMAL,		// 범위 가운데를 평균으로 하는 정규 분포 (표준편차 = 범위 / 6)
+	WORKLOAD_BIMODAL,		// 범위의 30%, 80% 위치를 중심으로 하는 두 정규 분포의 혼합
+	WORKLOAD_SKEWED,		// 최대값 쪽으로 크게 치우친 분포 (max - range * u^4)
+	WORKLOAD_MISPREDICT,	// 등급 판단 비교문의 분기 예측이 가장 많이 실패하도록 만든 분포
+	WORKLOAD_DISTRIBUTION_NUM
+};
+
+// 출력 형식 열거형
+enum WORKLOAD_FORMAT
+{
+	WORKLOAD_TEXT = 0,		// (학번) (점수) 텍스트 레코드
+	WORKLOAD_BINARY			// recordBinaryHeader_t + int32 점수 배열
+};
+
+/**
+ * @struct workloadRange_t
+ * @brief 분기 예측 실패 분포에서 사용하는 등급 하나의 점수 범위 구조체
+ */
+typedef struct workloadRange_s workloadRange_t;
+struct workloadRange_s
+{
+	// 등급 문자
+	char grade;
+	// 범위 최소값
+	int min;
+	// 범위 최대값
+	int max;
+};
+
+/**
+ * @struct workloadManager_t
+ * @brief 등급 판단 성능 측정과 검증에 사용할 점수 파일을 여러 스레드로 생성하는 구조체
+ * i 번째 레코드의 점수는 (seed, i) 만으로 정해지는 카운터 기반 난수로 만들기 때문에
+ * 스레드 개수나 실행 순서와 관계없이 같은 시드면 같은 파일이 만들어진다.
+ * 텍스트 형식은 블록 번호 순서대로 기록하고, 이진 형식은 레코드 위치가 고정이므로 블록마다 바로 기록한다.
+ */
+typedef struct workloadManager_s workloadManager_t;
+struct workloadManager_s
+{
+	// 등급 정보를 관리하는 구조체 (점수 범위, 배율, 분기 예측 실패 분포에 사용)
+	const gradeManager_t *gradeManager;
+	// 출력 파일 경로
+	char outputPath[PATH_MAX];
+	// 출력 파일 디스크립터
+	int fd;
+	// 만들 레코드 개수
+	long long recordNum;
+	// 점수 분포 (WORKLOAD_DISTRIBUTION)
+	int distribution;
+	// 출력 형식 (WORKLOAD_FORMAT)
+	int format;
+	// 범위를 벗어난 점수를 섞는 비율 (0 ~ 1)
+	double noiseRatio;
+	// 난수 시드
+	uint64_t seed;
+	// 작업 스레드 개수
+	int threadNum;
+	// 분기 예측 실패 분포의 등급 범위 목록 (등급 판단 순서)
+	workloadRange_t rangeList[GRADE_KIND_NUM];
+	// 등급 범위 개수
+	int rangeNum;
+	// 전체 블록 개수
+	long long blockNum;
+	// 다음에 만들 블록 번호 (원자적으로 증가)
+	long long nextBlock;
+	// 다음에 기록할 블록 번호 (텍스트 형식)
+	long long writeBlock;
+	// 기록 순서 동기화
+	pthread_mutex_t mutex;
+	// 기록 차례가 바뀌었음을 알리는 조건 변수
+	pthread_cond_t turn;
+	// 처리 중 오류 발생 여부 (원자적으로 변경, TRUE 또는 FALSE)
+	int failed;
+	// 기록한 바이트 수
+	long long byteNum;
+	// 만든 점수의 등급 통계 (생성 결과 검증용)
+	gradeStats_t stats;
+};
+
+/**
+ * @struct workloadWorker_t
+ * @brief 작업 스레드 하나의 블록 버퍼와 통계를 관리하는 구조체
+ */
+typedef struct workloadWorker_s workloadWorker_t;
+struct workloadWorker_s
+{
+	// 작업을 관리하는 구조체
+	workloadManager_t *workloadManager;
+	// 블록의 점수 배열
+	int *scoreList;
+	// 텍스트 형식의 블록 출력 버퍼
+	recordBuffer_t buffer;
+	// 스레드가 만든 점수의 등급 통계
+	gradeStats_t stats;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Public Functions for workloadManager_t
+//////////////////////////////////////////////////////////////////////////
+
+workloadManager_t* workloadManagerNew(const gradeManager_t *gradeManager, const char *outputPath, long long recordNum, int distribution, int format);
+void workloadManagerDelete(workloadManager_t **workloadManager);
+int workloadManagerRun(workloadManager_t *workloadManager, double noiseRatio, uint64_t seed, int threadNum);
+int workloadGetDistribution(const char *name);
+const char* workloadGetDistributionName(int distribution);
+
+#endif // #ifndef __WORKLOAD_MANAGER_H__